@@ -4,6 +4,7 @@
 #include "Highs.h"
 #include "HighsRandom.h"
 #include "catch.hpp"
+#include "lp_data/HighsLpUtils.h"
 
 const bool dev_run = false;
 
@@ -429,6 +430,51 @@ void testBasisSolve(Highs& highs) {
   if (dev_run)
     printf("Test 7: max_residual_norm = %11.4g (getReducedColumn)\n",
            max_residual_norm);
+
+  // Check that the bulk row methods give the same rows as the
+  // individual methods, taking rows in reverse order with a repeat
+  vector<HighsInt> row_set;
+  for (HighsInt row = numRow - 1; row >= 0; row--) row_set.push_back(row);
+  row_set.push_back(numRow / 2);
+  const HighsInt num_set_entries = row_set.size();
+  vector<HighsInt> row_start, row_index;
+  vector<double> row_value;
+  double max_value_error = 0;
+  for (HighsInt reduced = 0; reduced < 2; reduced++) {
+    if (reduced) {
+      highs_status = highs.getReducedRows(num_set_entries, &row_set[0],
+                                          row_start, row_index, row_value);
+    } else {
+      highs_status = highs.getBasisInverseRows(num_set_entries, &row_set[0],
+                                               row_start, row_index, row_value);
+    }
+    REQUIRE(highs_status == HighsStatus::kOk);
+    REQUIRE((HighsInt)row_start.size() == num_set_entries + 1);
+    const HighsInt row_dim = reduced ? numCol : numRow;
+    vector<double> bulk_row(row_dim);
+    vector<double>& single_row = reduced ? solution_row : solution_col;
+    for (HighsInt ix = 0; ix < num_set_entries; ix++) {
+      if (reduced) {
+        highs_status = highs.getReducedRow(row_set[ix], &single_row[0]);
+      } else {
+        highs_status = highs.getBasisInverseRow(row_set[ix], &single_row[0]);
+      }
+      REQUIRE(highs_status == HighsStatus::kOk);
+      bulk_row.assign(row_dim, 0);
+      for (HighsInt el = row_start[ix]; el < row_start[ix + 1]; el++) {
+        if (el > row_start[ix]) REQUIRE(row_index[el - 1] < row_index[el]);
+        bulk_row[row_index[el]] = row_value[el];
+      }
+      for (HighsInt iX = 0; iX < row_dim; iX++)
+        max_value_error =
+            std::max(fabs(bulk_row[iX] - single_row[iX]), max_value_error);
+    }
+  }
+  if (dev_run)
+    printf("Test 8: max_value_error = %11.4g (getBasisInverseRows and "
+           "getReducedRows)\n",
+           max_value_error);
+  REQUIRE(max_value_error < solution_error_tolerance);
 }
 
 // No commas in test case name.
@@ -555,6 +601,13 @@ TEST_CASE("Basis-solves", "[highs_basis_solves]") {
   highs_status = highs.getReducedColumn(0, &solution_col[0]);
   REQUIRE(highs_status == HighsStatus::kError);
 
+  vector<HighsInt> row_set = {0};
+  vector<HighsInt> row_start, row_index;
+  vector<double> row_value;
+  highs_status = highs.getBasisInverseRows(1, &row_set[0], row_start,
+                                           row_index, row_value);
+  REQUIRE(highs_status == HighsStatus::kError);
+
   // Solve and perform numerical tests
   highs_status = highs.run();
   REQUIRE(highs_status == HighsStatus::kOk);
@@ -579,3 +632,291 @@ TEST_CASE("Basis-solves", "[highs_basis_solves]") {
   highs.run();
   REQUIRE(highs.getInfo().simplex_iteration_count == 0);
 }
+
+TEST_CASE("HFactor-compact-U", "[highs_basis_solves]") {
+  // Perform FT updates from a logical basis with two factors: one that
+  // compacts U and UR whenever there are dead entries and one that
+  // never does. Compaction leaves the order of the entries unchanged,
+  // so the solves should give identical results
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  HighsLp lp = highs.getLp();
+  ensureColWise(lp);
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt* a_start = &lp.a_start_[0];
+  const HighsInt* a_index = &lp.a_index_[0];
+  const double* a_value = &lp.a_value_[0];
+  vector<HighsInt> base_index(num_row);
+  vector<HighsInt> compact_base_index(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    base_index[iRow] = num_col + iRow;
+  compact_base_index = base_index;
+
+  HFactor factor;
+  HFactor compact_factor;
+  factor.setup(num_col, num_row, a_start, a_index, a_value, &base_index[0]);
+  compact_factor.setup(num_col, num_row, a_start, a_index, a_value,
+                       &compact_base_index[0]);
+  factor.update_min_dead_count = kHighsIInf;
+  compact_factor.update_min_dead_count = 0;
+  REQUIRE(factor.build() == 0);
+  REQUIRE(compact_factor.build() == 0);
+
+  HVector aq, ep, compact_aq, compact_ep;
+  aq.setup(num_row);
+  ep.setup(num_row);
+  compact_aq.setup(num_row);
+  compact_ep.setup(num_row);
+  auto setColumn = [&](HVector& column, const HighsInt iCol) {
+    column.clear();
+    column.packFlag = true;
+    for (HighsInt iEl = a_start[iCol]; iEl < a_start[iCol + 1]; iEl++) {
+      column.index[column.count++] = a_index[iEl];
+      column.array[a_index[iEl]] = a_value[iEl];
+    }
+  };
+  auto setUnitRow = [&](HVector& row, const HighsInt iRow) {
+    row.clear();
+    row.packFlag = true;
+    row.count = 1;
+    row.index[0] = iRow;
+    row.array[iRow] = 1;
+  };
+  // Cycle through the structurals that are nonbasic, so that columns
+  // that have been replaced can enter again
+  vector<bool> basic(num_col + num_row, false);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) basic[num_col + iRow] = true;
+  const HighsInt max_num_update = 1000;
+  HighsInt num_update = 0;
+  for (HighsInt k = 0; k < 10 * num_col; k++) {
+    if (num_update >= max_num_update) break;
+    const HighsInt iCol = k % num_col;
+    if (basic[iCol]) continue;
+    setColumn(aq, iCol);
+    setColumn(compact_aq, iCol);
+    factor.ftran(aq, 1);
+    compact_factor.ftran(compact_aq, 1);
+    REQUIRE(aq.array == compact_aq.array);
+    // Pivot on the largest entry in the column so that the basic
+    // structurals, whose entries in U become dead, are also replaced
+    HighsInt pivot_row = -1;
+    double max_pivot = 1e-2;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      if (fabs(aq.array[iRow]) > max_pivot) {
+        max_pivot = fabs(aq.array[iRow]);
+        pivot_row = iRow;
+      }
+    }
+    if (pivot_row < 0) continue;
+    setUnitRow(ep, pivot_row);
+    setUnitRow(compact_ep, pivot_row);
+    factor.btran(ep, 1);
+    compact_factor.btran(compact_ep, 1);
+    REQUIRE(ep.array == compact_ep.array);
+    HighsInt hint = 0;
+    HighsInt compact_pivot_row = pivot_row;
+    factor.update(&aq, &ep, &pivot_row, &hint);
+    compact_factor.update(&compact_aq, &compact_ep, &compact_pivot_row,
+                          &hint);
+    basic[base_index[pivot_row]] = false;
+    basic[iCol] = true;
+    base_index[pivot_row] = iCol;
+    compact_base_index[pivot_row] = iCol;
+    num_update++;
+  }
+  REQUIRE(num_update == max_num_update);
+  REQUIRE(factor.update_compact_count == 0);
+  REQUIRE(compact_factor.update_compact_count > 0);
+
+  // Check that each structural basic column solves to its unit vector
+  double max_residual = 0;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const HighsInt iCol = compact_base_index[iRow];
+    if (iCol >= num_col) continue;
+    setColumn(compact_aq, iCol);
+    compact_factor.ftran(compact_aq, 1);
+    for (HighsInt jRow = 0; jRow < num_row; jRow++) {
+      const double unit = jRow == iRow ? 1 : 0;
+      max_residual =
+          std::max(fabs(compact_aq.array[jRow] - unit), max_residual);
+    }
+  }
+  if (dev_run) printf("Max residual after compaction is %g\n", max_residual);
+  REQUIRE(max_residual < 1e-8);
+}
+
+// Sets up and builds the factor of the logical basis of the LP, and
+// then performs FT updates that replace logicals by the first
+// structurals that give a large pivot
+static void setupUpdatedFactor(HFactor& factor, const HighsLp& lp,
+                               vector<HighsInt>& base_index,
+                               const HighsInt max_num_update) {
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt* a_start = &lp.a_start_[0];
+  const HighsInt* a_index = &lp.a_index_[0];
+  const double* a_value = &lp.a_value_[0];
+  base_index.resize(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    base_index[iRow] = num_col + iRow;
+  factor.setup(num_col, num_row, a_start, a_index, a_value, &base_index[0]);
+  REQUIRE(factor.build() == 0);
+
+  HVector aq, ep;
+  aq.setup(num_row);
+  ep.setup(num_row);
+  HighsInt num_update = 0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    if (num_update >= max_num_update) break;
+    aq.clear();
+    aq.packFlag = true;
+    for (HighsInt iEl = a_start[iCol]; iEl < a_start[iCol + 1]; iEl++) {
+      aq.index[aq.count++] = a_index[iEl];
+      aq.array[a_index[iEl]] = a_value[iEl];
+    }
+    factor.ftran(aq, 1);
+    HighsInt pivot_row = -1;
+    double max_pivot = 1e-2;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      if (base_index[iRow] < num_col) continue;
+      if (fabs(aq.array[iRow]) > max_pivot) {
+        max_pivot = fabs(aq.array[iRow]);
+        pivot_row = iRow;
+      }
+    }
+    if (pivot_row < 0) continue;
+    ep.clear();
+    ep.packFlag = true;
+    ep.count = 1;
+    ep.index[0] = pivot_row;
+    ep.array[pivot_row] = 1;
+    factor.btran(ep, 1);
+    HighsInt hint = 0;
+    factor.update(&aq, &ep, &pivot_row, &hint);
+    base_index[pivot_row] = iCol;
+    num_update++;
+  }
+  REQUIRE(num_update == max_num_update);
+}
+
+TEST_CASE("HFactor-block-solve", "[highs_basis_solves]") {
+  // After FT updates from a logical basis, solve fewer than, exactly
+  // and more than kBlockSolveWidth RHS vectors together, and check
+  // that the results are those of solving the vectors one at a time
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  HighsLp lp = highs.getLp();
+  ensureColWise(lp);
+  const HighsInt num_row = lp.num_row_;
+  vector<HighsInt> base_index;
+  HFactor factor;
+  setupUpdatedFactor(factor, lp, base_index, 50);
+
+  HighsRandom random;
+  auto setRandom = [&](HVector& rhs, const double density) {
+    rhs.setup(num_row);
+    rhs.clear();
+    rhs.packFlag = true;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      if (random.fraction() > density) continue;
+      rhs.index[rhs.count++] = iRow;
+      rhs.array[iRow] = 1 + random.fraction();
+    }
+  };
+  vector<HighsInt> num_rhs = {kBlockSolveWidth - 3, kBlockSolveWidth,
+                              2 * kBlockSolveWidth + 3};
+  for (HighsInt k : num_rhs) {
+    for (HighsInt pass = 0; pass < 2; pass++) {
+      const bool is_ftran = pass == 0;
+      vector<HVector> rhs(k);
+      // All but the last vector are dense enough to be solved in blocks
+      for (HighsInt iRhs = 0; iRhs < k; iRhs++)
+        setRandom(rhs[iRhs], iRhs < k - 1 ? 0.2 : 0.001);
+      vector<HVector> single_rhs = rhs;
+      if (is_ftran) {
+        factor.ftran(rhs, 1);
+      } else {
+        factor.btran(rhs, 1);
+      }
+      for (HighsInt iRhs = 0; iRhs < k; iRhs++) {
+        if (is_ftran) {
+          factor.ftran(single_rhs[iRhs], 1);
+        } else {
+          factor.btran(single_rhs[iRhs], 1);
+        }
+        // Compare the results as a bool, so that Catch doesn't print them
+        const bool same_result = rhs[iRhs].array == single_rhs[iRhs].array;
+        if (dev_run)
+          printf("%s of %d RHS: vector %d has %d nonzeros%s\n",
+                 is_ftran ? "FTRAN" : "BTRAN", (int)k, (int)iRhs,
+                 (int)rhs[iRhs].count, same_result ? "" : " and differs");
+        REQUIRE(same_result);
+        REQUIRE(rhs[iRhs].count == single_rhs[iRhs].count);
+      }
+    }
+  }
+}
+
+TEST_CASE("HFactor-hyper-reach", "[highs_basis_solves]") {
+  // Solve unit vectors with a historical density that rules out
+  // hyper-sparse TRANs, using two factors: one that solves them using
+  // their reach and one that always uses the sparse TRAN. The reach
+  // is solved in pivot order, so the results, the order of their
+  // indices and the synthetic ticks should be identical
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  HighsLp lp = highs.getLp();
+  ensureColWise(lp);
+  const HighsInt num_row = lp.num_row_;
+  vector<HighsInt> base_index, sparse_base_index;
+  HFactor factor, sparse_factor;
+  setupUpdatedFactor(factor, lp, base_index, 50);
+  sparse_factor.use_hyper_reach = false;
+  setupUpdatedFactor(sparse_factor, lp, sparse_base_index, 50);
+
+  HVector rhs, sparse_rhs;
+  rhs.setup(num_row);
+  sparse_rhs.setup(num_row);
+  auto setUnit = [&](HVector& vector, const HighsInt iRow) {
+    vector.clear();
+    vector.count = 1;
+    vector.index[0] = iRow;
+    vector.array[iRow] = 1;
+  };
+  const double historical_density = 1;
+  for (HighsInt pass = 0; pass < 2; pass++) {
+    const bool is_ftran = pass == 0;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      setUnit(rhs, iRow);
+      setUnit(sparse_rhs, iRow);
+      if (is_ftran) {
+        factor.ftran(rhs, historical_density);
+        sparse_factor.ftran(sparse_rhs, historical_density);
+      } else {
+        factor.btran(rhs, historical_density);
+        sparse_factor.btran(sparse_rhs, historical_density);
+      }
+      // Compare the results as bools, so that Catch doesn't print them
+      const bool same_array = rhs.array == sparse_rhs.array;
+      REQUIRE(same_array);
+      REQUIRE(rhs.count == sparse_rhs.count);
+      const bool same_index =
+          std::equal(rhs.index.begin(), rhs.index.begin() + rhs.count,
+                     sparse_rhs.index.begin());
+      REQUIRE(same_index);
+      REQUIRE(rhs.synthetic_tick == sparse_rhs.synthetic_tick);
+    }
+  }
+  if (dev_run)
+    printf("%d of %d TRANs solved using the reach of the RHS\n",
+           (int)factor.hyper_reach_solve_count, (int)(4 * num_row));
+  REQUIRE(factor.hyper_reach_solve_count > 0);
+  REQUIRE(sparse_factor.hyper_reach_solve_count == 0);
+}
@@ -663,6 +663,288 @@ void test_getColsByRange() {
   Highs_destroy(highs);
 }
 
+void test_getBasisInverseRows() {
+  // Check the bulk row methods against the individual methods for the
+  // LP in full_api_lp
+  void* highs = Highs_create();
+  if (!dev_run) Highs_setBoolOptionValue(highs, "output_flag", 0);
+  const HighsInt numcol = 2;
+  const HighsInt numrow = 3;
+  const HighsInt numnz = 5;
+  double colcost[2] = {2.0, 3.0};
+  double collower[2] = {0.0, 1.0};
+  double colupper[2] = {3.0, 1.0e30};
+  double rowlower[3] = {-1.0e30, 10.0, 8.0};
+  double rowupper[3] = {6.0, 14.0, 1.0e30};
+  HighsInt astart[2] = {0, 2};
+  HighsInt aindex[5] = {1, 2, 0, 1, 2};
+  double avalue[5] = {1.0, 2.0, 1.0, 2.0, 1.0};
+  HighsInt return_status;
+  return_status = Highs_passLp(highs, numcol, numrow, numnz, 1, 1, 0,
+			       colcost, collower, colupper, rowlower, rowupper,
+			       astart, aindex, avalue);
+  assert( return_status == 0 );
+  return_status = Highs_run(highs);
+  assert( return_status == 0 );
+
+  HighsInt row_set[3] = {2, 0, 1};
+  HighsInt row_start[4];
+  HighsInt row_index[9];
+  double row_value[9];
+  HighsInt num_nz;
+  double row_vector[3];
+  HighsInt reduced;
+  for (reduced = 0; reduced < 2; reduced++) {
+    const HighsInt row_dim = reduced ? numcol : numrow;
+    // With no space for the nonzeros, only their number is returned
+    if (reduced) {
+      return_status = Highs_getReducedRows(highs, 3, row_set, 0, &num_nz,
+					   row_start, row_index, row_value);
+    } else {
+      return_status = Highs_getBasisInverseRows(highs, 3, row_set, 0, &num_nz,
+						row_start, row_index, row_value);
+    }
+    assert( num_nz > 0 );
+    assert( return_status == 1 );
+    assert( row_start[3] == num_nz );
+    if (reduced) {
+      return_status = Highs_getReducedRows(highs, 3, row_set, 9, &num_nz,
+					   row_start, row_index, row_value);
+    } else {
+      return_status = Highs_getBasisInverseRows(highs, 3, row_set, 9, &num_nz,
+						row_start, row_index, row_value);
+    }
+    assert( return_status == 0 );
+    HighsInt ix;
+    for (ix = 0; ix < 3; ix++) {
+      if (reduced) {
+	return_status = Highs_getReducedRow(highs, row_set[ix], row_vector,
+					    NULL, NULL);
+      } else {
+	return_status = Highs_getBasisInverseRow(highs, row_set[ix], row_vector,
+						 NULL, NULL);
+      }
+      assert( return_status == 0 );
+      HighsInt el;
+      for (el = row_start[ix]; el < row_start[ix+1]; el++) {
+	assert( row_index[el] < row_dim );
+	assertDoubleValuesEqual("row_value", row_value[el],
+				row_vector[row_index[el]]);
+	row_vector[row_index[el]] = 0;
+      }
+      HighsInt i;
+      for (i = 0; i < row_dim; i++)
+	assertDoubleValuesEqual("row_vector", row_vector[i], 0);
+    }
+  }
+  Highs_destroy(highs);
+}
+
+void test_solveBatch() {
+  // Three variants of the LP in full_api_lp, with different costs, and
+  // with the third made infeasible by x_1 >= 7
+  const HighsInt num_lp = 3;
+  HighsInt numcol[3] = {2, 2, 2};
+  HighsInt numrow[3] = {3, 3, 3};
+  HighsInt numnz[3] = {5, 5, 5};
+  double colcost[6] = {2.0, 3.0, 1.0, 1.0, 2.0, 3.0};
+  double collower[6] = {0.0, 1.0, 0.0, 1.0, 0.0, 7.0};
+  double colupper[6] = {3.0, 1.0e30, 3.0, 1.0e30, 3.0, 1.0e30};
+  double rowlower[9] = {-1.0e30, 10.0, 8.0, -1.0e30, 10.0, 8.0,
+			-1.0e30, 10.0, 8.0};
+  double rowupper[9] = {6.0, 14.0, 1.0e30, 6.0, 14.0, 1.0e30,
+			6.0, 14.0, 1.0e30};
+  HighsInt astart[6] = {0, 2, 0, 2, 0, 2};
+  HighsInt aindex[15] = {1, 2, 0, 1, 2, 1, 2, 0, 1, 2, 1, 2, 0, 1, 2};
+  double avalue[15] = {1.0, 2.0, 1.0, 2.0, 1.0, 1.0, 2.0, 1.0, 2.0, 1.0,
+		       1.0, 2.0, 1.0, 2.0, 1.0};
+  HighsInt modelstatus[3];
+  double objective[3];
+  double colvalue[6];
+  double rowvalue[9];
+  double colvalue1[2];
+  double rowvalue1[3];
+
+  void* highs = Highs_create();
+  if (!dev_run) Highs_setBoolOptionValue(highs, "output_flag", 0);
+  HighsInt return_status =
+    Highs_solveBatch(highs, num_lp, numcol, numrow, numnz, 1, NULL,
+		     colcost, collower, colupper, rowlower, rowupper,
+		     astart, aindex, avalue, modelstatus, objective,
+		     colvalue, NULL, rowvalue, NULL);
+  assert( return_status != -1 );
+  // The model in highs is not changed
+  assert( Highs_getNumCol(highs) == 0 );
+
+  HighsInt iLp;
+  for (iLp = 0; iLp < num_lp; iLp++) {
+    Highs_passLp(highs, 2, 3, 5, 1, 1, 0, colcost + 2 * iLp,
+		 collower + 2 * iLp, colupper + 2 * iLp, rowlower + 3 * iLp,
+		 rowupper + 3 * iLp, astart + 2 * iLp, aindex + 5 * iLp,
+		 avalue + 5 * iLp);
+    Highs_run(highs);
+    assertIntValuesEqual("Batch model status", modelstatus[iLp],
+			 Highs_getModelStatus(highs));
+    if (modelstatus[iLp] != 7) continue;
+    assertDoubleValuesEqual("Batch objective", objective[iLp],
+			    Highs_getObjectiveValue(highs));
+    Highs_getSolution(highs, colvalue1, NULL, rowvalue1, NULL);
+    HighsInt i;
+    for (i = 0; i < 2; i++)
+      assertDoubleValuesEqual("Batch colvalue", colvalue[2 * iLp + i],
+			      colvalue1[i]);
+    for (i = 0; i < 3; i++)
+      assertDoubleValuesEqual("Batch rowvalue", rowvalue[3 * iLp + i],
+			      rowvalue1[i]);
+  }
+  assert( modelstatus[2] == 8 );
+  Highs_destroy(highs);
+}
+
+void* createLpCopy(const HighsInt numcol, const HighsInt numrow,
+		   const HighsInt numnz, const double* colcost,
+		   const double* collower, const double* colupper,
+		   const double* rowlower, const double* rowupper,
+		   const HighsInt* astart, const HighsInt* aindex,
+		   const double* avalue) {
+  // Create an LP with Highs_createLp and fill its arrays in place
+  double* lp_colcost;
+  double* lp_collower;
+  double* lp_colupper;
+  double* lp_rowlower;
+  double* lp_rowupper;
+  HighsInt* lp_astart;
+  HighsInt* lp_aindex;
+  double* lp_avalue;
+  void* lp = Highs_createLp(numcol, numrow, numnz, &lp_colcost, &lp_collower,
+			    &lp_colupper, &lp_rowlower, &lp_rowupper,
+			    &lp_astart, &lp_aindex, &lp_avalue);
+  HighsInt i;
+  for (i = 0; i < numcol; i++) {
+    lp_colcost[i] = colcost[i];
+    lp_collower[i] = collower[i];
+    lp_colupper[i] = colupper[i];
+    lp_astart[i] = astart[i];
+  }
+  for (i = 0; i < numrow; i++) {
+    lp_rowlower[i] = rowlower[i];
+    lp_rowupper[i] = rowupper[i];
+  }
+  for (i = 0; i < numnz; i++) {
+    lp_aindex[i] = aindex[i];
+    lp_avalue[i] = avalue[i];
+  }
+  return lp;
+}
+
+void test_passCreatedLp() {
+  // Fill the arrays of an LP created by HiGHS with the LP in
+  // full_api_lp, and check that passing it gives the same solution as
+  // passing copies of the arrays
+  HighsInt astart[2] = {0, 2};
+  HighsInt aindex[5] = {1, 2, 0, 1, 2};
+  double avalue[5] = {1.0, 2.0, 1.0, 2.0, 1.0};
+  double colcost[2] = {2.0, 3.0};
+  double collower[2] = {0.0, 1.0};
+  double colupper[2] = {3.0, 1.0e30};
+  double rowlower[3] = {-1.0e30, 10.0, 8.0};
+  double rowupper[3] = {6.0, 14.0, 1.0e30};
+  double colvalue[2];
+  double lp_colvalue[2];
+  HighsInt i;
+
+  void* highs = Highs_create();
+  if (!dev_run) Highs_setBoolOptionValue(highs, "output_flag", 0);
+  Highs_passLp(highs, 2, 3, 5, 1, 1, 0, colcost, collower, colupper,
+	       rowlower, rowupper, astart, aindex, avalue);
+  Highs_run(highs);
+  const double objective = Highs_getObjectiveValue(highs);
+  Highs_getSolution(highs, colvalue, NULL, NULL, NULL);
+
+  void* lp = createLpCopy(2, 3, 5, colcost, collower, colupper, rowlower,
+			  rowupper, astart, aindex, avalue);
+  assertIntValuesEqual("Pass created LP status",
+		       Highs_passCreatedLp(highs, lp, 1, 0), 0);
+  assertIntValuesEqual("Created LP number of nonzeros",
+		       Highs_getNumNz(highs), 5);
+  Highs_run(highs);
+  assertIntValuesEqual("Created LP model status",
+		       Highs_getModelStatus(highs), 7);
+  assertDoubleValuesEqual("Created LP objective", objective,
+			  Highs_getObjectiveValue(highs));
+  Highs_getSolution(highs, lp_colvalue, NULL, NULL, NULL);
+  for (i = 0; i < 2; i++)
+    assertDoubleValuesEqual("Created LP colvalue", colvalue[i],
+			    lp_colvalue[i]);
+
+  // As for Highs_passLp, any sense other than -1 means minimization,
+  // so min 2x_0 + x_1 s.t. x_0 + x_1 >= 3 has optimal objective 3. With
+  // presolve off, the simplex solver is given the LP's sense
+  HighsInt sense_astart[2] = {0, 1};
+  HighsInt sense_aindex[2] = {0, 0};
+  double sense_avalue[2] = {1.0, 1.0};
+  double sense_colcost[2] = {2.0, 1.0};
+  double sense_collower[2] = {0.0, 0.0};
+  double sense_colupper[2] = {1.0e30, 1.0e30};
+  double sense_rowlower[1] = {3.0};
+  double sense_rowupper[1] = {1.0e30};
+  Highs_setStringOptionValue(highs, "presolve", "off");
+  lp = createLpCopy(2, 1, 2, sense_colcost, sense_collower, sense_colupper,
+		    sense_rowlower, sense_rowupper, sense_astart, sense_aindex,
+		    sense_avalue);
+  assertIntValuesEqual("Pass created LP with sense 0 status",
+		       Highs_passCreatedLp(highs, lp, 0, 0), 0);
+  Highs_run(highs);
+  assertIntValuesEqual("Created LP with sense 0 model status",
+		       Highs_getModelStatus(highs), 7);
+  assertDoubleValuesEqual("Created LP with sense 0 objective", 3.0,
+			  Highs_getObjectiveValue(highs));
+
+  // An LP that isn't passed is destroyed by the caller
+  lp = createLpCopy(2, 3, 5, colcost, collower, colupper, rowlower,
+		    rowupper, astart, aindex, avalue);
+  Highs_destroyLp(lp);
+  Highs_destroy(highs);
+}
+
+HighsInt userCallbackInterrupt(const HighsInt callback_type,
+			       const HighsCallbackDataOut* data_out,
+			       void* user_callback_data) {
+  HighsInt* num_call = (HighsInt*)user_callback_data;
+  (*num_call)++;
+  return callback_type == kHighsCallbackSimplexRebuild;
+}
+
+void test_callback() {
+  // Interrupt the simplex solver for the LP in full_api_lp at its
+  // first rebuild
+  HighsInt astart[2] = {0, 2};
+  HighsInt aindex[5] = {1, 2, 0, 1, 2};
+  double avalue[5] = {1.0, 2.0, 1.0, 2.0, 1.0};
+  double colcost[2] = {2.0, 3.0};
+  double collower[2] = {0.0, 1.0};
+  double colupper[2] = {3.0, 1.0e30};
+  double rowlower[3] = {-1.0e30, 10.0, 8.0};
+  double rowupper[3] = {6.0, 14.0, 1.0e30};
+  HighsInt num_call = 0;
+
+  void* highs = Highs_create();
+  if (!dev_run) Highs_setBoolOptionValue(highs, "output_flag", 0);
+  Highs_setStringOptionValue(highs, "presolve", "off");
+  Highs_passLp(highs, 2, 3, 5, 1, 1, 0, colcost, collower, colupper,
+	       rowlower, rowupper, astart, aindex, avalue);
+  Highs_setCallback(highs, userCallbackInterrupt, &num_call);
+  assertIntValuesEqual("Interrupted run status", Highs_run(highs), 1);
+  assertIntValuesEqual("Interrupted model status",
+		       Highs_getModelStatus(highs), 16);
+  assertIntValuesEqual("Number of callbacks", num_call, 1);
+  Highs_setCallback(highs, NULL, NULL);
+  Highs_run(highs);
+  assertIntValuesEqual("Model status", Highs_getModelStatus(highs), 7);
+  assertIntValuesEqual("Number of callbacks", num_call, 1);
+  Highs_destroy(highs);
+}
+
 int main() {
   minimal_api();
   full_api();
@@ -672,5 +954,9 @@ int main() {
   full_api_qp();
   options();
   test_getColsByRange();
+  test_getBasisInverseRows();
+  test_solveBatch();
+  test_passCreatedLp();
+  test_callback();
   return 0;
 }
@@ -1,16 +1,31 @@
 #include <cstdio>
+#include <fstream>
 
 #include "Highs.h"
 #include "catch.hpp"
+#include "io/FilereaderBinary.h"
 #include "io/FilereaderEms.h"
 #include "io/HMPSIO.h"
 #include "io/HMpsFF.h"
 #include "io/HighsIO.h"
+#include "io/HighsInputStream.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsLpUtils.h"
 
 const bool dev_run = false;
 
+// Gives the first row an illegal basis status in a binary model or
+// solution file with a basis, where the row statuses are the final,
+// 8-byte aligned, section
+void setIllegalFirstRowStatus(const std::string filename,
+                              const HighsInt num_row) {
+  std::fstream f(filename, std::ios::in | std::ios::out | std::ios::binary);
+  f.seekp(0, std::ios::end);
+  const std::streamoff size = f.tellp();
+  f.seekp(size - ((num_row + 7) & ~7));
+  f.put((char)100);
+}
+
 TEST_CASE("filereader-edge-cases", "[highs_filereader]") {
   std::string model = "";
   std::string model_file;
@@ -206,3 +221,255 @@ TEST_CASE("filereader-integrality-constraints", "[highs_filereader]") {
   bool are_the_same = lp_free == lp_fixed;
   REQUIRE(are_the_same);
 }
+
+TEST_CASE("filereader-binary-snapshot", "[highs_filereader]") {
+  HighsStatus status;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+
+  // Check that a model with integrality and names is recovered exactly
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/small_mip.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::kOk);
+  HighsLp lp_mps = highs.getLp();
+
+  std::string filename_hbm = "small_mip.hbm";
+  status = highs.writeModel(filename_hbm);
+  REQUIRE(status == HighsStatus::kOk);
+  status = highs.readModel(filename_hbm);
+  REQUIRE(status == HighsStatus::kOk);
+  const bool are_the_same = lp_mps == highs.getLp();
+  REQUIRE(are_the_same);
+  std::remove(filename_hbm.c_str());
+
+  // Check that the optimal basis is saved with the model, so the
+  // snapshot is solved without simplex iterations
+  filename = std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::kOk);
+  status = highs.run();
+  REQUIRE(status == HighsStatus::kOk);
+  const double mps_objective_function_value = info.objective_function_value;
+
+  filename_hbm = "adlittle.hbm";
+  status = highs.writeModel(filename_hbm);
+  REQUIRE(status == HighsStatus::kOk);
+
+  Highs highs_hbm;
+  if (!dev_run) highs_hbm.setOptionValue("output_flag", false);
+  status = highs_hbm.readModel(filename_hbm);
+  REQUIRE(status == HighsStatus::kOk);
+  REQUIRE(highs_hbm.getBasis().valid);
+  status = highs_hbm.run();
+  REQUIRE(status == HighsStatus::kOk);
+  REQUIRE(highs_hbm.getInfo().simplex_iteration_count == 0);
+  REQUIRE(highs_hbm.getInfo().objective_function_value ==
+          mps_objective_function_value);
+
+  // Check that a snapshot with an illegal basis status is rejected
+  setIllegalFirstRowStatus(filename_hbm, highs.getNumRow());
+  status = highs_hbm.readModel(filename_hbm);
+  REQUIRE(status == HighsStatus::kError);
+  std::remove(filename_hbm.c_str());
+
+#ifdef __linux__
+  // Check that failing to write a snapshot is an error
+  FilereaderBinary writer;
+  REQUIRE(writer.writeModelAndBasisToFile(
+              highs.getOptions(), "/dev/full", highs.getModel(),
+              highs.getBasis()) == HighsStatus::kError);
+#endif
+
+  // Check that a file that isn't a snapshot is rejected
+  filename_hbm = "garbage.hbm";
+  FILE* file = fopen(filename_hbm.c_str(), "w");
+  fprintf(file, "Not a HiGHS binary model\n");
+  fclose(file);
+  status = highs_hbm.readModel(filename_hbm);
+  REQUIRE(status == HighsStatus::kError);
+  std::remove(filename_hbm.c_str());
+}
+
+TEST_CASE("filereader-compressed", "[highs_filereader]") {
+  HighsStatus status;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+
+  // Check that compressed MPS and LP files, read with both MPS parsers,
+  // give the same model as the uncompressed files
+  const std::vector<std::string> model_file = {"adlittle.mps", "adlittle.mps",
+                                               "qjh.lp"};
+  const std::vector<bool> mps_parser_type_free = {true, false, true};
+  for (HighsInt k = 0; k < (HighsInt)model_file.size(); k++) {
+    highs.setOptionValue("mps_parser_type_free", mps_parser_type_free[k]);
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_file[k];
+    status = highs.readModel(filename);
+    REQUIRE(status == HighsStatus::kOk);
+    HighsModel model = highs.getModel();
+
+    status = highs.readModel(filename + ".gz");
+    if (!canReadCompressedFile()) {
+      REQUIRE(status == HighsStatus::kError);
+      continue;
+    }
+    REQUIRE(status == HighsStatus::kOk);
+    HighsModel model_gz = highs.getModel();
+    const bool lp_the_same = model.lp_ == model_gz.lp_;
+    REQUIRE(lp_the_same);
+    const bool hessian_the_same = model.hessian_ == model_gz.hessian_;
+    REQUIRE(hessian_the_same);
+  }
+
+  // Check that a missing compressed file is reported
+  status = highs.readModel("missing.mps.gz");
+  REQUIRE(status == HighsStatus::kError);
+
+  // Check that model files are not written compressed
+  status = highs.writeModel("qjh.lp.gz");
+  REQUIRE(status == HighsStatus::kError);
+}
+
+TEST_CASE("filereader-lp-long-lines", "[highs_filereader]") {
+  // The LP reader has no limit on the length of a line
+  const HighsInt num_col = 1000;
+  std::string filename = "long_lines.lp";
+  FILE* file = fopen(filename.c_str(), "w");
+  fprintf(file, "max\n obj:");
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    fprintf(file, " + %d x%d", (int)(iCol % 7 + 1), (int)iCol);
+  fprintf(file, "\nst\n c0:");
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    fprintf(file, " + x%d", (int)iCol);
+  fprintf(file, " <= 1\nend\n");
+  fclose(file);
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  const HighsLp& lp = highs.getLp();
+  REQUIRE(lp.num_col_ == num_col);
+  REQUIRE(lp.num_row_ == 1);
+  REQUIRE(lp.a_start_[num_col] == num_col);
+  REQUIRE(lp.col_cost_[num_col - 1] == (num_col - 1) % 7 + 1);
+  REQUIRE(lp.col_names_[num_col - 1] == "x999");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getInfo().objective_function_value == 7);
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("filereader-write-exact", "[highs_filereader]") {
+  // Values written to MPS and LP files read back exactly
+  const double third = 1.0 / 3.0;
+  HighsLp lp;
+  lp.num_col_ = 3;
+  lp.num_row_ = 2;
+  lp.col_cost_ = {0.1 + 0.2, -third, 1.5};
+  lp.col_lower_ = {0, -2.5e-7, -kHighsInf};
+  lp.col_upper_ = {123456.789, kHighsInf, 1e20 / 3};
+  lp.row_lower_ = {-kHighsInf, 2 * third};
+  lp.row_upper_ = {4.000000000000001, 2 * third};
+  lp.a_start_ = {0, 2, 3, 4};
+  lp.a_index_ = {0, 1, 0, 1};
+  lp.a_value_ = {1e-8 / 3, 0.7, -1234.5678, 1e14 / 3};
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+
+  for (std::string filename : {"write_exact.mps", "write_exact.lp"}) {
+    REQUIRE(highs.writeModel(filename) != HighsStatus::kError);
+    Highs read_highs;
+    if (!dev_run) read_highs.setOptionValue("output_flag", false);
+    REQUIRE(read_highs.readModel(filename) == HighsStatus::kOk);
+    const HighsLp& read_lp = read_highs.getLp();
+    REQUIRE(read_lp.col_cost_ == lp.col_cost_);
+    REQUIRE(read_lp.col_lower_ == lp.col_lower_);
+    REQUIRE(read_lp.col_upper_ == lp.col_upper_);
+    REQUIRE(read_lp.row_lower_ == lp.row_lower_);
+    REQUIRE(read_lp.row_upper_ == lp.row_upper_);
+    REQUIRE(read_lp.a_value_ == lp.a_value_);
+    std::remove(filename.c_str());
+  }
+
+  // The Hessian of a QP is written to an LP file with the right scale
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/qjh.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double objective_function_value =
+      highs.getInfo().objective_function_value;
+  filename = "write_exact_qp.lp";
+  REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    objective_function_value) < 1e-8);
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("filereader-basis-solution-files", "[highs_filereader]") {
+  // Bases written as text and in binary, and binary solutions, are read
+  // back exactly
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsBasis basis = highs.getBasis();
+  const HighsSolution solution = highs.getSolution();
+  REQUIRE(highs.writeBasis("adlittle.bas") == HighsStatus::kOk);
+  REQUIRE(highs.writeBasis("adlittle_basis.hbs") == HighsStatus::kOk);
+  REQUIRE(highs.writeSolution("adlittle.hbs") == HighsStatus::kOk);
+
+  for (std::string basis_file : {"adlittle.bas", "adlittle_basis.hbs"}) {
+    Highs read_highs;
+    if (!dev_run) read_highs.setOptionValue("output_flag", false);
+    REQUIRE(read_highs.readModel(model_file) == HighsStatus::kOk);
+    REQUIRE(read_highs.readBasis(basis_file) == HighsStatus::kOk);
+    REQUIRE(read_highs.getBasis().col_status == basis.col_status);
+    REQUIRE(read_highs.getBasis().row_status == basis.row_status);
+    REQUIRE(read_highs.run() == HighsStatus::kOk);
+    REQUIRE(read_highs.getInfo().simplex_iteration_count == 0);
+  }
+
+  Highs read_highs;
+  if (!dev_run) read_highs.setOptionValue("output_flag", false);
+  REQUIRE(read_highs.readModel(model_file) == HighsStatus::kOk);
+  // Solutions are only read from binary files
+  REQUIRE(read_highs.readSolution("adlittle.bas") == HighsStatus::kError);
+  REQUIRE(read_highs.readSolution("adlittle.hbs") == HighsStatus::kOk);
+  const HighsSolution& read_solution = read_highs.getSolution();
+  REQUIRE(read_solution.value_valid);
+  REQUIRE(read_solution.dual_valid);
+  REQUIRE(read_solution.col_value == solution.col_value);
+  REQUIRE(read_solution.row_value == solution.row_value);
+  REQUIRE(read_solution.col_dual == solution.col_dual);
+  REQUIRE(read_solution.row_dual == solution.row_dual);
+  REQUIRE(read_highs.getBasis().col_status == basis.col_status);
+
+  // A solution file is only read for a model of the same size
+  REQUIRE(read_highs.readModel(std::string(HIGHS_DIR) +
+                               "/check/instances/afiro.mps") ==
+          HighsStatus::kOk);
+  REQUIRE(read_highs.readSolution("adlittle.hbs") == HighsStatus::kError);
+  REQUIRE(read_highs.readBasis("adlittle_basis.hbs") == HighsStatus::kError);
+
+  // A binary solution with an illegal basis status is rejected
+  setIllegalFirstRowStatus("adlittle.hbs", highs.getNumRow());
+  REQUIRE(highs.readSolution("adlittle.hbs") == HighsStatus::kError);
+
+#ifdef __linux__
+  // Failing to write a text solution file is an error
+  REQUIRE(highs.writeSolution("/dev/full") == HighsStatus::kError);
+  REQUIRE(writeBinarySolutionFile(highs.getOptions().log_options,
+                                  "/dev/full", highs.getNumCol(),
+                                  highs.getNumRow(), highs.getSolution(),
+                                  highs.getBasis()) == HighsStatus::kError);
+#endif
+
+  std::remove("adlittle.bas");
+  std::remove("adlittle_basis.hbs");
+  std::remove("adlittle.hbs");
+}
@@ -1,5 +1,8 @@
 #include <cstdio>
 #include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "HighsIO.h"
 #include "catch.hpp"
@@ -30,7 +33,8 @@ TEST_CASE("msgcb", "[highs_io]") {
   log_options.output_flag = &output_flag;
   log_options.log_to_console = &log_to_console;
   log_options.log_dev_level = &log_dev_level;
-  highsSetLogCallback(myprintmsgcb, mylogmsgcb, (void*)&dummydata);
+  highsSetLogCallback(log_options, myprintmsgcb, mylogmsgcb,
+                      (void*)&dummydata);
 
   highsLogDev(log_options, HighsLogType::kInfo, "Hi %s!", "HiGHS");
   REQUIRE(strcmp(printedmsg, "Hi HiGHS!") == 0);
@@ -67,3 +71,49 @@ TEST_CASE("msgcb", "[highs_io]") {
     REQUIRE(strlen(printedmsg) <= sizeof(printedmsg));
   }
 }
+
+struct ThreadLog {
+  HighsInt num_message = 0;
+  HighsInt num_foreign_message = 0;
+  std::string tag;
+};
+
+static void threadlogmsgcb(HighsLogType type, const char* msg,
+                           void* msgcb_data) {
+  ThreadLog* thread_log = (ThreadLog*)msgcb_data;
+  thread_log->num_message++;
+  if (strstr(msg, thread_log->tag.c_str()) == NULL)
+    thread_log->num_foreign_message++;
+}
+
+TEST_CASE("msgcb-per-instance", "[highs_io]") {
+  // Log options on different threads have their own callbacks, so each
+  // receives only its own messages
+  const HighsInt num_thread = 4;
+  const HighsInt num_message = 1000;
+  std::vector<ThreadLog> thread_log(num_thread);
+  std::vector<std::thread> threads;
+  for (HighsInt i = 0; i < num_thread; i++) {
+    thread_log[i].tag = "thread " + std::to_string(i) + " ";
+    threads.emplace_back([&thread_log, i]() {
+      bool output_flag = true;
+      bool log_to_console = true;
+      HighsInt log_dev_level = kHighsLogDevLevelNone;
+      HighsLogOptions log_options;
+      log_options.log_file_stream = NULL;
+      log_options.output_flag = &output_flag;
+      log_options.log_to_console = &log_to_console;
+      log_options.log_dev_level = &log_dev_level;
+      highsSetLogCallback(log_options, NULL, threadlogmsgcb,
+                          (void*)&thread_log[i]);
+      for (HighsInt k = 0; k < num_message; k++)
+        highsLogUser(log_options, HighsLogType::kInfo, "%s%d\n",
+                     thread_log[i].tag.c_str(), (int)k);
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  for (HighsInt i = 0; i < num_thread; i++) {
+    REQUIRE(thread_log[i].num_message == num_message);
+    REQUIRE(thread_log[i].num_foreign_message == 0);
+  }
+}
@@ -1255,3 +1255,71 @@ TEST_CASE("LP-interval-changes", "[highs_data]") {
   REQUIRE(optimal_objective_function_value ==
           avgas_optimal_objective_function_value);
 }
+
+TEST_CASE("LP-add-rows-incrementally", "[highs_data]") {
+  // Add copies of the rows of AVGAS after solving it, first all of them
+  // one at a time, and then one before each re-solve, as when cuts are
+  // added by the MIP solver. The rows added should be read back
+  // unchanged, and duplicating rows doesn't change the optimal
+  // objective
+  Highs highs;
+  const HighsInfo& info = highs.getInfo();
+  highs.setOptionValue("output_flag", dev_run);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/avgas.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double avgas_optimal_objective_function_value =
+      info.objective_function_value;
+
+  const HighsInt num_row = highs.getNumRow();
+  const HighsInt num_nz = highs.getNumNz();
+  HighsInt get_num_row;
+  HighsInt get_num_nz;
+  std::vector<double> lower(num_row);
+  std::vector<double> upper(num_row);
+  std::vector<HighsInt> start(num_row + 1);
+  std::vector<HighsInt> index(num_nz);
+  std::vector<double> value(num_nz);
+  REQUIRE(highs.getRows(0, num_row - 1, get_num_row, &lower[0], &upper[0],
+                        get_num_nz, &start[0], &index[0],
+                        &value[0]) == HighsStatus::kOk);
+  start[num_row] = get_num_nz;
+  auto checkAddedRows = [&](const HighsInt from_row) {
+    std::vector<double> get_lower(num_row);
+    std::vector<double> get_upper(num_row);
+    std::vector<HighsInt> get_start(num_row + 1);
+    std::vector<HighsInt> get_index(num_nz);
+    std::vector<double> get_value(num_nz);
+    REQUIRE(highs.getRows(from_row, from_row + num_row - 1, get_num_row,
+                          &get_lower[0], &get_upper[0], get_num_nz,
+                          &get_start[0], &get_index[0],
+                          &get_value[0]) == HighsStatus::kOk);
+    get_start[num_row] = get_num_nz;
+    REQUIRE(get_lower == lower);
+    REQUIRE(get_upper == upper);
+    REQUIRE(get_start == start);
+    REQUIRE(get_index == index);
+    REQUIRE(get_value == value);
+  };
+  auto addRow = [&](const HighsInt iRow) {
+    REQUIRE(highs.addRow(lower[iRow], upper[iRow],
+                         start[iRow + 1] - start[iRow], &index[start[iRow]],
+                         &value[start[iRow]]) == HighsStatus::kOk);
+  };
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) addRow(iRow);
+  REQUIRE(highs.getNumRow() == 2 * num_row);
+  checkAddedRows(num_row);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(fabs(info.objective_function_value -
+               avgas_optimal_objective_function_value) < 1e-10);
+
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    addRow(iRow);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(fabs(info.objective_function_value -
+                 avgas_optimal_objective_function_value) < 1e-10);
+  }
+  REQUIRE(highs.getNumRow() == 3 * num_row);
+  checkAddedRows(2 * num_row);
+}
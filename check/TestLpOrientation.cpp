@@ -113,5 +113,55 @@ TEST_CASE("LP-orientation", "[lp_orientation]") {
   highs.run();
   REQUIRE(info.objective_function_value == optimal_objective_function_value);
 
+  // Pass the row-wise arrays, and check that the columns are read
+  // back as those of AVGAS
+  highs.clearModel();
+  REQUIRE(highs.passModel(num_col, num_row, num_row_nz,
+                          (HighsInt)MatrixFormat::kRowwise,
+                          (HighsInt)ObjSense::kMinimize, 0, &colCost[0],
+                          &colLower[0], &colUpper[0], &rowLower[0],
+                          &rowUpper[0], &ARstart[0], &ARindex[0],
+                          &ARvalue[0]) == HighsStatus::kOk);
+  HighsInt get_num_col;
+  HighsInt get_num_nz;
+  vector<double> get_cost(num_col);
+  vector<double> get_lower(num_col);
+  vector<double> get_upper(num_col);
+  vector<HighsInt> get_start(num_col + 1);
+  vector<HighsInt> get_index(num_col_nz);
+  vector<double> get_value(num_col_nz);
+  REQUIRE(highs.getCols(0, num_col - 1, get_num_col, &get_cost[0],
+                        &get_lower[0], &get_upper[0], get_num_nz,
+                        &get_start[0], &get_index[0],
+                        &get_value[0]) == HighsStatus::kOk);
+  get_start[num_col] = get_num_nz;
+  REQUIRE(get_num_col == num_col);
+  REQUIRE(get_cost == colCost);
+  REQUIRE(get_lower == colLower);
+  REQUIRE(get_upper == colUpper);
+  REQUIRE(get_start == Astart);
+  REQUIRE(get_index == Aindex);
+  REQUIRE(get_value == Avalue);
+  highs.run();
+  REQUIRE(info.objective_function_value == optimal_objective_function_value);
+
+  // Hand the external LP to HiGHS without copying it
+  highs.clearModel();
+  REQUIRE(highs.passModel(std::move(lp)) == HighsStatus::kOk);
+  REQUIRE(highs.getNumCol() == num_col);
+  REQUIRE(highs.getNumRow() == num_row);
+  REQUIRE(highs.getNumNz() == num_col_nz);
+  highs.run();
+  REQUIRE(info.objective_function_value == optimal_objective_function_value);
+
+  // Row-wise arrays with an illegal column index are still rejected
+  ARindex[0] = num_col;
+  REQUIRE(highs.passModel(num_col, num_row, num_row_nz,
+                          (HighsInt)MatrixFormat::kRowwise,
+                          (HighsInt)ObjSense::kMinimize, 0, &colCost[0],
+                          &colLower[0], &colUpper[0], &rowLower[0],
+                          &rowUpper[0], &ARstart[0], &ARindex[0],
+                          &ARvalue[0]) == HighsStatus::kError);
+
   //  return_status = highs.writeModel("");
 }
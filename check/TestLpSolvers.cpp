@@ -1,5 +1,8 @@
 #include "Highs.h"
 #include "catch.hpp"
+#ifdef OPENMP
+#include "omp.h"
+#endif
 
 const bool dev_run = false;
 
@@ -429,3 +432,270 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-14);
 }
+
+// Solves the LP with its basis reset, so that the simplex solver starts
+// from a logical basis, or a crash basis if simplex_crash_strategy is
+// set, and checks that the optimal objective is the one given
+static void solveFromNewBasis(Highs& highs, const double objective,
+                              const double tolerance) {
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.setBasis() == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double error =
+      fabs((info.objective_function_value - objective) / objective);
+  if (dev_run)
+    printf("\n%d iterations; optimal objective value error = %g\n",
+           (int)info.simplex_iteration_count, error);
+  REQUIRE(error < tolerance);
+}
+
+// Records the simplex iteration count at each rebuild
+static HighsInt userCallbackRebuild(const HighsInt callback_type,
+                                    const HighsCallbackDataOut* data_out,
+                                    void* user_callback_data) {
+  if (callback_type == kHighsCallbackSimplexRebuild)
+    ((std::vector<HighsInt>*)user_callback_data)
+        ->push_back(data_out->simplex_iteration_count);
+  return 0;
+}
+
+TEST_CASE("simplex-reinversion-strategy", "[highs_lp_solver]") {
+  // Check that reinverting according to the growth in solve cost
+  // rebuilds at different iterations from the synthetic clock, and
+  // yields the same optimal objective
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.setOptionValue("presolve", "off") == HighsStatus::kOk);
+  std::vector<HighsInt> rebuild_iteration;
+  highs.setCallback(userCallbackRebuild, &rebuild_iteration);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double synthetic_clock_objective = info.objective_function_value;
+  const std::vector<HighsInt> synthetic_clock_rebuild_iteration =
+      rebuild_iteration;
+
+  REQUIRE(highs.setOptionValue("simplex_reinversion_strategy",
+                               kSimplexReinversionStrategyAdaptive) ==
+          HighsStatus::kOk);
+  rebuild_iteration.clear();
+  solveFromNewBasis(highs, synthetic_clock_objective, 1e-12);
+  if (dev_run)
+    printf("Rebuilds: %d with the synthetic clock and %d adaptively\n",
+           (int)synthetic_clock_rebuild_iteration.size(),
+           (int)rebuild_iteration.size());
+  const bool same_rebuild_iteration =
+      rebuild_iteration == synthetic_clock_rebuild_iteration;
+  REQUIRE(!same_rebuild_iteration);
+}
+
+TEST_CASE("simplex-crash-strategy", "[highs_lp_solver]") {
+  // Check that each crash makes structurals basic in the starting
+  // basis, and that solving from it yields the same optimal objective
+  // as solving from a logical basis
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  const HighsBasis& basis = highs.getBasis();
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.setOptionValue("presolve", "off") == HighsStatus::kOk);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double logical_basis_objective = info.objective_function_value;
+
+  std::vector<HighsInt> crash_strategy = {
+      kSimplexCrashStrategyLtssfK, kSimplexCrashStrategyBixby,
+      kSimplexCrashStrategyLtssfPri, kSimplexCrashStrategyLtsfK,
+      kSimplexCrashStrategyLtsfPri, kSimplexCrashStrategyLtsf};
+  for (HighsInt strategy : crash_strategy) {
+    REQUIRE(highs.setOptionValue("simplex_crash_strategy", strategy) ==
+            HighsStatus::kOk);
+    // With no iterations allowed, the basis returned is the crash basis
+    REQUIRE(highs.setOptionValue("simplex_iteration_limit", 0) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.setBasis() == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kWarning);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+    REQUIRE(basis.valid);
+    HighsInt num_basic_structurals = 0;
+    for (HighsInt iCol = 0; iCol < highs.getLp().num_col_; iCol++)
+      if (basis.col_status[iCol] == HighsBasisStatus::kBasic)
+        num_basic_structurals++;
+    if (dev_run)
+      printf("\nCrash %d: %d structurals basic\n", (int)strategy,
+             (int)num_basic_structurals);
+    REQUIRE(num_basic_structurals > 0);
+
+    REQUIRE(highs.setOptionValue("simplex_iteration_limit", kHighsIInf) ==
+            HighsStatus::kOk);
+    solveFromNewBasis(highs, logical_basis_objective, 1e-10);
+  }
+}
+
+TEST_CASE("LP-solve-batch", "[highs_lp_solver]") {
+  // Solve variants of small LPs as a batch, and check that the results
+  // are those obtained by solving them one at a time
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::vector<HighsLp> lps;
+  for (std::string model : {"afiro", "adlittle", "blending", "scrs8"}) {
+    std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    HighsLp lp = highs.getLp();
+    for (HighsInt variant = 0; variant < 4; variant++) {
+      for (HighsInt iCol = variant; iCol < lp.num_col_; iCol += 4)
+        lp.col_cost_[iCol] += 0.5;
+      lps.push_back(lp);
+    }
+  }
+  // Make one LP infeasible
+  lps[1].col_lower_[0] = 1;
+  lps[1].col_upper_[0] = 0;
+  REQUIRE(highs.clearModel() == HighsStatus::kOk);
+
+  std::vector<HighsModelStatus> model_status;
+  std::vector<HighsSolution> solution;
+  std::vector<double> objective_function_value;
+  REQUIRE(highs.solveBatch(lps, model_status, solution,
+                           objective_function_value) != HighsStatus::kError);
+  REQUIRE(highs.getLp().num_col_ == 0);
+  REQUIRE(model_status.size() == lps.size());
+
+  const HighsInfo& info = highs.getInfo();
+  for (HighsInt iLp = 0; iLp < (HighsInt)lps.size(); iLp++) {
+    highs.passModel(lps[iLp]);
+    highs.run();
+    REQUIRE(model_status[iLp] == highs.getModelStatus());
+    if (model_status[iLp] != HighsModelStatus::kOptimal) continue;
+    REQUIRE(objective_function_value[iLp] == info.objective_function_value);
+    REQUIRE(solution[iLp].col_value == highs.getSolution().col_value);
+    REQUIRE(solution[iLp].row_dual == highs.getSolution().row_dual);
+  }
+  REQUIRE(model_status[1] != HighsModelStatus::kOptimal);
+}
+
+// Counts the calls to the user callback, and requests an interrupt
+// once there have been interrupt_after of them
+struct CallbackCount {
+  HighsInt num_call;
+  HighsInt interrupt_after;
+  HighsInt last_type;
+};
+
+static HighsInt userCallbackCount(const HighsInt callback_type,
+                                  const HighsCallbackDataOut* data_out,
+                                  void* user_callback_data) {
+  CallbackCount& count = *(CallbackCount*)user_callback_data;
+  count.num_call++;
+  count.last_type = callback_type;
+  if (dev_run)
+    printf("Callback %d: time %g; iterations %d/%d; objective %g\n",
+           (int)callback_type, data_out->running_time,
+           (int)data_out->simplex_iteration_count,
+           (int)data_out->ipm_iteration_count,
+           data_out->objective_function_value);
+  return count.num_call >= count.interrupt_after;
+}
+
+TEST_CASE("LP-callback", "[highs_lp_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  const HighsInfo& info = highs.getInfo();
+
+  // A callback that never interrupts sees each rebuild, without
+  // changing the solve
+  CallbackCount count = {0, kHighsIInf, -1};
+  highs.setCallback(userCallbackCount, &count);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(count.num_call > 0);
+  REQUIRE(count.last_type == kHighsCallbackSimplexRebuild);
+
+  // Interrupt the simplex solver at its second rebuild
+  count = {0, 2, -1};
+  REQUIRE(highs.setBasis() == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(count.num_call == 2);
+
+  // Interrupt IPM after its third iteration
+  count = {0, 3, -1};
+  highs.setOptionValue("solver", "ipm");
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(count.last_type == kHighsCallbackIpmIteration);
+  REQUIRE(info.ipm_iteration_count == 3);
+
+  // With no callback the solve is not interrupted
+  highs.setCallback(NULL, NULL);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+}
+
+TEST_CASE("primal-simplex-threads", "[highs_lp_solver]") {
+  // Check that the primal simplex solver takes the same iterations to
+  // the same optimum with one thread and with several, on an LP large
+  // enough for CHUZC and PRICE to be partitioned
+  const HighsInt num_row = 1000;
+  const HighsInt num_col_per_row = 50;
+  HighsLp lp;
+  lp.num_col_ = num_row * num_col_per_row;
+  lp.num_row_ = num_row;
+  lp.col_lower_.assign(lp.num_col_, 0);
+  lp.col_upper_.assign(lp.num_col_, 1);
+  lp.row_lower_.assign(num_row, -kHighsInf);
+  lp.row_upper_.assign(num_row, 0);
+  lp.a_start_.push_back(0);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    const HighsInt iRow = iCol / num_col_per_row;
+    lp.col_cost_.push_back(-1 - (iCol % 7) * 0.1);
+    lp.row_upper_[iRow] += 1 + (iCol % 3) * 0.01;
+    lp.a_index_.push_back(iRow);
+    lp.a_value_.push_back(1 + (iCol % 11) * 0.5);
+    lp.a_start_.push_back(lp.a_index_.size());
+  }
+  REQUIRE(lp.num_col_ + lp.num_row_ >= kMinParallelChuzcCount);
+  REQUIRE(lp.num_col_ >= kMinParallelPriceCount);
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", "off");
+  highs.setOptionValue("simplex_strategy", kSimplexStrategyPrimal);
+#ifdef OPENMP
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+#endif
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const HighsInt serial_iteration_count = info.simplex_iteration_count;
+  const double serial_objective = info.objective_function_value;
+
+#ifdef OPENMP
+  omp_set_num_threads(4);
+#endif
+  REQUIRE(highs.setBasis() == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+#ifdef OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  if (dev_run)
+    printf("\nPrimal simplex: %d iterations serially and %d in parallel\n",
+           (int)serial_iteration_count, (int)info.simplex_iteration_count);
+  REQUIRE(info.simplex_iteration_count == serial_iteration_count);
+  REQUIRE(info.objective_function_value == serial_objective);
+}
@@ -1,6 +1,10 @@
 #include "Highs.h"
 #include "catch.hpp"
 #include "lp_data/HConst.h"
+#include "presolve/HighsSymmetry.h"
+#ifdef OPENMP
+#include "omp.h"
+#endif
 
 const double inf = kHighsInf;
 const bool dev_run = false;
@@ -242,3 +246,96 @@ TEST_CASE("MIP-od", "[highs_test_mip_solver]") {
   REQUIRE(fabs(solution.col_value[0] - required_x0_value) <
           double_equal_tolerance);
 }
+
+static HighsInt userCallbackMip(const HighsInt callback_type,
+                                const HighsCallbackDataOut* data_out,
+                                void* user_callback_data) {
+  // Interrupt at the first improving solution, recording its bounds
+  if (callback_type != kHighsCallbackMipImprovingSolution) return 0;
+  *(HighsCallbackDataOut*)user_callback_data = *data_out;
+  return 1;
+}
+
+TEST_CASE("MIP-callback", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  HighsCallbackDataOut data_out = {};
+  highs.setCallback(userCallbackMip, &data_out);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(data_out.mip_primal_bound < inf);
+  REQUIRE(data_out.mip_dual_bound <= data_out.mip_primal_bound);
+  // The gap is a percentage, as in HighsInfo
+  const double mip_gap =
+      100 * (data_out.mip_primal_bound - data_out.mip_dual_bound) /
+      std::max(1.0, std::abs(data_out.mip_primal_bound));
+  REQUIRE(data_out.mip_gap >= 0);
+  REQUIRE(fabs(data_out.mip_gap - mip_gap) < 1e-12);
+  REQUIRE(highs.getInfo().mip_dual_bound <= data_out.mip_primal_bound);
+}
+
+static void detectSymmetries(const HighsLp& lp, const int num_threads,
+                             HighsSymmetries& symmetries) {
+#ifdef OPENMP
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(num_threads);
+#endif
+  HighsSymmetryDetection symmetry_detection;
+  symmetry_detection.loadModelAsGraph(lp, 1e-9);
+  symmetry_detection.run(symmetries);
+#ifdef OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+}
+
+TEST_CASE("MIP-symmetry-threads", "[highs_test_mip_solver]") {
+  // Check that symmetry detection finds the same generators with one
+  // thread and with several, on a model whose columns form a cell large
+  // enough (at least 4096) for its hash values to be gathered in
+  // parallel
+  const HighsInt num_row = 100;
+  const HighsInt num_col_per_row = 50;
+  HighsLp lp;
+  lp.num_col_ = num_row * num_col_per_row;
+  lp.num_row_ = num_row;
+  lp.col_cost_.assign(lp.num_col_, -1);
+  lp.col_lower_.assign(lp.num_col_, 0);
+  lp.col_upper_.assign(lp.num_col_, 1);
+  lp.integrality_.assign(lp.num_col_, HighsVarType::kInteger);
+  lp.row_lower_.assign(num_row, -inf);
+  lp.row_upper_.assign(num_row, 3);
+  lp.a_start_.push_back(0);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    lp.a_index_.push_back(iCol / num_col_per_row);
+    lp.a_value_.push_back(2);
+    lp.a_start_.push_back(lp.a_index_.size());
+  }
+
+  HighsSymmetries serial_symmetries;
+  detectSymmetries(lp, 1, serial_symmetries);
+  HighsSymmetries parallel_symmetries;
+  detectSymmetries(lp, 4, parallel_symmetries);
+  if (dev_run)
+    printf("Found %d generators, %d permutations and %d orbitopes\n",
+           (int)serial_symmetries.numGenerators,
+           (int)serial_symmetries.numPerms,
+           (int)serial_symmetries.orbitopes.size());
+  REQUIRE(serial_symmetries.numGenerators > 0);
+  REQUIRE(parallel_symmetries.numGenerators ==
+          serial_symmetries.numGenerators);
+  REQUIRE(parallel_symmetries.numPerms == serial_symmetries.numPerms);
+  // Compare the vectors as bools, so that Catch doesn't print them
+  bool equal =
+      parallel_symmetries.permutations == serial_symmetries.permutations;
+  REQUIRE(equal);
+  equal = parallel_symmetries.permutationColumns ==
+          serial_symmetries.permutationColumns;
+  REQUIRE(equal);
+  equal =
+      parallel_symmetries.columnPosition == serial_symmetries.columnPosition;
+  REQUIRE(equal);
+  REQUIRE(parallel_symmetries.orbitopes.size() ==
+          serial_symmetries.orbitopes.size());
+}
@@ -94,6 +94,158 @@ TEST_CASE("qpsolver", "[qpsolver]") {
   REQUIRE(fabs(solution.col_value[2] - required_x2) < double_equal_tolerance);
 }
 
+TEST_CASE("qpsolver-ipm", "[qpsolver]") {
+  // Solve the QP test instances with the interior point method and
+  // compare with the known optimal solutions
+  const double ipm_tolerance = 1e-6;
+  Highs highs;
+  const HighsInfo& info = highs.getInfo();
+  const HighsSolution& solution = highs.getSolution();
+  const double& objective_function_value = info.objective_function_value;
+
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("solver", "ipm");
+
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/qptestnw.lp";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(info.ipm_iteration_count > 0);
+  REQUIRE(info.qp_iteration_count == 0);
+  REQUIRE(fabs(objective_function_value + 6.45) < ipm_tolerance);
+  REQUIRE(fabs(solution.col_value[0] - 1.4) < ipm_tolerance);
+  REQUIRE(fabs(solution.col_value[1] - 1.7) < ipm_tolerance);
+
+  filename = std::string(HIGHS_DIR) + "/check/instances/qjh.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(objective_function_value + 5.25) < ipm_tolerance);
+  REQUIRE(fabs(solution.col_value[0] - 0.5) < ipm_tolerance);
+  REQUIRE(fabs(solution.col_value[1] - 5.0) < ipm_tolerance);
+  REQUIRE(fabs(solution.col_value[2] - 1.5) < ipm_tolerance);
+
+  // minimize x^2 + y^2 + y subject to x + y >= 3 and x, y <= 1, which is
+  // infeasible
+  HighsModel model;
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = 2;
+  lp.num_row_ = 1;
+  lp.col_cost_ = {0.0, 1.0};
+  lp.col_lower_ = {-kHighsInf, -kHighsInf};
+  lp.col_upper_ = {1.0, 1.0};
+  lp.row_lower_ = {3.0};
+  lp.row_upper_ = {kHighsInf};
+  lp.a_start_ = {0, 1, 2};
+  lp.a_index_ = {0, 0};
+  lp.a_value_ = {1.0, 1.0};
+  HighsHessian& hessian = model.hessian_;
+  hessian.dim_ = 2;
+  hessian.q_start_ = {0, 1, 2};
+  hessian.q_index_ = {0, 1};
+  hessian.q_value_ = {2.0, 2.0};
+  REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+
+  // minimize (x + y)^2 / 2 - x subject to x + y >= 3, which is unbounded
+  // along (1, -1)
+  lp.col_upper_ = {kHighsInf, kHighsInf};
+  lp.col_cost_ = {-1.0, 0.0};
+  hessian.q_start_ = {0, 2, 3};
+  hessian.q_index_ = {0, 1, 1};
+  hessian.q_value_ = {1.0, 1.0, 1.0};
+  REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kUnbounded);
+}
+
+TEST_CASE("qpsolver-hotstart", "[qpsolver]") {
+  Highs highs;
+  const HighsInfo& info = highs.getInfo();
+  const double& objective_function_value = info.objective_function_value;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/qjh.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  // The active set is not a simplex basis
+  REQUIRE(!highs.getBasis().valid);
+  REQUIRE(highs.getQpActiveSet().valid);
+  const HighsInt cold_iteration_count = info.qp_iteration_count;
+
+  // Solving again without a hot start repeats the cold solve
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(info.qp_iteration_count == cold_iteration_count);
+
+  // Solving again from the optimal active set
+  HighsBasis active_set = highs.getQpActiveSet();
+  std::vector<double> col_value = highs.getSolution().col_value;
+  REQUIRE(highs.setQpHotStart(active_set, col_value) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(objective_function_value + 5.25) < double_equal_tolerance);
+  REQUIRE(info.qp_iteration_count <= cold_iteration_count);
+
+  // Change a cost and compare the hot started solve with a cold solve
+  active_set = highs.getQpActiveSet();
+  col_value = highs.getSolution().col_value;
+  REQUIRE(highs.changeColCost(0, 1.5) == HighsStatus::kOk);
+  REQUIRE(highs.setQpHotStart(active_set, col_value) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double hot_objective_function_value = objective_function_value;
+
+  Highs cold_highs;
+  if (!dev_run) cold_highs.setOptionValue("output_flag", false);
+  REQUIRE(cold_highs.passModel(highs.getModel()) == HighsStatus::kOk);
+  REQUIRE(cold_highs.run() == HighsStatus::kOk);
+  REQUIRE(cold_highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(hot_objective_function_value -
+               cold_highs.getInfo().objective_function_value) <
+          double_equal_tolerance);
+
+  // An active set of the wrong size is rejected
+  active_set.col_status.pop_back();
+  REQUIRE(highs.setQpHotStart(active_set, col_value) == HighsStatus::kError);
+}
+
+TEST_CASE("qpsolver-drop-upper", "[qpsolver]") {
+  // minimize 0.5(x^2 + y^2) + x + y subject to x + y >= -10 and x, y <= 0,
+  // for which the crash start has both variables at their upper bounds, so
+  // the solver must drop bounds that are active at their upper bounds
+  HighsModel model;
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = 2;
+  lp.num_row_ = 1;
+  lp.col_cost_ = {1.0, 1.0};
+  lp.col_lower_ = {-kHighsInf, -kHighsInf};
+  lp.col_upper_ = {0.0, 0.0};
+  lp.row_lower_ = {-10.0};
+  lp.row_upper_ = {kHighsInf};
+  lp.a_start_ = {0, 1, 2};
+  lp.a_index_ = {0, 0};
+  lp.a_value_ = {1.0, 1.0};
+  HighsHessian& hessian = model.hessian_;
+  hessian.dim_ = 2;
+  hessian.q_start_ = {0, 1, 2};
+  hessian.q_index_ = {0, 1};
+  hessian.q_value_ = {1.0, 1.0};
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(highs.getInfo().objective_function_value + 1.0) <
+          double_equal_tolerance);
+  const std::vector<double>& col_value = highs.getSolution().col_value;
+  REQUIRE(fabs(col_value[0] + 1.0) < double_equal_tolerance);
+  REQUIRE(fabs(col_value[1] + 1.0) < double_equal_tolerance);
+}
+
 TEST_CASE("test-qod", "[qpsolver]") {
   HighsStatus return_status;
   HighsModelStatus model_status;
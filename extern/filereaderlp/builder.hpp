@@ -1,23 +1,68 @@
 #ifndef __READERLP_BUILDER_HPP__
 #define __READERLP_BUILDER_HPP__
 
-#include <map>
-#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include "model.hpp"
 
-struct Builder { 
-   std::map<std::string, std::shared_ptr<Variable>> variables; 
+const unsigned int LP_NO_VARIABLE = std::numeric_limits<unsigned int>::max();
 
+struct Builder {
    Model model;
 
-   std::shared_ptr<Variable> getvarbyname(std::string name) {
-      if (variables.count(name) == 0) {
-         variables[name] = std::shared_ptr<Variable>(new Variable(name));
-         model.variables.push_back(variables[name]);
+   // open addressing hash table of variable indices, keyed by the
+   // variable names held in the model
+   std::vector<unsigned int> table;
+
+   static uint64_t hashname(const char* name, size_t length) {
+      // FNV-1a
+      uint64_t hash = 14695981039346656037ull;
+      for (size_t i = 0; i < length; i++) {
+         hash ^= (unsigned char)name[i];
+         hash *= 1099511628211ull;
+      }
+      return hash;
+   }
+
+   bool isvariablename(unsigned int var, const std::string& name) const {
+      size_t start = model.variablenamestart[var];
+      size_t length = model.variablenamestart[var+1] - start;
+      return length == name.size() && memcmp(model.variablenames.data() + start, name.data(), length) == 0;
+   }
+
+   void rehash(size_t size) {
+      table.assign(size, LP_NO_VARIABLE);
+      size_t mask = size - 1;
+      for (unsigned int var = 0; var < model.numvariables(); var++) {
+         size_t start = model.variablenamestart[var];
+         size_t length = model.variablenamestart[var+1] - start;
+         size_t slot = hashname(model.variablenames.data() + start, length) & mask;
+         while (table[slot] != LP_NO_VARIABLE) {
+            slot = (slot + 1) & mask;
+         }
+         table[slot] = var;
+      }
+   }
+
+   unsigned int getvarbyname(const std::string& name) {
+      // keep the table at most half full
+      if (2 * (model.numvariables() + 1) > table.size()) {
+         rehash(table.empty() ? 1024 : 2 * table.size());
+      }
+      size_t mask = table.size() - 1;
+      size_t slot = hashname(name.data(), name.size()) & mask;
+      while (table[slot] != LP_NO_VARIABLE) {
+         if (isvariablename(table[slot], name)) {
+            return table[slot];
+         }
+         slot = (slot + 1) & mask;
       }
-      return variables[name];
+      table[slot] = model.addvariable(name);
+      return table[slot];
    }
 };
 
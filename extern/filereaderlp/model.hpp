@@ -2,7 +2,6 @@
 #define __READERLP_MODEL_HPP__
 
 #include <limits>
-#include <memory>
 #include <string>
 #include <vector>
 
@@ -18,46 +17,69 @@ enum class ObjectiveSense {
    MAX
 };
 
-struct Variable {
-   VariableType type = VariableType::CONTINUOUS;
-   double lowerbound = 0.0;
-   double upperbound = std::numeric_limits<double>::infinity();
-   std::string name;
-
-   Variable(std::string n="") : name(n) {};
-};
-
 struct LinTerm {
-   std::shared_ptr<Variable> var;
+   unsigned int var;
    double coef = 1.0;
 };
 
 struct QuadTerm {
-   std::shared_ptr<Variable> var1;
-   std::shared_ptr<Variable> var2;
+   unsigned int var1;
+   unsigned int var2;
    double coef = 1.0;
 };
 
-struct Expression {
-   std::vector<std::shared_ptr<LinTerm>> linterms;
-   std::vector<std::shared_ptr<QuadTerm>> quadterms; 
-   double offset = 0.0;
-   std::string name = "";
-};
+// the model is held in flat arrays: variables are numbered in order of
+// first appearance, and constraints are stored row-wise as they are read
+struct Model {
+   ObjectiveSense sense = ObjectiveSense::MIN;
 
-struct Constraint {
-   double lowerbound = -std::numeric_limits<double>::infinity();
-   double upperbound = std::numeric_limits<double>::infinity();
-   std::shared_ptr<Expression> expr;
+   // names of all variables, back to back
+   std::string variablenames;
+   std::vector<size_t> variablenamestart = {0};
+   std::vector<VariableType> variabletype;
+   std::vector<double> variablelowerbound;
+   std::vector<double> variableupperbound;
 
-   Constraint() : expr(std::shared_ptr<Expression>(new Expression)) {};
-};
+   std::vector<LinTerm> objectivelinterms;
+   std::vector<QuadTerm> objectivequadterms;
+   double objectiveoffset = 0.0;
 
-struct Model {
-   std::shared_ptr<Expression> objective;
-   ObjectiveSense sense;
-   std::vector<std::shared_ptr<Constraint>> constraints;
-   std::vector<std::shared_ptr<Variable>> variables;
+   std::vector<unsigned int> constraintstart = {0};
+   std::vector<unsigned int> constraintindex;
+   std::vector<double> constraintvalue;
+   std::vector<double> constraintlowerbound;
+   std::vector<double> constraintupperbound;
+
+   unsigned int numvariables() const {
+      return variabletype.size();
+   }
+
+   unsigned int numconstraints() const {
+      return constraintlowerbound.size();
+   }
+
+   std::string variablename(unsigned int var) const {
+      return variablenames.substr(variablenamestart[var], variablenamestart[var+1] - variablenamestart[var]);
+   }
+
+   unsigned int addvariable(const std::string& name) {
+      variablenames.append(name);
+      variablenamestart.push_back(variablenames.size());
+      variabletype.push_back(VariableType::CONTINUOUS);
+      variablelowerbound.push_back(0.0);
+      variableupperbound.push_back(std::numeric_limits<double>::infinity());
+      return variabletype.size() - 1;
+   }
+
+   void addconstraint(const std::vector<LinTerm>& linterms, double lowerbound, double upperbound) {
+      for (const LinTerm& linterm : linterms) {
+         constraintindex.push_back(linterm.var);
+         constraintvalue.push_back(linterm.coef);
+      }
+      constraintstart.push_back(constraintindex.size());
+      constraintlowerbound.push_back(lowerbound);
+      constraintupperbound.push_back(upperbound);
+   }
 };
 
 #endif
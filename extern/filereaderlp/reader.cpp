@@ -2,10 +2,12 @@
 
 #include "builder.hpp"
 
-#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
 #include <limits>
-#include <map>
-#include <memory>
+#include <string>
 #include <vector>
 
 #include "def.hpp"
@@ -29,22 +31,16 @@ enum class RawTokenType {
    ASTERISK
 };
 
+// tokens are held by value in short lookahead windows, so the memory
+// used by the reader does not grow with the length of the file
 struct RawToken {
    RawTokenType type;
-   inline bool istype(RawTokenType t) {
+   double value = 0.0;
+   std::string name;
+   inline bool istype(RawTokenType t) const {
       return this->type == t;
    }
-   RawToken(RawTokenType t) : type(t) {} ;
-};
-
-struct RawStringToken : RawToken {
-   std::string value;
-   RawStringToken(std::string v) : RawToken(RawTokenType::STR), value(v) {};
-};
-
-struct RawConstantToken : RawToken {
-   double value;
-   RawConstantToken(double v) : RawToken(RawTokenType::CONS), value(v) {};
+   RawToken(RawTokenType t = RawTokenType::NONE) : type(t) {};
 };
 
 enum class ProcessedTokenType {
@@ -60,7 +56,8 @@ enum class ProcessedTokenType {
    LNEND,
    SLASH,
    ASTERISK,
-   HAT
+   HAT,
+   FLEND
 };
 
 enum class LpSectionKeyword {
@@ -75,88 +72,71 @@ enum class LpSectionKeyword {
   END
 };
 
+const unsigned int LP_NUM_SECTION_KEYWORD = 9;
+
 enum class LpObjectiveSectionKeywordType { NONE, MIN, MAX };
 
 enum class LpComparisonType { LEQ, L, EQ, G, GEQ };
 
 struct ProcessedToken {
    ProcessedTokenType type;
-   ProcessedToken(ProcessedTokenType t) : type(t) {};
-};
-
-struct ProcessedTokenSectionKeyword : ProcessedToken {
-   LpSectionKeyword keyword;
-   ProcessedTokenSectionKeyword(LpSectionKeyword k) : ProcessedToken(ProcessedTokenType::SECID), keyword(k) {};
-};
-
-struct ProcessedTokenObjectiveSectionKeyword : ProcessedTokenSectionKeyword {
-   LpObjectiveSectionKeywordType objsense;
-   ProcessedTokenObjectiveSectionKeyword(LpObjectiveSectionKeywordType os) : ProcessedTokenSectionKeyword(LpSectionKeyword::OBJ), objsense(os) {};
-};
-
-struct ProcessedConsIdToken : ProcessedToken {
+   LpSectionKeyword keyword = LpSectionKeyword::NONE;
+   LpObjectiveSectionKeywordType objsense = LpObjectiveSectionKeywordType::NONE;
+   LpComparisonType dir = LpComparisonType::EQ;
+   double value = 0.0;
    std::string name;
-   ProcessedConsIdToken(std::string n) : ProcessedToken(ProcessedTokenType::CONID), name(n) {};
-};
-
-struct ProcessedVarIdToken : ProcessedToken {
-   std::string name;
-   ProcessedVarIdToken(std::string n) : ProcessedToken(ProcessedTokenType::VARID), name(n) {};
-};
-
-struct ProcessedConstantToken : ProcessedToken {
-   double value;
-   ProcessedConstantToken(double v) : ProcessedToken(ProcessedTokenType::CONST), value(v) {};
-};
-
-struct ProcessedComparisonToken : ProcessedToken {
-   LpComparisonType dir;
-   ProcessedComparisonToken(LpComparisonType d) : ProcessedToken(ProcessedTokenType::COMP), dir(d) {};
+   inline bool istype(ProcessedTokenType t) const {
+      return this->type == t;
+   }
+   ProcessedToken(ProcessedTokenType t = ProcessedTokenType::NONE) : type(t) {};
 };
 
 class Reader {
 private:
-   FILE* file;
-   std::vector<std::unique_ptr<RawToken>> rawtokens;
-   std::vector<std::unique_ptr<ProcessedToken>> processedtokens;
-   std::map<LpSectionKeyword, std::vector<std::unique_ptr<ProcessedToken>>> sectiontokens;
-   
-   char linebuffer[LP_MAX_LINE_LENGTH+1];
-   bool linebufferrefill;
-   char* linebufferpos;
+   std::istream& file;
+   std::string linebuffer;
+   size_t linebufferpos = 0;
+   bool linebufferrefill = true;
+
+   std::deque<RawToken> rawtokens;
+   std::deque<ProcessedToken> processedtokens;
+   bool sectionused[LP_NUM_SECTION_KEYWORD] = {};
+
+   // terms of the constraint being read
+   std::vector<LinTerm> linterms;
+   std::vector<QuadTerm> quadterms;
 
    Builder builder;
 
-   void tokenize();
-   void readnexttoken(bool& done);
-   void processtokens();
-   void splittokens();
-   void processsections();
-   void processnonesec();
+   RawToken readnexttoken();
+   RawToken& peekraw(unsigned int k);
+   void processnexttoken();
+   ProcessedToken& peek(unsigned int k);
+   void consume(unsigned int n);
+   bool atsectionend();
    void processobjsec();
    void processconsec();
    void processboundssec();
    void processbinsec();
    void processgensec();
    void processsemisec();
-   void processsossec();
-   void processendsec();
-   void parseexpression(std::vector<std::unique_ptr<ProcessedToken>>& tokens, std::shared_ptr<Expression> expr, unsigned int& i);
+   void parseexpression(std::vector<LinTerm>& linterms, std::vector<QuadTerm>& quadterms, double& offset);
 
 public:
-   Reader(std::string filename) : file(fopen(filename.c_str(), "r")) {
-      lpassert(file != nullptr);
+   Reader(std::istream& stream) : file(stream) {
+      lpassert(!file.fail());
    };
 
-   ~Reader() {
-      fclose(file);
-   }
-
    Model read();
 };
 
 Model readinstance(std::string filename) {
-   Reader reader(filename);
+   std::ifstream stream(filename);
+   return readinstance(stream);
+}
+
+Model readinstance(std::istream& stream) {
+   Reader reader(stream);
    return reader.read();
 }
 
@@ -187,7 +167,7 @@ LpObjectiveSectionKeywordType parseobjectivesectionkeyword(const std::string str
    if (iskeyword(str, LP_KEYWORD_MAX, LP_KEYWORD_MAX_N)) {
       return LpObjectiveSectionKeywordType::MAX;
    }
-   
+
    return LpObjectiveSectionKeywordType::NONE;
 }
 
@@ -227,147 +207,178 @@ LpSectionKeyword parsesectionkeyword(const std::string& str) {
    return LpSectionKeyword::NONE;
 }
 
+// reads the file a section item at a time, adding each item to the model
+// as soon as it has been parsed
 Model Reader::read() {
-   tokenize();
-   processtokens();
-   splittokens();
-   processsections();
+   LpSectionKeyword currentsection = LpSectionKeyword::NONE;
+
+   while (!this->peek(0).istype(ProcessedTokenType::FLEND)) {
+      ProcessedToken& token = this->peek(0);
+      if (token.istype(ProcessedTokenType::SECID)) {
+         currentsection = token.keyword;
+
+         if (currentsection == LpSectionKeyword::OBJ) {
+            switch(token.objsense) {
+               case LpObjectiveSectionKeywordType::MIN:
+                  builder.model.sense = ObjectiveSense::MIN;
+                  break;
+               case LpObjectiveSectionKeywordType::MAX:
+                  builder.model.sense = ObjectiveSense::MAX;
+                  break;
+               default:
+                  lpassert(false);
+            }
+         }
+
+         // make sure this section did not yet occur
+         lpassert(!this->sectionused[(unsigned int)currentsection]);
+         this->consume(1);
+         continue;
+      }
 
-   return builder.model;
+      this->sectionused[(unsigned int)currentsection] = true;
+      switch (currentsection) {
+         case LpSectionKeyword::OBJ:
+            processobjsec();
+            break;
+         case LpSectionKeyword::CON:
+            processconsec();
+            break;
+         case LpSectionKeyword::BOUNDS:
+            processboundssec();
+            break;
+         case LpSectionKeyword::GEN:
+            processgensec();
+            break;
+         case LpSectionKeyword::BIN:
+            processbinsec();
+            break;
+         case LpSectionKeyword::SEMI:
+            processsemisec();
+            break;
+         default:
+            // nothing may precede the first section, and SOS (TODO) and
+            // END sections must be empty
+            lpassert(false);
+      }
+   }
+
+   return std::move(builder.model);
 }
 
-void Reader::processnonesec() {
-   lpassert(sectiontokens[LpSectionKeyword::NONE].empty());
+bool Reader::atsectionend() {
+   return this->peek(0).istype(ProcessedTokenType::SECID) || this->peek(0).istype(ProcessedTokenType::FLEND);
 }
 
-void Reader::parseexpression(std::vector<std::unique_ptr<ProcessedToken>>& tokens, std::shared_ptr<Expression> expr, unsigned int& i) {
-   if (tokens.size() - i >= 1 && tokens[0]->type == ProcessedTokenType::CONID) {
-      expr->name = ((ProcessedConsIdToken*)tokens[i].get())->name;
-      i++;
+void Reader::parseexpression(std::vector<LinTerm>& linterms, std::vector<QuadTerm>& quadterms, double& offset) {
+   // names of the objective and constraints are not kept
+   if (this->peek(0).istype(ProcessedTokenType::CONID)) {
+      this->consume(1);
    }
 
-   while (i<tokens.size()) {
+   while (true) {
       // const var
-      if (tokens.size() - i >= 2
-      && tokens[i]->type == ProcessedTokenType::CONST
-      && tokens[i+1]->type == ProcessedTokenType::VARID) {
-         std::string name = ((ProcessedVarIdToken*)tokens[i+1].get())->name;
-         
-         std::shared_ptr<LinTerm> linterm = std::shared_ptr<LinTerm>(new LinTerm());
-         linterm->coef = ((ProcessedConstantToken*)tokens[i].get())->value;
-         linterm->var = builder.getvarbyname(name);
-         expr->linterms.push_back(linterm);
-
-         i += 2;
+      if (this->peek(0).istype(ProcessedTokenType::CONST)
+      && this->peek(1).istype(ProcessedTokenType::VARID)) {
+         LinTerm linterm;
+         linterm.coef = this->peek(0).value;
+         linterm.var = builder.getvarbyname(this->peek(1).name);
+         linterms.push_back(linterm);
+
+         this->consume(2);
          continue;
       }
 
       // const
-      if (tokens.size() - i  >= 1 && tokens[i]->type == ProcessedTokenType::CONST) {
-         expr->offset = ((ProcessedConstantToken*)tokens[i].get())->value;
-         i++;
+      if (this->peek(0).istype(ProcessedTokenType::CONST)) {
+         offset += this->peek(0).value;
+         this->consume(1);
          continue;
       }
-      
+
       // var
-      if (tokens.size() - i  >= 1 && tokens[i]->type == ProcessedTokenType::VARID) {
-         std::string name = ((ProcessedVarIdToken*)tokens[i].get())->name;
-         
-         std::shared_ptr<LinTerm> linterm = std::shared_ptr<LinTerm>(new LinTerm());
-         linterm->coef = 1.0;
-         linterm->var = builder.getvarbyname(name);
-         expr->linterms.push_back(linterm);
-
-         i++;
+      if (this->peek(0).istype(ProcessedTokenType::VARID)) {
+         LinTerm linterm;
+         linterm.coef = 1.0;
+         linterm.var = builder.getvarbyname(this->peek(0).name);
+         linterms.push_back(linterm);
+
+         this->consume(1);
          continue;
       }
 
       // quadratic expression
-      if (tokens.size() - i >= 2 && tokens[i]->type == ProcessedTokenType::BRKOP) {
-         i++;
-         while (i < tokens.size() && tokens[i]->type != ProcessedTokenType::BRKCL) {
+      if (this->peek(0).istype(ProcessedTokenType::BRKOP)) {
+         this->consume(1);
+         while (!this->peek(0).istype(ProcessedTokenType::BRKCL)) {
             // const var hat const
-            if (tokens.size() - i >= 4
-            && tokens[i]->type == ProcessedTokenType::CONST
-            && tokens[i+1]->type == ProcessedTokenType::VARID
-            && tokens[i+2]->type == ProcessedTokenType::HAT
-            && tokens[i+3]->type == ProcessedTokenType::CONST) {
-               std::string name = ((ProcessedVarIdToken*)tokens[i+1].get())->name;
-
-               lpassert (((ProcessedConstantToken*)tokens[i+3].get())->value == 2.0);
-
-               std::shared_ptr<QuadTerm> quadterm = std::shared_ptr<QuadTerm>(new QuadTerm());
-               quadterm->coef = ((ProcessedConstantToken*)tokens[i].get())->value;
-               quadterm->var1 = builder.getvarbyname(name);
-               quadterm->var2 = builder.getvarbyname(name);
-               expr->quadterms.push_back(quadterm);
-
-               i += 4;
+            if (this->peek(0).istype(ProcessedTokenType::CONST)
+            && this->peek(1).istype(ProcessedTokenType::VARID)
+            && this->peek(2).istype(ProcessedTokenType::HAT)
+            && this->peek(3).istype(ProcessedTokenType::CONST)) {
+               lpassert(this->peek(3).value == 2.0);
+
+               QuadTerm quadterm;
+               quadterm.coef = this->peek(0).value;
+               quadterm.var1 = builder.getvarbyname(this->peek(1).name);
+               quadterm.var2 = quadterm.var1;
+               quadterms.push_back(quadterm);
+
+               this->consume(4);
                continue;
             }
 
             // var hat const
-            if (tokens.size() - i >= 3
-            && tokens[i]->type == ProcessedTokenType::VARID
-            && tokens[i+1]->type == ProcessedTokenType::HAT
-            && tokens[i+2]->type == ProcessedTokenType::CONST) {
-               std::string name = ((ProcessedVarIdToken*)tokens[i].get())->name;
-
-               lpassert (((ProcessedConstantToken*)tokens[i+2].get())->value == 2.0);
-
-               std::shared_ptr<QuadTerm> quadterm = std::shared_ptr<QuadTerm>(new QuadTerm());
-               quadterm->coef = 1.0;
-               quadterm->var1 = builder.getvarbyname(name);
-               quadterm->var2 = builder.getvarbyname(name);
-               expr->quadterms.push_back(quadterm);
-
-               i += 3;
+            if (this->peek(0).istype(ProcessedTokenType::VARID)
+            && this->peek(1).istype(ProcessedTokenType::HAT)
+            && this->peek(2).istype(ProcessedTokenType::CONST)) {
+               lpassert(this->peek(2).value == 2.0);
+
+               QuadTerm quadterm;
+               quadterm.coef = 1.0;
+               quadterm.var1 = builder.getvarbyname(this->peek(0).name);
+               quadterm.var2 = quadterm.var1;
+               quadterms.push_back(quadterm);
+
+               this->consume(3);
                continue;
             }
 
             // const var asterisk var
-            if (tokens.size() - i >= 4
-            && tokens[i]->type == ProcessedTokenType::CONST
-            && tokens[i+1]->type == ProcessedTokenType::VARID
-            && tokens[i+2]->type == ProcessedTokenType::ASTERISK
-            && tokens[i+3]->type == ProcessedTokenType::VARID) {
-               std::string name1 = ((ProcessedVarIdToken*)tokens[i+1].get())->name;
-               std::string name2 = ((ProcessedVarIdToken*)tokens[i+3].get())->name;
-
-               std::shared_ptr<QuadTerm> quadterm = std::shared_ptr<QuadTerm>(new QuadTerm());
-               quadterm->coef = ((ProcessedConstantToken*)tokens[i].get())->value;
-               quadterm->var1 = builder.getvarbyname(name1);
-               quadterm->var2 = builder.getvarbyname(name2);
-               expr->quadterms.push_back(quadterm);
-
-               i += 4;
+            if (this->peek(0).istype(ProcessedTokenType::CONST)
+            && this->peek(1).istype(ProcessedTokenType::VARID)
+            && this->peek(2).istype(ProcessedTokenType::ASTERISK)
+            && this->peek(3).istype(ProcessedTokenType::VARID)) {
+               QuadTerm quadterm;
+               quadterm.coef = this->peek(0).value;
+               quadterm.var1 = builder.getvarbyname(this->peek(1).name);
+               quadterm.var2 = builder.getvarbyname(this->peek(3).name);
+               quadterms.push_back(quadterm);
+
+               this->consume(4);
                continue;
             }
 
             // var asterisk var
-            if (tokens.size() - i >= 3
-            && tokens[i]->type == ProcessedTokenType::VARID
-            && tokens[i+1]->type == ProcessedTokenType::ASTERISK
-            && tokens[i+2]->type == ProcessedTokenType::VARID) {
-               std::string name1 = ((ProcessedVarIdToken*)tokens[i].get())->name;
-               std::string name2 = ((ProcessedVarIdToken*)tokens[i+2].get())->name;
-
-               std::shared_ptr<QuadTerm> quadterm = std::shared_ptr<QuadTerm>(new QuadTerm());
-               quadterm->coef = 1.0;
-               quadterm->var1 = builder.getvarbyname(name1);
-               quadterm->var2 = builder.getvarbyname(name2);
-               expr->quadterms.push_back(quadterm);
-
-               i += 3;
+            if (this->peek(0).istype(ProcessedTokenType::VARID)
+            && this->peek(1).istype(ProcessedTokenType::ASTERISK)
+            && this->peek(2).istype(ProcessedTokenType::VARID)) {
+               QuadTerm quadterm;
+               quadterm.coef = 1.0;
+               quadterm.var1 = builder.getvarbyname(this->peek(0).name);
+               quadterm.var2 = builder.getvarbyname(this->peek(2).name);
+               quadterms.push_back(quadterm);
+
+               this->consume(3);
                continue;
             }
+
+            lpassert(false);
          }
-         lpassert(tokens.size() - i >= 3);
-         lpassert(tokens[i]->type == ProcessedTokenType::BRKCL);
-         lpassert(tokens[i+1]->type == ProcessedTokenType::SLASH);
-         lpassert(tokens[i+2]->type == ProcessedTokenType::CONST);
-         lpassert(((ProcessedConstantToken*)tokens[i+2].get())->value == 2.0);
-         i += 3;
+         lpassert(this->peek(1).istype(ProcessedTokenType::SLASH));
+         lpassert(this->peek(2).istype(ProcessedTokenType::CONST));
+         lpassert(this->peek(2).value == 2.0);
+         this->consume(3);
          continue;
       }
 
@@ -376,560 +387,374 @@ void Reader::parseexpression(std::vector<std::unique_ptr<ProcessedToken>>& token
 }
 
 void Reader::processobjsec() {
-   builder.model.objective = std::shared_ptr<Expression>(new Expression);
-   unsigned int i = 0;   
-   parseexpression(sectiontokens[LpSectionKeyword::OBJ], builder.model.objective, i);
-   lpassert(i == sectiontokens[LpSectionKeyword::OBJ].size());
+   parseexpression(builder.model.objectivelinterms, builder.model.objectivequadterms, builder.model.objectiveoffset);
+   lpassert(this->atsectionend());
 }
 
 void Reader::processconsec() {
-   unsigned int i=0;
-   while (i<sectiontokens[LpSectionKeyword::CON].size()) {
-      std::shared_ptr<Constraint> con = std::shared_ptr<Constraint>(new Constraint);
-      parseexpression(sectiontokens[LpSectionKeyword::CON], con->expr, i);
-      lpassert(sectiontokens[LpSectionKeyword::CON].size() - i >= 2);
-	  lpassert(sectiontokens[LpSectionKeyword::CON][i]->type == ProcessedTokenType::COMP);
-      lpassert(sectiontokens[LpSectionKeyword::CON][i+1]->type == ProcessedTokenType::CONST);
-      double value = ((ProcessedConstantToken*)sectiontokens[LpSectionKeyword::CON][i+1].get())->value;
-      switch (((ProcessedComparisonToken*)sectiontokens[LpSectionKeyword::CON][i].get())->dir) {
-         case LpComparisonType::EQ:
-            con->lowerbound = con->upperbound = value;
-            break;
+   this->linterms.clear();
+   this->quadterms.clear();
+   double offset = 0.0;
+   parseexpression(this->linterms, this->quadterms, offset);
+   lpassert(this->peek(0).istype(ProcessedTokenType::COMP));
+   lpassert(this->peek(1).istype(ProcessedTokenType::CONST));
+   double value = this->peek(1).value;
+   double lowerbound = -std::numeric_limits<double>::infinity();
+   double upperbound = std::numeric_limits<double>::infinity();
+   switch (this->peek(0).dir) {
+      case LpComparisonType::EQ:
+         lowerbound = upperbound = value;
+         break;
+      case LpComparisonType::LEQ:
+         upperbound = value;
+         break;
+      case LpComparisonType::GEQ:
+         lowerbound = value;
+         break;
+      default:
+         lpassert(false);
+   }
+   this->consume(2);
+   builder.model.addconstraint(this->linterms, lowerbound, upperbound);
+}
+
+void Reader::processboundssec() {
+   Model& model = builder.model;
+
+   // VAR free
+   if (this->peek(0).istype(ProcessedTokenType::VARID)
+   && this->peek(1).istype(ProcessedTokenType::FREE)) {
+      unsigned int var = builder.getvarbyname(this->peek(0).name);
+      model.variablelowerbound[var] = -std::numeric_limits<double>::infinity();
+      model.variableupperbound[var] = std::numeric_limits<double>::infinity();
+      this->consume(2);
+      return;
+   }
+
+   // CONST COMP VAR COMP CONST
+   if (this->peek(0).istype(ProcessedTokenType::CONST)
+   && this->peek(1).istype(ProcessedTokenType::COMP)
+   && this->peek(2).istype(ProcessedTokenType::VARID)
+   && this->peek(3).istype(ProcessedTokenType::COMP)
+   && this->peek(4).istype(ProcessedTokenType::CONST)) {
+      lpassert(this->peek(1).dir == LpComparisonType::LEQ);
+      lpassert(this->peek(3).dir == LpComparisonType::LEQ);
+
+      unsigned int var = builder.getvarbyname(this->peek(2).name);
+      model.variablelowerbound[var] = this->peek(0).value;
+      model.variableupperbound[var] = this->peek(4).value;
+
+      this->consume(5);
+      return;
+   }
+
+   // CONST COMP VAR
+   if (this->peek(0).istype(ProcessedTokenType::CONST)
+   && this->peek(1).istype(ProcessedTokenType::COMP)
+   && this->peek(2).istype(ProcessedTokenType::VARID)) {
+      double value = this->peek(0).value;
+      unsigned int var = builder.getvarbyname(this->peek(2).name);
+      LpComparisonType dir = this->peek(1).dir;
+
+      lpassert(dir != LpComparisonType::L && dir != LpComparisonType::G);
+
+      switch (dir) {
          case LpComparisonType::LEQ:
-            con->upperbound = value;
+            model.variablelowerbound[var] = value;
             break;
          case LpComparisonType::GEQ:
-            con->lowerbound = value;
+            model.variableupperbound[var] = value;
+            break;
+         case LpComparisonType::EQ:
+            model.variablelowerbound[var] = model.variableupperbound[var] = value;
             break;
          default:
             lpassert(false);
       }
-      i += 2;
-      builder.model.constraints.push_back(con);
+      this->consume(3);
+      return;
    }
-}
 
-void Reader::processboundssec() {
-   unsigned int i=0;
-   while (i<sectiontokens[LpSectionKeyword::BOUNDS].size()) {
-      // VAR free
-      if (sectiontokens[LpSectionKeyword::BOUNDS].size() - i >= 2
-         && sectiontokens[LpSectionKeyword::BOUNDS][i]->type == ProcessedTokenType::VARID
-         && sectiontokens[LpSectionKeyword::BOUNDS][i+1]->type == ProcessedTokenType::FREE) {
-         std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::BOUNDS][i].get())->name;
-         std::shared_ptr<Variable> var = builder.getvarbyname(name);
-         var->lowerbound = -std::numeric_limits<double>::infinity(); 
-         var->upperbound = std::numeric_limits<double>::infinity();
-         i += 2;
-		 continue;
-      }
+   // VAR COMP CONST
+   if (this->peek(0).istype(ProcessedTokenType::VARID)
+   && this->peek(1).istype(ProcessedTokenType::COMP)
+   && this->peek(2).istype(ProcessedTokenType::CONST)) {
+      double value = this->peek(2).value;
+      unsigned int var = builder.getvarbyname(this->peek(0).name);
+      LpComparisonType dir = this->peek(1).dir;
 
-	  // CONST COMP VAR COMP CONST
-	  if (sectiontokens[LpSectionKeyword::BOUNDS].size() - i >= 5
-		  && sectiontokens[LpSectionKeyword::BOUNDS][i]->type == ProcessedTokenType::CONST
-		  && sectiontokens[LpSectionKeyword::BOUNDS][i + 1]->type == ProcessedTokenType::COMP
-		  && sectiontokens[LpSectionKeyword::BOUNDS][i + 2]->type == ProcessedTokenType::VARID
-		  && sectiontokens[LpSectionKeyword::BOUNDS][i + 3]->type == ProcessedTokenType::COMP
-		  && sectiontokens[LpSectionKeyword::BOUNDS][i + 4]->type == ProcessedTokenType::CONST) {
-		  lpassert(((ProcessedComparisonToken*)sectiontokens[LpSectionKeyword::BOUNDS][i + 1].get())->dir == LpComparisonType::LEQ);
-		  lpassert(((ProcessedComparisonToken*)sectiontokens[LpSectionKeyword::BOUNDS][i + 3].get())->dir == LpComparisonType::LEQ);
-
-		  double lb = ((ProcessedConstantToken*)sectiontokens[LpSectionKeyword::BOUNDS][i].get())->value;
-		  double ub = ((ProcessedConstantToken*)sectiontokens[LpSectionKeyword::BOUNDS][i + 4].get())->value;
-
-		  std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::BOUNDS][i + 2].get())->name;
-		  std::shared_ptr<Variable> var = builder.getvarbyname(name);
-
-		  var->lowerbound = lb;
-		  var->upperbound = ub;
-
-		  i += 5;
-		  continue;
-	  }
-
-      // CONST COMP VAR
-      if (sectiontokens[LpSectionKeyword::BOUNDS].size() - i >= 3
-      && sectiontokens[LpSectionKeyword::BOUNDS][i]->type == ProcessedTokenType::CONST
-      && sectiontokens[LpSectionKeyword::BOUNDS][i+1]->type == ProcessedTokenType::COMP
-      && sectiontokens[LpSectionKeyword::BOUNDS][i+2]->type == ProcessedTokenType::VARID) {
-         double value = ((ProcessedConstantToken*)sectiontokens[LpSectionKeyword::BOUNDS][i].get())->value;
-         std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::BOUNDS][i+2].get())->name;
-         std::shared_ptr<Variable> var = builder.getvarbyname(name);
-         LpComparisonType dir = ((ProcessedComparisonToken*)sectiontokens[LpSectionKeyword::BOUNDS][i+1].get())->dir;
-
-         lpassert(dir != LpComparisonType::L && dir != LpComparisonType::G);
-
-         switch (dir) {
-            case LpComparisonType::LEQ:
-               var->lowerbound = value;
-               break;
-            case LpComparisonType::GEQ:
-               var->upperbound = value;
-               break;
-            case LpComparisonType::EQ:
-               var->lowerbound = var->upperbound = value;
-               break;
-            default:
-               lpassert(false);
-         }
-         i += 3;
-         continue;
-      }
+      lpassert(dir != LpComparisonType::L && dir != LpComparisonType::G);
 
-      // VAR COMP CONST
-      if (sectiontokens[LpSectionKeyword::BOUNDS].size() -i >= 3
-      && sectiontokens[LpSectionKeyword::BOUNDS][i]->type == ProcessedTokenType::VARID
-      && sectiontokens[LpSectionKeyword::BOUNDS][i+1]->type == ProcessedTokenType::COMP
-      && sectiontokens[LpSectionKeyword::BOUNDS][i+2]->type == ProcessedTokenType::CONST) {
-         double value = ((ProcessedConstantToken*)sectiontokens[LpSectionKeyword::BOUNDS][i+2].get())->value;
-         std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::BOUNDS][i].get())->name;
-         std::shared_ptr<Variable> var = builder.getvarbyname(name);
-         LpComparisonType dir = ((ProcessedComparisonToken*)sectiontokens[LpSectionKeyword::BOUNDS][i+1].get())->dir;
-
-         lpassert(dir != LpComparisonType::L && dir != LpComparisonType::G);
-
-         switch (dir) {
-            case LpComparisonType::LEQ:
-               var->upperbound = value;
-               break;
-            case LpComparisonType::GEQ:
-               var->lowerbound = value;
-               break;
-            case LpComparisonType::EQ:
-               var->lowerbound = var->upperbound = value;
-               break;
-            default:
-               lpassert(false);
-         }
-         i += 3;
-         continue;
+      switch (dir) {
+         case LpComparisonType::LEQ:
+            model.variableupperbound[var] = value;
+            break;
+         case LpComparisonType::GEQ:
+            model.variablelowerbound[var] = value;
+            break;
+         case LpComparisonType::EQ:
+            model.variablelowerbound[var] = model.variableupperbound[var] = value;
+            break;
+         default:
+            lpassert(false);
       }
-      
-	  lpassert(false);
+      this->consume(3);
+      return;
    }
+
+   lpassert(false);
 }
 
 void Reader::processbinsec() {
-   for (unsigned int i=0; i<sectiontokens[LpSectionKeyword::BIN].size(); i++) {
-      lpassert(sectiontokens[LpSectionKeyword::BIN][i]->type == ProcessedTokenType::VARID);
-      std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::BIN][i].get())->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
-      var->type = VariableType::BINARY;
-   }
+   lpassert(this->peek(0).istype(ProcessedTokenType::VARID));
+   unsigned int var = builder.getvarbyname(this->peek(0).name);
+   builder.model.variabletype[var] = VariableType::BINARY;
+   this->consume(1);
 }
 
 void Reader::processgensec() {
-   for (unsigned int i=0; i<sectiontokens[LpSectionKeyword::GEN].size(); i++) {
-      lpassert(sectiontokens[LpSectionKeyword::GEN][i]->type == ProcessedTokenType::VARID);
-      std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::GEN][i].get())->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
-      var->type = VariableType::GENERAL;
-   }
+   lpassert(this->peek(0).istype(ProcessedTokenType::VARID));
+   unsigned int var = builder.getvarbyname(this->peek(0).name);
+   builder.model.variabletype[var] = VariableType::GENERAL;
+   this->consume(1);
 }
 
 void Reader::processsemisec() {
-   for (unsigned int i=0; i<sectiontokens[LpSectionKeyword::SEMI].size(); i++) {
-      lpassert(sectiontokens[LpSectionKeyword::SEMI][i]->type == ProcessedTokenType::VARID);
-      std::string name = ((ProcessedVarIdToken*)sectiontokens[LpSectionKeyword::SEMI][i].get())->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
-      var->type = VariableType::SEMICONTINUOUS;
-   }
-}
-
-void Reader::processsossec() {
-   // TODO
-   lpassert(sectiontokens[LpSectionKeyword::SOS].empty());
+   lpassert(this->peek(0).istype(ProcessedTokenType::VARID));
+   unsigned int var = builder.getvarbyname(this->peek(0).name);
+   builder.model.variabletype[var] = VariableType::SEMICONTINUOUS;
+   this->consume(1);
 }
 
-void Reader::processendsec() {
-   lpassert(sectiontokens[LpSectionKeyword::END].empty());
+ProcessedToken& Reader::peek(unsigned int k) {
+   while (this->processedtokens.size() <= k) {
+      this->processnexttoken();
+   }
+   return this->processedtokens[k];
 }
 
-void Reader::processsections() {
-   processnonesec();
-   processobjsec();
-   processconsec();
-   processboundssec();
-   processgensec();
-   processbinsec();
-   processsemisec();
-   processsossec();
-   processendsec();
+void Reader::consume(unsigned int n) {
+   for (unsigned int i = 0; i < n; i++) {
+      this->processedtokens.pop_front();
+   }
 }
 
-void Reader::splittokens() {
-   LpSectionKeyword currentsection = LpSectionKeyword::NONE;
-   
-   for (unsigned int i=0; i < processedtokens.size(); ++i) {
-      if (processedtokens[i]->type == ProcessedTokenType::SECID) {
-         currentsection = ((ProcessedTokenSectionKeyword*)processedtokens[i].get())->keyword;
-         
-         if (currentsection == LpSectionKeyword::OBJ) {
-            switch(((ProcessedTokenObjectiveSectionKeyword*)processedtokens[i].get())->objsense) {
-               case LpObjectiveSectionKeywordType::MIN:
-                  builder.model.sense = ObjectiveSense::MIN;
-                  break;
-               case LpObjectiveSectionKeywordType::MAX:
-                  builder.model.sense = ObjectiveSense::MAX;
-                  break;
-               default:
-                  lpassert(false);
-            }
-         }
-
-         // make sure this section did not yet occur
-         lpassert(sectiontokens[currentsection].empty());
-      } else {
-         sectiontokens[currentsection].push_back(std::move(processedtokens[i]));
-      }
+RawToken& Reader::peekraw(unsigned int k) {
+   while (this->rawtokens.size() <= k) {
+      this->rawtokens.push_back(this->readnexttoken());
    }
+   return this->rawtokens[k];
 }
 
-void Reader::processtokens() {
-   unsigned int i = 0;
-   
-   while (i < this->rawtokens.size()) {
-      fflush(stdout);
+// combines the next raw tokens into a processed token
+void Reader::processnexttoken() {
+   ProcessedToken token;
+   unsigned int nconsumed = 1;
+   RawToken& raw = this->peekraw(0);
+
+   if (raw.istype(RawTokenType::STR)) {
+      LpSectionKeyword keyword = LpSectionKeyword::NONE;
 
       // long section keyword semi-continuous
-      if (rawtokens.size() - i >= 3 && rawtokens[i]->istype(RawTokenType::STR) && rawtokens[i+1]->istype(RawTokenType::MINUS) && rawtokens[i+2]->istype(RawTokenType::STR)) {
-         std::string temp = ((RawStringToken*)rawtokens[i].get())->value + "-" + ((RawStringToken*)rawtokens[i+2].get())->value;
-         LpSectionKeyword keyword = parsesectionkeyword(temp);
+      if (this->peekraw(1).istype(RawTokenType::MINUS) && this->peekraw(2).istype(RawTokenType::STR)) {
+         keyword = parsesectionkeyword(raw.name + "-" + this->peekraw(2).name);
          if (keyword != LpSectionKeyword::NONE) {
-            processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedTokenSectionKeyword(keyword)));
-            i += 3;
-            continue;
+            nconsumed = 3;
          }
       }
 
       // long section keyword subject to/such that
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::STR) && rawtokens[i+1]->istype(RawTokenType::STR)) {
-         std::string temp = ((RawStringToken*)rawtokens[i].get())->value + " " + ((RawStringToken*)rawtokens[i+1].get())->value;
-         LpSectionKeyword keyword = parsesectionkeyword(temp);
+      if (keyword == LpSectionKeyword::NONE && this->peekraw(1).istype(RawTokenType::STR)) {
+         keyword = parsesectionkeyword(raw.name + " " + this->peekraw(1).name);
          if (keyword != LpSectionKeyword::NONE) {
-            processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedTokenSectionKeyword(keyword)));
-            i += 2;
-            continue;
+            nconsumed = 2;
          }
       }
 
       // other section keyword
-      if (rawtokens[i]->istype(RawTokenType::STR)) {
-         LpSectionKeyword keyword = parsesectionkeyword(((RawStringToken*)rawtokens[i].get())->value);
-         if (keyword != LpSectionKeyword::NONE) {
-            if (keyword == LpSectionKeyword::OBJ) {
-               LpObjectiveSectionKeywordType kw = parseobjectivesectionkeyword(((RawStringToken*)rawtokens[i].get())->value);
-               processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedTokenObjectiveSectionKeyword(kw)));
-            } else {
-               processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedTokenSectionKeyword(keyword)));
-            }
-            i++;
-            continue;
+      if (keyword == LpSectionKeyword::NONE) {
+         keyword = parsesectionkeyword(raw.name);
+         if (keyword == LpSectionKeyword::OBJ) {
+            token.objsense = parseobjectivesectionkeyword(raw.name);
          }
       }
 
-      // constraint identifier?
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::STR) && rawtokens[i+1]->istype(RawTokenType::COLON)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConsIdToken(((RawStringToken*)rawtokens[i].get())->value)));
-         i += 2;
-         continue;
-      }
-
-      // check if free
-      if (rawtokens[i]->istype(RawTokenType::STR) && iskeyword(((RawStringToken*)rawtokens[i].get())->value, LP_KEYWORD_FREE, LP_KEYWORD_FREE_N)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::FREE)));
-         i++;
-         continue;
-      }
-
-      // check if infinty
-      if (rawtokens[i]->istype(RawTokenType::STR) && iskeyword(((RawStringToken*)rawtokens[i].get())->value, LP_KEYWORD_INF, LP_KEYWORD_INF_N)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConstantToken(std::numeric_limits<double>::infinity())));
-         i++;
-         continue;
-      }
-
-      // assume var identifier
-      if (rawtokens[i]->istype(RawTokenType::STR)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedVarIdToken(((RawStringToken*)rawtokens[i].get())->value)));
-         i++;
-         continue;
-      }
-
-      // + Constant
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::PLUS) && rawtokens[i+1]->istype(RawTokenType::CONS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConstantToken(((RawConstantToken*)rawtokens[i+1].get())->value)));
-         i += 2;
-         continue;
-      }
-
-      // - constant
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::MINUS) && rawtokens[i+1]->istype(RawTokenType::CONS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConstantToken(-((RawConstantToken*)rawtokens[i+1].get())->value)));
-         i += 2;
-         continue;
-      }
-
-      // + [
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::PLUS) &&rawtokens[i+1]->istype(RawTokenType::PLUS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::BRKOP)));
-         i += 2;
-         continue;
-      }
-
-      // +
-      if (rawtokens[i]->istype(RawTokenType::PLUS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConstantToken(1.0)));
-         i++;
-         continue;
-      }
-
-      // -
-      if (rawtokens[i]->istype(RawTokenType::MINUS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConstantToken(-1.0)));
-         i++;
-         continue;
-      }
-
-      // constant
-      if (rawtokens[i]->istype(RawTokenType::CONS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedConstantToken(((RawConstantToken*)rawtokens[i].get())->value)));
-         i++;
-         continue;
-      }
-
-      // [
-      if (rawtokens[i]->istype(RawTokenType::BRKOP)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::BRKOP)));
-         i++;
-         continue;
-      }
-
-      // ]
-      if (rawtokens[i]->istype(RawTokenType::BRKCL)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::BRKCL)));
-         i++;
-         continue;
-      }
-
-      // /
-      if (rawtokens[i]->istype(RawTokenType::SLASH)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::SLASH)));
-         i++;
-         continue;
-      }
-
-      // *
-      if (rawtokens[i]->istype(RawTokenType::ASTERISK)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::ASTERISK)));
-         i++;
-         continue;
-      }
-
-      // ^
-      if (rawtokens[i]->istype(RawTokenType::HAT)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedToken(ProcessedTokenType::HAT)));
-         i++;
-         continue;
-      }
-
-      // <=
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::LESS) && rawtokens[i+1]->istype(RawTokenType::EQUAL)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedComparisonToken(LpComparisonType::LEQ)));
-         i += 2;
-         continue;
-      }
-
-      // <
-      if (rawtokens[i]->istype(RawTokenType::LESS)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedComparisonToken(LpComparisonType::L)));
-         i++;
-         continue;
-      }
-
-      // >=
-      if (rawtokens.size() - i >= 2 && rawtokens[i]->istype(RawTokenType::GREATER) && rawtokens[i+1]->istype(RawTokenType::EQUAL)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedComparisonToken(LpComparisonType::GEQ)));
-         i += 2;
-         continue;
-      }
-
-      // >
-      if (rawtokens[i]->istype(RawTokenType::GREATER)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedComparisonToken(LpComparisonType::G)));
-         i++;
-         continue;
-      }
-
-      // =
-      if (rawtokens[i]->istype(RawTokenType::EQUAL)) {
-         processedtokens.push_back(std::unique_ptr<ProcessedToken>(new ProcessedComparisonToken(LpComparisonType::EQ)));
-         i++;
-         continue;
-      }
-
-      // FILEEND
-      if (rawtokens[i]->istype(RawTokenType::FLEND)) {
-         i++;
-         continue;
+      if (keyword != LpSectionKeyword::NONE) {
+         token.type = ProcessedTokenType::SECID;
+         token.keyword = keyword;
+      } else if (this->peekraw(1).istype(RawTokenType::COLON)) {
+         // constraint identifier
+         token.type = ProcessedTokenType::CONID;
+         token.name = raw.name;
+         nconsumed = 2;
+      } else if (iskeyword(raw.name, LP_KEYWORD_FREE, LP_KEYWORD_FREE_N)) {
+         token.type = ProcessedTokenType::FREE;
+      } else if (iskeyword(raw.name, LP_KEYWORD_INF, LP_KEYWORD_INF_N)) {
+         token.type = ProcessedTokenType::CONST;
+         token.value = std::numeric_limits<double>::infinity();
+      } else {
+         // assume var identifier
+         token.type = ProcessedTokenType::VARID;
+         token.name = std::move(raw.name);
+      }
+   } else {
+      switch (raw.type) {
+         case RawTokenType::PLUS:
+         case RawTokenType::MINUS: {
+            double sign = raw.istype(RawTokenType::PLUS) ? 1.0 : -1.0;
+            if (this->peekraw(1).istype(RawTokenType::CONS)) {
+               // signed constant
+               token.type = ProcessedTokenType::CONST;
+               token.value = sign * this->peekraw(1).value;
+               nconsumed = 2;
+            } else if (raw.istype(RawTokenType::PLUS) && this->peekraw(1).istype(RawTokenType::BRKOP)) {
+               // + [
+               token.type = ProcessedTokenType::BRKOP;
+               nconsumed = 2;
+            } else {
+               token.type = ProcessedTokenType::CONST;
+               token.value = sign;
+            }
+            break;
+         }
+         case RawTokenType::CONS:
+            token.type = ProcessedTokenType::CONST;
+            token.value = raw.value;
+            break;
+         case RawTokenType::BRKOP:
+            token.type = ProcessedTokenType::BRKOP;
+            break;
+         case RawTokenType::BRKCL:
+            token.type = ProcessedTokenType::BRKCL;
+            break;
+         case RawTokenType::SLASH:
+            token.type = ProcessedTokenType::SLASH;
+            break;
+         case RawTokenType::ASTERISK:
+            token.type = ProcessedTokenType::ASTERISK;
+            break;
+         case RawTokenType::HAT:
+            token.type = ProcessedTokenType::HAT;
+            break;
+         case RawTokenType::LESS:
+         case RawTokenType::GREATER: {
+            bool less = raw.istype(RawTokenType::LESS);
+            token.type = ProcessedTokenType::COMP;
+            if (this->peekraw(1).istype(RawTokenType::EQUAL)) {
+               token.dir = less ? LpComparisonType::LEQ : LpComparisonType::GEQ;
+               nconsumed = 2;
+            } else {
+               token.dir = less ? LpComparisonType::L : LpComparisonType::G;
+            }
+            break;
+         }
+         case RawTokenType::EQUAL:
+            token.type = ProcessedTokenType::COMP;
+            token.dir = LpComparisonType::EQ;
+            break;
+         case RawTokenType::FLEND:
+            // the end of the file is not consumed, so it is seen by
+            // every later peek
+            token.type = ProcessedTokenType::FLEND;
+            nconsumed = 0;
+            break;
+         default:
+            // catch all unknown symbols
+            lpassert(false);
       }
-
-      // catch all unknown symbols
-      lpassert(false);
-      break;
    }
-}
 
-// reads the entire file and separates 
-void Reader::tokenize() {
-   this->linebufferrefill = true;
-   bool done = false;
-   while(true) {
-      this->readnexttoken(done);
-      if (this->rawtokens.size() >= 1 && this->rawtokens.back()->type == RawTokenType::FLEND) {
-         break;
-      }
+   for (unsigned int i = 0; i < nconsumed; i++) {
+      this->rawtokens.pop_front();
    }
+   this->processedtokens.push_back(std::move(token));
 }
 
-void Reader::readnexttoken(bool& done) {
-   done = false;
-   if (this->linebufferrefill) {
-      char* eof = fgets(this->linebuffer, LP_MAX_LINE_LENGTH+1, this->file);
-      this->linebufferpos = this->linebuffer;
-      this->linebufferrefill = false;
-
-      unsigned int linelength;
-      for (linelength=0; linelength<LP_MAX_LINE_LENGTH; linelength++) {
-         if (this->linebuffer[linelength] == '\r') {
-            this->linebuffer[linelength] = '\n';
-         }
-         if (this->linebuffer[linelength] == '\n') {
-            break;
+// reads the next raw token, refilling the line buffer as necessary
+RawToken Reader::readnexttoken() {
+   while (true) {
+      if (this->linebufferrefill) {
+         if (!std::getline(this->file, this->linebuffer)) {
+            return RawToken(RawTokenType::FLEND);
          }
+         this->linebufferpos = 0;
+         this->linebufferrefill = false;
       }
-      lpassert(this->linebuffer[linelength] == '\n');
 
-      // fgets returns nullptr if end of file reached (EOF following a \n)
-      if (eof == nullptr) {
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::FLEND)));
-         done = true;
-         return;
-      }
-   }
-
-   // check single character tokens
-   char nextchar = *this->linebufferpos;
-
-   switch (nextchar) {
-      // check for comment
-      case '\\':
-         this->linebufferrefill = true;
-         return;
-      
-      // check for bracket opening
-      case '[':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::BRKOP)));
-         this->linebufferpos++;
-         return;
-
-      // check for bracket closing
-      case ']':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::BRKCL)));
-         this->linebufferpos++;
-         return;
-
-      // check for less sign
-      case '<':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::LESS)));
-         this->linebufferpos++;
-         return;
+      const char* pos = this->linebuffer.c_str() + this->linebufferpos;
 
-      // check for greater sign
-      case '>':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::GREATER)));
-         this->linebufferpos++;
-         return;
-
-      // check for equal sign
-      case '=':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::EQUAL)));
-         this->linebufferpos++;
-         return;
-      
-      // check for colon
-      case ':':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::COLON)));
-         this->linebufferpos++;
-         return;
-
-      // check for plus
-      case '+':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::PLUS)));
-         this->linebufferpos++;
-         return;
-
-      // check for hat
-      case '^':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::HAT)));
-         this->linebufferpos++;
-         return;
-
-      // check for hat
-      case '/':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::SLASH)));
-         this->linebufferpos++;
-         return;
+      // check single character tokens
+      RawTokenType type = RawTokenType::NONE;
+      switch (*pos) {
+         // check for comment, line end or end of string
+         case '\\':
+         case '\r':
+         case '\n':
+         case '\0':
+            this->linebufferrefill = true;
+            continue;
 
-      // check for asterisk
-      case '*':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::ASTERISK)));
-         this->linebufferpos++;
-         return;
-      
-      // check for minus
-      case '-':
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::MINUS)));
-         this->linebufferpos++;
-         return;
+         // check for whitespace
+         case ' ':
+         case '\t':
+            this->linebufferpos++;
+            continue;
 
-      // check for whitespace
-      case ' ':
-      case '\t':
+         case '[':
+            type = RawTokenType::BRKOP;
+            break;
+         case ']':
+            type = RawTokenType::BRKCL;
+            break;
+         case '<':
+            type = RawTokenType::LESS;
+            break;
+         case '>':
+            type = RawTokenType::GREATER;
+            break;
+         case '=':
+            type = RawTokenType::EQUAL;
+            break;
+         case ':':
+            type = RawTokenType::COLON;
+            break;
+         case '+':
+            type = RawTokenType::PLUS;
+            break;
+         case '^':
+            type = RawTokenType::HAT;
+            break;
+         case '/':
+            type = RawTokenType::SLASH;
+            break;
+         case '*':
+            type = RawTokenType::ASTERISK;
+            break;
+         case '-':
+            type = RawTokenType::MINUS;
+            break;
+      }
+      if (type != RawTokenType::NONE) {
          this->linebufferpos++;
-         return;
-
-      // check for line end
-      case '\n':
-         this->linebufferrefill = true;
-         return;
-
-      // check for file end (EOF at end of some line)
-      case '\0': 
-         this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawToken(RawTokenType::FLEND)));
-         done = true;
-         return;
-   }
-   
-   // check for double value
-   double constant;
-   int ncharconsumed;
-   int nread = sscanf(this->linebufferpos, "%lf%n", &constant, &ncharconsumed);
-   if (nread == 1) {
-      this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawConstantToken(constant)));
-      this->linebufferpos += ncharconsumed;
-      return;
+         return RawToken(type);
+      }
+
+      // check for double value
+      char* end;
+      double constant = strtod(pos, &end);
+      if (end != pos) {
+         RawToken token(RawTokenType::CONS);
+         token.value = constant;
+         this->linebufferpos += end - pos;
+         return token;
+      }
+
+      // assume it's an (section/variable/constraint) idenifier
+      size_t length = strcspn(pos, "][\t\r\n\\:+<>^= /-");
+      lpassert(length > 0);
+      RawToken token(RawTokenType::STR);
+      token.name.assign(pos, length);
+      this->linebufferpos += length;
+      return token;
    }
-
-   // assume it's an (section/variable/constraint) idenifier
-   char stringbuffer[LP_MAX_NAME_LENGTH+1];
-   nread = sscanf(this->linebufferpos, "%[^][\t\n\\:+<>^= /-]%n",
-                 stringbuffer, &ncharconsumed);
-   if (nread == 1) {
-      this->rawtokens.push_back(std::unique_ptr<RawToken>(new RawStringToken(stringbuffer)));
-      this->linebufferpos += ncharconsumed;
-      return;
-   }
-   
-   lpassert(false);
 }
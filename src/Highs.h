@@ -69,9 +69,24 @@ class Highs {
       HighsModel model  //!< The HighsModel instance for this model
   );
 
-  HighsStatus passModel(HighsLp lp  //!< The HighsLp instance for this LP
+  /**
+   * @brief Copies the LP into HiGHS
+   */
+  HighsStatus passModel(const HighsLp& lp  //!< The HighsLp instance for this LP
+  );
+
+  /**
+   * @brief Takes ownership of the vectors of the LP, without copying
+   * them, leaving it empty
+   */
+  HighsStatus passModel(HighsLp&& lp  //!< The HighsLp instance for this LP
   );
 
+  /**
+   * @brief Copies the arrays into the model once, so they may be freed
+   * on return. A row-wise matrix is formed column-wise directly from
+   * its arrays, without a row-wise copy
+   */
   HighsStatus passModel(
       const HighsInt num_col, const HighsInt num_row, const HighsInt num_nz,
       const HighsInt q_num_nz, const HighsInt a_format, const HighsInt q_format,
@@ -106,11 +121,19 @@ class Highs {
   );
 
   /**
-   * @brief reads in a basis
+   * @brief reads in a basis, from a text file or a binary solution
+   * (.hbs) file
    */
   HighsStatus readBasis(const std::string filename  //!< the filename
   );
 
+  /**
+   * @brief reads in the solution and any basis from a binary solution
+   * (.hbs) file written for the current model
+   */
+  HighsStatus readSolution(const std::string filename  //!< the filename
+  );
+
   /**
    * @brief Presolve the model
    */
@@ -121,13 +144,26 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Solves independent LPs with the current options, returning
+   * the model status, solution and objective function value of each.
+   * The LPs are shared between threads, each of which reuses one Highs
+   * instance for all the LPs that it solves. Any log callbacks are
+   * called from these threads. The model of this instance is not changed
+   */
+  HighsStatus solveBatch(const std::vector<HighsLp>& lps,
+                         std::vector<HighsModelStatus>& model_status,
+                         std::vector<HighsSolution>& solution,
+                         std::vector<double>& objective_function_value);
+
   /**
    * @brief Postsolve the model
    */
   HighsStatus postsolve(const HighsSolution& solution, const HighsBasis& basis);
 
   /**
-   * @brief writes the current solution to a file
+   * @brief writes the current solution to a file, in binary if the
+   * filename ends in .hbs
    */
   HighsStatus writeSolution(const std::string filename,  //!< the filename
                             const bool pretty = false)
@@ -178,6 +214,27 @@ class Highs {
 
   const HighsOptions& getOptions() const { return options_; }
 
+  /**
+   * @brief Sets the callbacks that receive the messages of this instance
+   * in place of the log file and console, and the data passed to them.
+   * Set to NULL to reset to default
+   */
+  HighsStatus setLogCallback(void (*printmsgcb)(HighsInt level,
+                                                const char* msg,
+                                                void* msgcb_data),
+                             void (*logmsgcb)(HighsLogType type,
+                                              const char* msg,
+                                              void* msgcb_data),
+                             void* msgcb_data);
+
+  /**
+   * @brief Sets the callback that is passed the progress of the solver at
+   * simplex rebuilds, IPM iterations, and MIP nodes and improving
+   * solutions, and that can interrupt the solve. Set to NULL to reset
+   */
+  HighsStatus setCallback(HighsCallbackFunctionType user_callback,
+                          void* user_callback_data);
+
   /**
    * @brief Gets an option value as bool/int/double/string and, for
    * bool/int/double, only if it's of the correct type.
@@ -260,6 +317,14 @@ class Highs {
    */
   const HighsBasis& getBasis() const { return basis_; }
 
+  /**
+   * @brief Returns the active set with which the last QP solve by the
+   * active set method terminated. Bounds and constraints active at a bound
+   * have status kLower or kUpper, the others in the basis factor have
+   * status kZero, and the rest kBasic. It is not a simplex basis
+   */
+  const HighsBasis& getQpActiveSet() const { return qp_active_set_; }
+
   /**
    * @brief Returns the current model status
    */
@@ -369,6 +434,31 @@ class Highs {
       HighsInt* col_indices = NULL  //!< Indices of nonzeros
   );
 
+  /**
+   * @brief Gets a set of rows of \f$B^{-1}\f$ for basis matrix
+   * \f$B\f$ in compressed row form, with the nonzeros in each row in
+   * ascending order
+   */
+  HighsStatus getBasisInverseRows(
+      const HighsInt num_set_entries,    //!< Number of rows required
+      const HighsInt* row_set,           //!< Indices of rows required
+      std::vector<HighsInt>& row_start,  //!< Starts of rows
+      std::vector<HighsInt>& row_index,  //!< Indices of nonzeros
+      std::vector<double>& row_value     //!< Values of nonzeros
+  );
+
+  /**
+   * @brief Forms a set of rows of \f$B^{-1}A\f$ in compressed row
+   * form, with the nonzeros in each row in ascending order
+   */
+  HighsStatus getReducedRows(
+      const HighsInt num_set_entries,    //!< Number of rows required
+      const HighsInt* row_set,           //!< Indices of rows required
+      std::vector<HighsInt>& row_start,  //!< Starts of rows
+      std::vector<HighsInt>& row_index,  //!< Indices of nonzeros
+      std::vector<double>& row_value     //!< Values of nonzeros
+  );
+
   /**
    * @brief Get the number of columns in the incumbent model
    */
@@ -539,7 +629,8 @@ class Highs {
   );
 
   /**
-   * @brief writes out current basis
+   * @brief writes out current basis, in binary if the filename ends in
+   * .hbs
    */
   HighsStatus writeBasis(const std::string filename  //!< the filename
   );
@@ -891,6 +982,17 @@ class Highs {
    */
   HighsStatus setBasis();
 
+  /**
+   * @brief The next QP solve by the active set method starts from the
+   * active set and primal column values passed, typically those of a
+   * previous solve of a QP that differs only in its costs or bounds,
+   * rather than from the crash start. They are used for that solve only
+   */
+  HighsStatus setQpHotStart(
+      const HighsBasis& active_set,        //!< Active set from getQpActiveSet
+      const std::vector<double>& col_value  //!< Primal column values
+  );
+
   /**
    * @brief Gets the value of infinity used by HiGHS
    */
@@ -1051,6 +1153,11 @@ class Highs {
  private:
   HighsSolution solution_;
   HighsBasis basis_;
+  // Final active set of the last QP solve, and the active set and primal
+  // values from which the next QP solve starts, if valid
+  HighsBasis qp_active_set_;
+  HighsBasis qp_hot_start_active_set_;
+  std::vector<double> qp_hot_start_col_value_;
   HighsModel model_;
   HighsModel presolved_model_;
   //  HighsModel presolve_;
@@ -1073,6 +1180,11 @@ class Highs {
   // it's set to the correct positive number in Highs::run()
   HighsInt omp_max_threads = 0;
 
+  // Whether rows have been added to the model since it was last
+  // solved. If not, the column-wise matrix is likely to be needed
+  // next, so rows are inserted into it rather than transposing it
+  bool rows_added_since_run_ = false;
+
   // This is strictly for debugging. It's used to check whether
   // returnFromRun() was called after the previous call to
   // Highs::run() and, assuming that this is always done, it checks
@@ -1204,6 +1316,15 @@ class Highs {
                                   double* solution_vector,
                                   HighsInt* solution_num_nz,
                                   HighsInt* solution_indices, bool transpose);
+  HighsStatus basisInverseRowsInterface(const HighsInt num_set_entries,
+                                        const HighsInt* row_set,
+                                        const bool reduced,
+                                        vector<HighsInt>& row_start,
+                                        vector<HighsInt>& row_index,
+                                        vector<double>& row_value);
+  HighsStatus checkBasisInverseRowSet(const HighsInt num_set_entries,
+                                      const HighsInt* row_set,
+                                      const std::string method_name);
   void clearBasisInterface();
 
   HighsStatus getDualRayInterface(bool& has_dual_ray, double* dual_ray_value);
@@ -344,6 +344,7 @@ static HighsInt processSolve(gamshighs_t* gh) {
       break;
 
     case HighsModelStatus::kUnknown:
+    case HighsModelStatus::kInterrupt:
       // TODO is there an (feasible) solution to write?
       // gmoModelStatSet(gmo, havesol ? gmoModelStat_InfeasibleIntermed :
       // gmoModelStat_NoSolutionReturned);
@@ -61,20 +61,15 @@ static void logtomessagehandler(HighsLogType type, const char* msg,
 OsiHiGHSSolverInterface::OsiHiGHSSolverInterface()
     //  : status(HighsStatus::Init) {
     : status(HighsStatus::kOk) {
-  highsSetLogCallback(printtomessagehandler, logtomessagehandler,
-                      (void*)handler_);
+  this->highs = new Highs();
+  this->dummy_solution = new HighsSolution;
 
+  // Messages from this instance go to its message handler
+  this->highs->setLogCallback(printtomessagehandler, logtomessagehandler,
+                              (void*)handler_);
   HighsOptions& options = this->highs->options_;
   highsLogDev(options.log_options, HighsLogType::kInfo,
               "Calling OsiHiGHSSolverInterface::OsiHiGHSSolverInterface()\n");
-  this->highs = new Highs();
-  this->dummy_solution = new HighsSolution;
-
-  // Because HiGHS calls highsSetLogCallback with the options, which overwrites
-  // the previous setting
-  this->highs->options_.printmsgcb = printtomessagehandler;
-  this->highs->options_.logmsgcb = logtomessagehandler;
-  this->highs->options_.msgcb_data = (void*)handler_;
 
   setStrParam(OsiSolverName, "HiGHS");
 }
@@ -84,20 +79,15 @@ OsiHiGHSSolverInterface::OsiHiGHSSolverInterface(
     : OsiSolverInterface(original),
       //      status(HighsStatus::Init)
       status(HighsStatus::kOk) {
-  highsSetLogCallback(printtomessagehandler, logtomessagehandler,
-                      (void*)handler_);
+  this->highs = new Highs();
+  this->dummy_solution = new HighsSolution;
 
+  // Messages from this instance go to its message handler
+  this->highs->setLogCallback(printtomessagehandler, logtomessagehandler,
+                              (void*)handler_);
   HighsOptions& options = this->highs->options_;
   highsLogDev(options.log_options, HighsLogType::kInfo,
               "Calling OsiHiGHSSolverInterface::OsiHiGHSSolverInterface()\n");
-  this->highs = new Highs();
-  this->dummy_solution = new HighsSolution;
-
-  // Because HiGHS calls highsSetLogCallback with the options, whichoverwrites
-  // the previous setting
-  this->highs->options_.printmsgcb = printtomessagehandler;
-  this->highs->options_.logmsgcb = logtomessagehandler;
-  this->highs->options_.msgcb_data = (void*)handler_;
 
   this->highs->passModel(original.highs->getLp());
   setStrParam(OsiSolverName, "HiGHS");
@@ -108,8 +98,6 @@ OsiHiGHSSolverInterface::~OsiHiGHSSolverInterface() {
   highsLogDev(options.log_options, HighsLogType::kInfo,
               "Calling OsiHiGHSSolverInterface::~OsiHiGHSSolverInterface()\n");
 
-  highsSetLogCallback(NULL, NULL, NULL);
-
   delete this->highs;
 
   if (this->rowRange != NULL) {
@@ -914,14 +902,8 @@ void OsiHiGHSSolverInterface::passInMessageHandler(
     CoinMessageHandler* handler) {
   OsiSolverInterface::passInMessageHandler(handler);
 
-  highsSetLogCallback(printtomessagehandler, logtomessagehandler,
-                      (void*)handler);
-
-  // Because HiGHS calls highsSetLogCallback with the options,
-  // which overwrites the previous setting
-  this->highs->options_.printmsgcb = printtomessagehandler;
-  this->highs->options_.logmsgcb = logtomessagehandler;
-  this->highs->options_.msgcb_data = (void*)handler_;
+  this->highs->setLogCallback(printtomessagehandler, logtomessagehandler,
+                              (void*)handler_);
 }
 
 const double* OsiHiGHSSolverInterface::getColSolution() const {
@@ -34,10 +34,8 @@ HighsInt Highs_lpCall(const HighsInt numcol, const HighsInt numrow,
   status = highs.run();
 
   if (status == HighsStatus::kOk) {
-    HighsSolution solution;
-    HighsBasis basis;
-    solution = highs.getSolution();
-    basis = highs.getBasis();
+    const HighsSolution& solution = highs.getSolution();
+    const HighsBasis& basis = highs.getBasis();
     *modelstatus = (HighsInt)highs.getModelStatus();
     const HighsInfo& info = highs.getInfo();
 
@@ -89,8 +87,7 @@ HighsInt Highs_mipCall(const HighsInt numcol, const HighsInt numrow,
   status = highs.run();
 
   if (status == HighsStatus::kOk) {
-    HighsSolution solution;
-    solution = highs.getSolution();
+    const HighsSolution& solution = highs.getSolution();
     *modelstatus = (HighsInt)highs.getModelStatus();
     const HighsInfo& info = highs.getInfo();
     const bool copy_col_value =
@@ -132,10 +129,8 @@ HighsInt Highs_qpCall(
   status = highs.run();
 
   if (status == HighsStatus::kOk) {
-    HighsSolution solution;
-    HighsBasis basis;
-    solution = highs.getSolution();
-    basis = highs.getBasis();
+    const HighsSolution& solution = highs.getSolution();
+    const HighsBasis& basis = highs.getBasis();
     *modelstatus = (HighsInt)highs.getModelStatus();
     const HighsInfo& info = highs.getInfo();
 
@@ -216,6 +211,77 @@ void Highs_destroy(void* highs) { delete (Highs*)highs; }
 
 HighsInt Highs_run(void* highs) { return (HighsInt)((Highs*)highs)->run(); }
 
+HighsInt Highs_solveBatch(
+    void* highs, const HighsInt num_lp, const HighsInt* numcol,
+    const HighsInt* numrow, const HighsInt* numnz, const HighsInt sense,
+    const double* offset, const double* colcost, const double* collower,
+    const double* colupper, const double* rowlower, const double* rowupper,
+    const HighsInt* astart, const HighsInt* aindex, const double* avalue,
+    HighsInt* modelstatus, double* objective_function_value, double* colvalue,
+    double* coldual, double* rowvalue, double* rowdual) {
+  std::vector<HighsLp> lps(num_lp);
+  HighsInt col_offset = 0;
+  HighsInt row_offset = 0;
+  HighsInt nz_offset = 0;
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++) {
+    HighsLp& lp = lps[iLp];
+    const HighsInt num_col = numcol[iLp];
+    const HighsInt num_row = numrow[iLp];
+    const HighsInt num_nz = numnz[iLp];
+    lp.num_col_ = num_col;
+    lp.num_row_ = num_row;
+    lp.col_cost_.assign(colcost + col_offset, colcost + col_offset + num_col);
+    lp.col_lower_.assign(collower + col_offset,
+                         collower + col_offset + num_col);
+    lp.col_upper_.assign(colupper + col_offset,
+                         colupper + col_offset + num_col);
+    lp.row_lower_.assign(rowlower + row_offset,
+                         rowlower + row_offset + num_row);
+    lp.row_upper_.assign(rowupper + row_offset,
+                         rowupper + row_offset + num_row);
+    lp.a_start_.assign(astart + col_offset, astart + col_offset + num_col);
+    lp.a_start_.push_back(num_nz);
+    lp.a_index_.assign(aindex + nz_offset, aindex + nz_offset + num_nz);
+    lp.a_value_.assign(avalue + nz_offset, avalue + nz_offset + num_nz);
+    lp.format_ = MatrixFormat::kColwise;
+    lp.sense_ = sense == (HighsInt)ObjSense::kMaximize ? ObjSense::kMaximize
+                                                       : ObjSense::kMinimize;
+    lp.offset_ = offset != NULL ? offset[iLp] : 0;
+    col_offset += num_col;
+    row_offset += num_row;
+    nz_offset += num_nz;
+  }
+  std::vector<HighsModelStatus> model_status;
+  std::vector<HighsSolution> solution;
+  std::vector<double> objective;
+  HighsInt return_status = (HighsInt)((Highs*)highs)
+                               ->solveBatch(lps, model_status, solution,
+                                            objective);
+  col_offset = 0;
+  row_offset = 0;
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++) {
+    if (modelstatus != NULL) modelstatus[iLp] = (HighsInt)model_status[iLp];
+    if (objective_function_value != NULL)
+      objective_function_value[iLp] = objective[iLp];
+    const HighsSolution& lp_solution = solution[iLp];
+    if (colvalue != NULL && lp_solution.value_valid)
+      std::copy(lp_solution.col_value.begin(), lp_solution.col_value.end(),
+                colvalue + col_offset);
+    if (rowvalue != NULL && lp_solution.value_valid)
+      std::copy(lp_solution.row_value.begin(), lp_solution.row_value.end(),
+                rowvalue + row_offset);
+    if (coldual != NULL && lp_solution.dual_valid)
+      std::copy(lp_solution.col_dual.begin(), lp_solution.col_dual.end(),
+                coldual + col_offset);
+    if (rowdual != NULL && lp_solution.dual_valid)
+      std::copy(lp_solution.row_dual.begin(), lp_solution.row_dual.end(),
+                rowdual + row_offset);
+    col_offset += numcol[iLp];
+    row_offset += numrow[iLp];
+  }
+  return return_status;
+}
+
 HighsInt Highs_readModel(void* highs, const char* filename) {
   return (HighsInt)((Highs*)highs)->readModel(std::string(filename));
 }
@@ -273,6 +339,49 @@ HighsInt Highs_passModel(
                   astart, aindex, avalue, qstart, qindex, qvalue, integrality);
 }
 
+void* Highs_createLp(const HighsInt numcol, const HighsInt numrow,
+                     const HighsInt numnz, double** colcost, double** collower,
+                     double** colupper, double** rowlower, double** rowupper,
+                     HighsInt** astart, HighsInt** aindex, double** avalue) {
+  HighsLp* lp = new HighsLp();
+  lp->num_col_ = numcol;
+  lp->num_row_ = numrow;
+  lp->col_cost_.resize(numcol);
+  lp->col_lower_.resize(numcol);
+  lp->col_upper_.resize(numcol);
+  lp->row_lower_.resize(numrow);
+  lp->row_upper_.resize(numrow);
+  // The final start is set when the LP is passed
+  lp->a_start_.resize(numcol + 1);
+  lp->a_index_.resize(numnz);
+  lp->a_value_.resize(numnz);
+  lp->format_ = MatrixFormat::kColwise;
+  *colcost = lp->col_cost_.data();
+  *collower = lp->col_lower_.data();
+  *colupper = lp->col_upper_.data();
+  *rowlower = lp->row_lower_.data();
+  *rowupper = lp->row_upper_.data();
+  *astart = lp->a_start_.data();
+  *aindex = lp->a_index_.data();
+  *avalue = lp->a_value_.data();
+  return lp;
+}
+
+HighsInt Highs_passCreatedLp(void* highs, void* lp, const HighsInt sense,
+                             const double offset) {
+  HighsLp* created_lp = (HighsLp*)lp;
+  created_lp->a_start_[created_lp->num_col_] = created_lp->a_index_.size();
+  created_lp->sense_ = sense == (HighsInt)ObjSense::kMaximize
+                          ? ObjSense::kMaximize
+                          : ObjSense::kMinimize;
+  created_lp->offset_ = offset;
+  HighsStatus status = ((Highs*)highs)->passModel(std::move(*created_lp));
+  delete created_lp;
+  return (HighsInt)status;
+}
+
+void Highs_destroyLp(void* lp) { delete (HighsLp*)lp; }
+
 HighsInt Highs_passHessian(void* highs, const HighsInt dim,
                            const HighsInt num_nz, const HighsInt format,
                            const HighsInt* start, const HighsInt* index,
@@ -285,6 +394,13 @@ HighsInt Highs_clearModel(void* highs) {
   return (HighsInt)((Highs*)highs)->clearModel();
 }
 
+HighsInt Highs_setCallback(void* highs,
+                           HighsCallbackFunctionType user_callback,
+                           void* user_callback_data) {
+  return (HighsInt)((Highs*)highs)
+      ->setCallback(user_callback, user_callback_data);
+}
+
 HighsInt Highs_setBoolOptionValue(void* highs, const char* option,
                                   const HighsInt value) {
   return (HighsInt)((Highs*)highs)
@@ -373,7 +489,7 @@ HighsInt Highs_getDoubleInfoValue(void* highs, const char* info,
 
 HighsInt Highs_getSolution(void* highs, double* colvalue, double* coldual,
                            double* rowvalue, double* rowdual) {
-  HighsSolution solution = ((Highs*)highs)->getSolution();
+  const HighsSolution& solution = ((Highs*)highs)->getSolution();
 
   if (colvalue != NULL) {
     for (HighsInt i = 0; i < (HighsInt)solution.col_value.size(); i++) {
@@ -402,7 +518,7 @@ HighsInt Highs_getSolution(void* highs, double* colvalue, double* coldual,
 }
 
 HighsInt Highs_getBasis(void* highs, HighsInt* colstatus, HighsInt* rowstatus) {
-  HighsBasis basis = ((Highs*)highs)->getBasis();
+  const HighsBasis& basis = ((Highs*)highs)->getBasis();
   for (HighsInt i = 0; i < (HighsInt)basis.col_status.size(); i++) {
     colstatus[i] = (HighsInt)basis.col_status[i];
   }
@@ -490,6 +606,53 @@ HighsInt Highs_getReducedColumn(void* highs, const HighsInt col,
       ->getReducedColumn(col, col_vector, col_num_nz, col_indices);
 }
 
+static HighsInt copyCompressedRows(
+    const HighsStatus status, const HighsInt num_set_entries,
+    const HighsInt max_num_nz, const std::vector<HighsInt>& start,
+    const std::vector<HighsInt>& index, const std::vector<double>& value,
+    HighsInt* num_nz, HighsInt* row_start, HighsInt* row_index,
+    double* row_value) {
+  if (status == HighsStatus::kError) return (HighsInt)status;
+  *num_nz = index.size();
+  for (HighsInt ix = 0; ix <= num_set_entries; ix++) row_start[ix] = start[ix];
+  if (*num_nz > max_num_nz) return (HighsInt)HighsStatus::kWarning;
+  for (HighsInt el = 0; el < *num_nz; el++) {
+    row_index[el] = index[el];
+    row_value[el] = value[el];
+  }
+  return (HighsInt)status;
+}
+
+HighsInt Highs_getBasisInverseRows(void* highs, const HighsInt num_set_entries,
+                                   const HighsInt* row_set,
+                                   const HighsInt max_num_nz, HighsInt* num_nz,
+                                   HighsInt* row_start, HighsInt* row_index,
+                                   double* row_value) {
+  std::vector<HighsInt> start;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  HighsStatus status = ((Highs*)highs)
+                           ->getBasisInverseRows(num_set_entries, row_set,
+                                                 start, index, value);
+  return copyCompressedRows(status, num_set_entries, max_num_nz, start, index,
+                            value, num_nz, row_start, row_index, row_value);
+}
+
+HighsInt Highs_getReducedRows(void* highs, const HighsInt num_set_entries,
+                              const HighsInt* row_set,
+                              const HighsInt max_num_nz, HighsInt* num_nz,
+                              HighsInt* row_start, HighsInt* row_index,
+                              double* row_value) {
+  std::vector<HighsInt> start;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  HighsStatus status =
+      ((Highs*)highs)
+          ->getReducedRows(num_set_entries, row_set, start, index, value);
+  return copyCompressedRows(status, num_set_entries, max_num_nz, start, index,
+                            value, num_nz, row_start, row_index, row_value);
+}
+
 HighsInt Highs_setBasis(void* highs, const HighsInt* colstatus,
                         const HighsInt* rowstatus) {
   HighsBasis basis;
@@ -13,6 +13,7 @@
 #ifndef HIGHS_C_API
 #define HIGHS_C_API
 
+#include "lp_data/HighsCallbackStruct.h"
 #include "util/HighsInt.h"
 const HighsInt HighsStatuskError = -1;
 const HighsInt HighsStatuskOk = 0;
@@ -194,6 +195,42 @@ HighsInt Highs_clearModel(void* highs);
  */
 HighsInt Highs_run(void* highs);
 
+/*
+ * @brief Solves independent LPs, sharing them between threads. The LPs
+ * are held back to back, each with its matrix column-wise, and with
+ * astart and aindex relative to the LP. Solution values are returned
+ * with the same layout, and any output array may be NULL. The model in
+ * highs is not changed
+ */
+HighsInt Highs_solveBatch(
+    void* highs,
+    const HighsInt num_lp,    //!< number of LPs
+    const HighsInt* numcol,   //!< array of length [num_lp] with numbers of
+                              //!< columns
+    const HighsInt* numrow,   //!< array of length [num_lp] with numbers of
+                              //!< rows
+    const HighsInt* numnz,    //!< array of length [num_lp] with numbers of
+                              //!< matrix entries
+    const HighsInt sense,     //!< sense of the optimization
+    const double* offset,     //!< array of length [num_lp] with objective
+                              //!< constants, or NULL
+    const double* colcost,    //!< column costs
+    const double* collower,   //!< lower column bounds
+    const double* colupper,   //!< upper column bounds
+    const double* rowlower,   //!< lower row bounds
+    const double* rowupper,   //!< upper row bounds
+    const HighsInt* astart,   //!< column start indices
+    const HighsInt* aindex,   //!< row indices of matrix entries
+    const double* avalue,     //!< values of matrix entries
+    HighsInt* modelstatus,    //!< array of length [num_lp] with model status
+    double* objective_function_value,  //!< array of length [num_lp] with
+                                       //!< objective function values
+    double* colvalue,  //!< column primal values
+    double* coldual,   //!< column dual values
+    double* rowvalue,  //!< row primal values
+    double* rowdual    //!< row dual values
+);
+
 /*
  * @brief Reports the solution and basis status
  */
@@ -209,7 +246,9 @@ HighsInt Highs_writeSolutionPretty(void* highs,
 );
 
 /*
- * @brief pass an LP to HiGHS
+ * @brief pass an LP to HiGHS. The arrays are copied into HiGHS once, so
+ * they may be freed on return. A row-wise matrix is formed column-wise
+ * directly from its arrays
  */
 HighsInt Highs_passLp(
     void* highs,
@@ -301,6 +340,45 @@ HighsInt Highs_passModel(
                      //!< if model is continuous
 );
 
+/*
+ * @brief create an LP of the given dimensions, with a column-wise
+ * constraint matrix, in arrays allocated by HiGHS. The pointers to the
+ * arrays are returned so that they can be filled in place, after which
+ * Highs_passCreatedLp hands them to a HiGHS instance without copying
+ * them
+ */
+void* Highs_createLp(
+    const HighsInt numcol,  //!< number of columns
+    const HighsInt numrow,  //!< number of rows
+    const HighsInt numnz,   //!< number of entries in the constraint matrix
+    double** colcost,       //!< array of length [numcol] for column costs
+    double** collower,  //!< array of length [numcol] for lower column bounds
+    double** colupper,  //!< array of length [numcol] for upper column bounds
+    double** rowlower,  //!< array of length [numrow] for lower row bounds
+    double** rowupper,  //!< array of length [numrow] for upper row bounds
+    HighsInt** astart,  //!< array of length [numcol] for start indices
+    HighsInt** aindex,  //!< array of length [numnz] for indices of entries
+    double** avalue     //!< array of length [numnz] for values of entries
+);
+
+/*
+ * @brief pass an LP created by Highs_createLp to HiGHS, which takes
+ * ownership of its arrays. The LP and the pointers to its arrays
+ * can't be used afterwards, even if an error is returned
+ */
+HighsInt Highs_passCreatedLp(
+    void* highs,
+    void* lp,              //!< LP created by Highs_createLp
+    const HighsInt sense,  //!< sense of the optimization
+    const double offset    //!< objective constant
+);
+
+/*
+ * @brief destroy an LP created by Highs_createLp that is not passed to
+ * HiGHS
+ */
+void Highs_destroyLp(void* lp);
+
 /*
  * @brief pass a hessian to HiGHS
  */
@@ -309,6 +387,17 @@ HighsInt Highs_passHessian(void* highs, const HighsInt dim,
                            const HighsInt* start, const HighsInt* index,
                            const double* value);
 
+/*
+ * @brief Sets the callback that is passed the progress of the solver at
+ * simplex rebuilds, IPM iterations, and MIP nodes and improving
+ * solutions. A nonzero return from the callback interrupts the solve
+ */
+HighsInt Highs_setCallback(
+    void* highs,
+    HighsCallbackFunctionType user_callback,  //!< callback, or NULL
+    void* user_callback_data  //!< data passed to the callback
+);
+
 HighsInt Highs_setBoolOptionValue(void* highs,
                                   const char* option,   //!< name of the option
                                   const HighsInt value  //!< new value of option
@@ -524,6 +613,39 @@ HighsInt Highs_getReducedColumn(
     HighsInt* col_indices  //!< Indices of nonzeros
 );
 
+/**
+ * @brief Gets a set of rows of \f$B^{-1}\f$ for basis matrix
+ * \f$B\f$ in compressed row form. If there are more than max_num_nz
+ * nonzeros, only num_nz and row_start are assigned, and a warning is
+ * returned
+ */
+HighsInt Highs_getBasisInverseRows(
+    void* highs,
+    const HighsInt num_set_entries,  //!< Number of rows required
+    const HighsInt* row_set,         //!< Indices of rows required
+    const HighsInt max_num_nz,       //!< Space in row_index and row_value
+    HighsInt* num_nz,                //!< Number of nonzeros
+    HighsInt* row_start,             //!< Starts of rows
+    HighsInt* row_index,             //!< Indices of nonzeros
+    double* row_value                //!< Values of nonzeros
+);
+
+/**
+ * @brief Forms a set of rows of \f$B^{-1}A\f$ in compressed row
+ * form. If there are more than max_num_nz nonzeros, only num_nz and
+ * row_start are assigned, and a warning is returned
+ */
+HighsInt Highs_getReducedRows(
+    void* highs,
+    const HighsInt num_set_entries,  //!< Number of rows required
+    const HighsInt* row_set,         //!< Indices of rows required
+    const HighsInt max_num_nz,       //!< Space in row_index and row_value
+    HighsInt* num_nz,                //!< Number of nonzeros
+    HighsInt* row_start,             //!< Starts of rows
+    HighsInt* row_index,             //!< Indices of nonzeros
+    double* row_value                //!< Values of nonzeros
+);
+
 /**
  * @brief Passes a basis to HiGHS
  */
@@ -43,7 +43,8 @@ public enum HighsModelStatus
   kObjectiveTarget,
   kTimeLimit,
   kIterationLimit,
-  kUnknown
+  kUnknown,
+  kInterrupt
 }
 
 public class HighsModel
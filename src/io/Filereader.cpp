@@ -13,10 +13,12 @@
 
 #include "io/Filereader.h"
 
+#include "io/FilereaderBinary.h"
 #include "io/FilereaderEms.h"
 #include "io/FilereaderLp.h"
 #include "io/FilereaderMps.h"
 #include "io/HighsIO.h"
+#include "io/HighsInputStream.h"
 
 static const std::string getFilenameExt(const std::string filename) {
   // Extract file name extension
@@ -32,13 +34,22 @@ static const std::string getFilenameExt(const std::string filename) {
 
 Filereader* Filereader::getFilereader(const std::string filename) {
   Filereader* reader;
-  const std::string extension = getFilenameExt(filename);
-  if (extension.compare("mps") == 0) {
+  // The extension of a compressed file is that of the file it holds
+  const bool compressed = isCompressedFilename(filename);
+  const std::string extension = getFilenameExt(uncompressedFilename(filename));
+  if (compressed && !canReadCompressedFile()) {
+    reader = NULL;
+  } else if (extension.compare("mps") == 0) {
     reader = new FilereaderMps();
   } else if (extension.compare("lp") == 0) {
     reader = new FilereaderLp();
+  } else if (compressed) {
+    // Only MPS and LP files are read through HighsInputStream
+    reader = NULL;
   } else if (extension.compare("ems") == 0) {
     reader = new FilereaderEms();
+  } else if (extension.compare("hbm") == 0) {
+    reader = new FilereaderBinary();
   } else {
     reader = NULL;
   }
@@ -72,7 +83,7 @@ void interpretFilereaderRetcode(const HighsLogOptions& log_options,
 
 std::string extractModelName(const std::string filename) {
   // Extract model name
-  std::string name = filename;
+  std::string name = uncompressedFilename(filename);
   std::size_t found = name.find_last_of("/\\");
   if (found < name.size()) name = name.substr(found + 1);
   found = name.find_last_of(".");
@@ -17,6 +17,7 @@
 #define IO_FILEREADER_H_
 
 #include "io/HighsIO.h"
+#include "lp_data/HStruct.h"
 #include "lp_data/HighsOptions.h"
 #include "model/HighsModel.h"
 
@@ -41,6 +42,20 @@ class Filereader {
   virtual HighsStatus writeModelToFile(const HighsOptions& options,
                                        const std::string filename,
                                        const HighsModel& model) = 0;
+  // Only formats that can hold a basis with the model override these
+  // methods, so by default the basis is neither read nor written
+  virtual FilereaderRetcode readModelAndBasisFromFile(
+      const HighsOptions& options, const std::string filename,
+      HighsModel& model, HighsBasis& basis) {
+    basis.valid = false;
+    return readModelFromFile(options, filename, model);
+  }
+  virtual HighsStatus writeModelAndBasisToFile(const HighsOptions& options,
+                                               const std::string filename,
+                                               const HighsModel& model,
+                                               const HighsBasis& /*basis*/) {
+    return writeModelToFile(options, filename, model);
+  }
   static Filereader* getFilereader(const std::string filename);
 
   virtual ~Filereader(){};
@@ -0,0 +1,583 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderBinary.cpp
+ * @brief
+ */
+
+#include "io/FilereaderBinary.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "lp_data/HighsLpUtils.h"
+
+const char kBinaryModelMagic[8] = {'H', 'i', 'G', 'H', 'S', 'B', 'I', 'N'};
+const uint32_t kBinaryModelByteOrder = 0x01020304;
+const uint32_t kBinaryModelHasIntegrality = 1;
+const uint32_t kBinaryModelHasHessian = 2;
+const uint32_t kBinaryModelHasNames = 4;
+const uint32_t kBinaryModelHasBasis = 8;
+
+struct BinaryModelHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t int_size;
+  uint32_t double_size;
+  uint32_t byte_order;
+  int64_t num_col;
+  int64_t num_row;
+  int64_t num_nz;
+  int64_t hessian_dim;
+  int64_t hessian_num_nz;
+  int64_t name_table_size;
+  int32_t sense;
+  uint32_t flags;
+  double offset;
+};
+
+static int64_t alignedSize(const int64_t size) { return (size + 7) & ~7; }
+
+// Offsets of the sections in a snapshot, as determined from its header
+struct BinaryModelLayout {
+  int64_t a_start;
+  int64_t a_index;
+  int64_t a_value;
+  int64_t col_cost;
+  int64_t col_lower;
+  int64_t col_upper;
+  int64_t row_lower;
+  int64_t row_upper;
+  int64_t integrality;
+  int64_t q_start;
+  int64_t q_index;
+  int64_t q_value;
+  int64_t name_table;
+  int64_t col_status;
+  int64_t row_status;
+  int64_t file_size;
+};
+
+static BinaryModelLayout binaryModelLayout(const BinaryModelHeader& header) {
+  const int64_t int_size = header.int_size;
+  const int64_t double_size = header.double_size;
+  const int64_t num_col = header.num_col;
+  const int64_t num_row = header.num_row;
+  BinaryModelLayout layout;
+  int64_t offset = alignedSize(sizeof(BinaryModelHeader));
+  auto section = [&offset](const int64_t size) {
+    const int64_t section_offset = offset;
+    offset += alignedSize(size);
+    return section_offset;
+  };
+  layout.a_start = section((num_col + 1) * int_size);
+  layout.a_index = section(header.num_nz * int_size);
+  layout.a_value = section(header.num_nz * double_size);
+  layout.col_cost = section(num_col * double_size);
+  layout.col_lower = section(num_col * double_size);
+  layout.col_upper = section(num_col * double_size);
+  layout.row_lower = section(num_row * double_size);
+  layout.row_upper = section(num_row * double_size);
+  const bool has_integrality = header.flags & kBinaryModelHasIntegrality;
+  layout.integrality = section(has_integrality ? num_col : 0);
+  const bool has_hessian = header.flags & kBinaryModelHasHessian;
+  layout.q_start = section(has_hessian ? (header.hessian_dim + 1) * int_size
+                                       : 0);
+  layout.q_index = section(header.hessian_num_nz * int_size);
+  layout.q_value = section(header.hessian_num_nz * double_size);
+  layout.name_table = section(header.name_table_size);
+  const bool has_basis = header.flags & kBinaryModelHasBasis;
+  layout.col_status = section(has_basis ? num_col : 0);
+  layout.row_status = section(has_basis ? num_row : 0);
+  layout.file_size = offset;
+  return layout;
+}
+
+// Maps a file read-only into memory, falling back to reading it into a
+// buffer where mmap is not available
+class BinaryModelFile {
+ public:
+  bool open(const std::string filename) {
+#if defined(_WIN32)
+    std::ifstream f(filename, std::ios::in | std::ios::binary);
+    if (!f.is_open()) return false;
+    f.seekg(0, std::ios::end);
+    size_ = f.tellg();
+    f.seekg(0, std::ios::beg);
+    buffer_.resize(size_);
+    if (size_ > 0) f.read(&buffer_[0], size_);
+    data_ = buffer_.data();
+    return (bool)f;
+#else
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+      ::close(fd);
+      return false;
+    }
+    size_ = file_stat.st_size;
+    if (size_ > 0) {
+      void* map = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        ::close(fd);
+        return false;
+      }
+      data_ = (const char*)map;
+    }
+    ::close(fd);
+    return true;
+#endif
+  }
+  ~BinaryModelFile() {
+#if !defined(_WIN32)
+    if (data_ != NULL) munmap((void*)data_, size_);
+#endif
+  }
+  const char* data() const { return data_; }
+  int64_t size() const { return size_; }
+
+ private:
+  const char* data_ = NULL;
+  int64_t size_ = 0;
+#if defined(_WIN32)
+  std::vector<char> buffer_;
+#endif
+};
+
+template <typename T>
+static void copySection(const char* data, const int64_t offset,
+                        const int64_t count, std::vector<T>& vec) {
+  const T* section = (const T*)(data + offset);
+  vec.assign(section, section + count);
+}
+
+// Copies basis status bytes, returning false if any of them isn't a
+// HighsBasisStatus value
+static bool copyBasisStatus(const uint8_t* section, const HighsInt count,
+                            std::vector<HighsBasisStatus>& status) {
+  status.resize(count);
+  for (HighsInt i = 0; i < count; i++) {
+    if (section[i] > (uint8_t)HighsBasisStatus::kNonbasic) return false;
+    status[i] = (HighsBasisStatus)section[i];
+  }
+  return true;
+}
+
+FilereaderRetcode FilereaderBinary::readModelFromFile(
+    const HighsOptions& options, const std::string filename,
+    HighsModel& model) {
+  HighsBasis basis;
+  return readModelAndBasisFromFile(options, filename, model, basis);
+}
+
+FilereaderRetcode FilereaderBinary::readModelAndBasisFromFile(
+    const HighsOptions& options, const std::string filename,
+    HighsModel& model, HighsBasis& basis) {
+  basis.valid = false;
+  BinaryModelFile file;
+  if (!file.open(filename)) return FilereaderRetcode::kFileNotFound;
+  const char* data = file.data();
+  if ((size_t)file.size() < sizeof(BinaryModelHeader) ||
+      memcmp(data, kBinaryModelMagic, sizeof(kBinaryModelMagic)) != 0) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "File %s is not a HiGHS binary model\n", filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  BinaryModelHeader header;
+  memcpy(&header, data, sizeof(BinaryModelHeader));
+  if (header.version != kBinaryModelVersion) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model has version %d rather than %d\n",
+                 (int)header.version, (int)kBinaryModelVersion);
+    return FilereaderRetcode::kParserError;
+  }
+  if (header.int_size != sizeof(HighsInt) ||
+      header.double_size != sizeof(double) ||
+      header.byte_order != kBinaryModelByteOrder) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model was written with %d-byte integers "
+                 "and different byte order or floating-point size\n",
+                 (int)header.int_size);
+    return FilereaderRetcode::kParserError;
+  }
+  // Bound the counts by the file size before using them to compute the
+  // layout, so that a corrupt header can't cause overflow
+  const int64_t file_size = file.size();
+  auto countOk = [file_size](const int64_t count) {
+    return count >= 0 && count <= file_size;
+  };
+  if (!countOk(header.num_col) || !countOk(header.num_row) ||
+      !countOk(header.num_nz) || !countOk(header.hessian_dim) ||
+      !countOk(header.hessian_num_nz) || !countOk(header.name_table_size) ||
+      binaryModelLayout(header).file_size > file_size) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model is truncated or corrupt\n");
+    return FilereaderRetcode::kParserError;
+  }
+  const BinaryModelLayout layout = binaryModelLayout(header);
+  const HighsInt num_col = header.num_col;
+  const HighsInt num_row = header.num_row;
+  const HighsInt num_nz = header.num_nz;
+
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.format_ = MatrixFormat::kColwise;
+  lp.sense_ = header.sense < 0 ? ObjSense::kMaximize : ObjSense::kMinimize;
+  lp.offset_ = header.offset;
+  copySection(data, layout.a_start, num_col + 1, lp.a_start_);
+  if (lp.a_start_[0] != 0 || lp.a_start_[num_col] != num_nz) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model has inconsistent matrix starts\n");
+    return FilereaderRetcode::kParserError;
+  }
+  copySection(data, layout.a_index, num_nz, lp.a_index_);
+  copySection(data, layout.a_value, num_nz, lp.a_value_);
+  copySection(data, layout.col_cost, num_col, lp.col_cost_);
+  copySection(data, layout.col_lower, num_col, lp.col_lower_);
+  copySection(data, layout.col_upper, num_col, lp.col_upper_);
+  copySection(data, layout.row_lower, num_row, lp.row_lower_);
+  copySection(data, layout.row_upper, num_row, lp.row_upper_);
+  if (header.flags & kBinaryModelHasIntegrality)
+    copySection(data, layout.integrality, num_col, lp.integrality_);
+
+  if (header.flags & kBinaryModelHasHessian) {
+    HighsHessian& hessian = model.hessian_;
+    hessian.dim_ = header.hessian_dim;
+    hessian.format_ = HessianFormat::kTriangular;
+    copySection(data, layout.q_start, hessian.dim_ + 1, hessian.q_start_);
+    copySection(data, layout.q_index, header.hessian_num_nz,
+                hessian.q_index_);
+    copySection(data, layout.q_value, header.hessian_num_nz,
+                hessian.q_value_);
+  }
+
+  if (header.flags & kBinaryModelHasNames) {
+    // The table holds 1+num_col+num_row NUL-terminated strings
+    const char* name = data + layout.name_table;
+    const char* end = name + header.name_table_size;
+    auto nextName = [&name, end](std::string& value) {
+      const char* terminator = (const char*)memchr(name, '\0', end - name);
+      if (terminator == NULL) return false;
+      value.assign(name, terminator - name);
+      name = terminator + 1;
+      return true;
+    };
+    bool names_ok = nextName(lp.model_name_);
+    lp.col_names_.resize(num_col);
+    lp.row_names_.resize(num_row);
+    for (HighsInt iCol = 0; names_ok && iCol < num_col; iCol++)
+      names_ok = nextName(lp.col_names_[iCol]);
+    for (HighsInt iRow = 0; names_ok && iRow < num_row; iRow++)
+      names_ok = nextName(lp.row_names_[iRow]);
+    if (!names_ok) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "HiGHS binary model has a corrupt name table\n");
+      return FilereaderRetcode::kParserError;
+    }
+  }
+
+  if (header.flags & kBinaryModelHasBasis) {
+    const uint8_t* col_status = (const uint8_t*)(data + layout.col_status);
+    const uint8_t* row_status = (const uint8_t*)(data + layout.row_status);
+    if (!copyBasisStatus(col_status, num_col, basis.col_status) ||
+        !copyBasisStatus(row_status, num_row, basis.row_status)) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "HiGHS binary model has an illegal basis status\n");
+      return FilereaderRetcode::kParserError;
+    }
+    basis.valid = true;
+  }
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderBinary::writeModelToFile(const HighsOptions& options,
+                                               const std::string filename,
+                                               const HighsModel& model) {
+  HighsBasis basis;
+  return writeModelAndBasisToFile(options, filename, model, basis);
+}
+
+template <typename T>
+static void writeSection(std::ofstream& f, const T* values,
+                         const int64_t count) {
+  const int64_t size = count * sizeof(T);
+  if (size > 0) f.write((const char*)values, size);
+  const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  f.write(padding, alignedSize(size) - size);
+}
+
+HighsStatus FilereaderBinary::writeModelAndBasisToFile(
+    const HighsOptions& options, const std::string filename,
+    const HighsModel& model, const HighsBasis& basis) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  assert(lp.format_ != MatrixFormat::kRowwise);
+  if (hessian.dim_ && hessian.format_ != HessianFormat::kTriangular) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS binary model requires a triangular Hessian\n");
+    return HighsStatus::kError;
+  }
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt num_nz = num_col ? lp.a_start_[num_col] : 0;
+  const bool has_names = (HighsInt)lp.col_names_.size() == num_col &&
+                         (HighsInt)lp.row_names_.size() == num_row &&
+                         num_col + num_row > 0;
+  std::string name_table;
+  if (has_names) {
+    name_table.append(lp.model_name_).push_back('\0');
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      name_table.append(lp.col_names_[iCol]).push_back('\0');
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      name_table.append(lp.row_names_[iRow]).push_back('\0');
+  }
+
+  BinaryModelHeader header;
+  memset(&header, 0, sizeof(BinaryModelHeader));
+  memcpy(header.magic, kBinaryModelMagic, sizeof(kBinaryModelMagic));
+  header.version = kBinaryModelVersion;
+  header.int_size = sizeof(HighsInt);
+  header.double_size = sizeof(double);
+  header.byte_order = kBinaryModelByteOrder;
+  header.num_col = num_col;
+  header.num_row = num_row;
+  header.num_nz = num_nz;
+  header.sense = (int32_t)lp.sense_;
+  header.offset = lp.offset_;
+  header.flags = 0;
+  if ((HighsInt)lp.integrality_.size() == num_col && num_col > 0)
+    header.flags |= kBinaryModelHasIntegrality;
+  if (hessian.dim_) {
+    header.flags |= kBinaryModelHasHessian;
+    header.hessian_dim = hessian.dim_;
+    header.hessian_num_nz = hessian.q_start_[hessian.dim_];
+  }
+  if (has_names) {
+    header.flags |= kBinaryModelHasNames;
+    header.name_table_size = name_table.size();
+  }
+  if (basis.valid) header.flags |= kBinaryModelHasBasis;
+
+  std::ofstream f(filename, std::ios::out | std::ios::binary);
+  if (!f.is_open()) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  writeSection(f, &header, 1);
+  const HighsInt zero_start = 0;
+  writeSection(f, num_col ? lp.a_start_.data() : &zero_start, num_col + 1);
+  writeSection(f, lp.a_index_.data(), num_nz);
+  writeSection(f, lp.a_value_.data(), num_nz);
+  writeSection(f, lp.col_cost_.data(), num_col);
+  writeSection(f, lp.col_lower_.data(), num_col);
+  writeSection(f, lp.col_upper_.data(), num_col);
+  writeSection(f, lp.row_lower_.data(), num_row);
+  writeSection(f, lp.row_upper_.data(), num_row);
+  if (header.flags & kBinaryModelHasIntegrality)
+    writeSection(f, lp.integrality_.data(), num_col);
+  if (header.flags & kBinaryModelHasHessian) {
+    writeSection(f, hessian.q_start_.data(), hessian.dim_ + 1);
+    writeSection(f, hessian.q_index_.data(), header.hessian_num_nz);
+    writeSection(f, hessian.q_value_.data(), header.hessian_num_nz);
+  }
+  if (has_names) writeSection(f, name_table.data(), name_table.size());
+  if (basis.valid) {
+    std::vector<uint8_t> status(num_col);
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      status[iCol] = (uint8_t)basis.col_status[iCol];
+    writeSection(f, status.data(), num_col);
+    status.resize(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      status[iRow] = (uint8_t)basis.row_status[iRow];
+    writeSection(f, status.data(), num_row);
+  }
+  // Close the file so that any failure to flush it is detected
+  f.close();
+  if (!f) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing HiGHS binary model to %s\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
+
+const char kBinarySolutionMagic[8] = {'H', 'i', 'G', 'H', 'S', 'S', 'O', 'L'};
+const uint32_t kBinarySolutionHasValue = 1;
+const uint32_t kBinarySolutionHasDual = 2;
+const uint32_t kBinarySolutionHasBasis = 4;
+
+struct BinarySolutionHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t double_size;
+  uint32_t byte_order;
+  uint32_t flags;
+  int64_t num_col;
+  int64_t num_row;
+};
+
+// Size of a solution file with the given header
+static int64_t binarySolutionFileSize(const BinarySolutionHeader& header) {
+  const int64_t num_col = header.num_col;
+  const int64_t num_row = header.num_row;
+  const int64_t values_size = alignedSize(num_col * header.double_size) +
+                              alignedSize(num_row * header.double_size);
+  int64_t size = alignedSize(sizeof(BinarySolutionHeader));
+  if (header.flags & kBinarySolutionHasValue) size += values_size;
+  if (header.flags & kBinarySolutionHasDual) size += values_size;
+  if (header.flags & kBinarySolutionHasBasis)
+    size += alignedSize(num_col) + alignedSize(num_row);
+  return size;
+}
+
+bool isBinarySolutionFilename(const std::string& filename) {
+  const std::size_t ext_size = kBinarySolutionFilenameExt.size();
+  return filename.size() > ext_size &&
+         filename.compare(filename.size() - ext_size, ext_size,
+                          kBinarySolutionFilenameExt) == 0;
+}
+
+HighsStatus writeBinarySolutionFile(const HighsLogOptions& log_options,
+                                    const std::string filename,
+                                    const HighsInt num_col,
+                                    const HighsInt num_row,
+                                    const HighsSolution& solution,
+                                    const HighsBasis& basis) {
+  BinarySolutionHeader header;
+  memset(&header, 0, sizeof(BinarySolutionHeader));
+  memcpy(header.magic, kBinarySolutionMagic, sizeof(kBinarySolutionMagic));
+  header.version = kBinarySolutionVersion;
+  header.double_size = sizeof(double);
+  header.byte_order = kBinaryModelByteOrder;
+  header.num_col = num_col;
+  header.num_row = num_row;
+  if (solution.value_valid) header.flags |= kBinarySolutionHasValue;
+  if (solution.dual_valid) header.flags |= kBinarySolutionHasDual;
+  if (basis.valid) header.flags |= kBinarySolutionHasBasis;
+
+  std::ofstream f(filename, std::ios::out | std::ios::binary);
+  if (!f.is_open()) {
+    highsLogUser(log_options, HighsLogType::kError, "Cannot open file %s\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  writeSection(f, &header, 1);
+  if (solution.value_valid) {
+    writeSection(f, solution.col_value.data(), num_col);
+    writeSection(f, solution.row_value.data(), num_row);
+  }
+  if (solution.dual_valid) {
+    writeSection(f, solution.col_dual.data(), num_col);
+    writeSection(f, solution.row_dual.data(), num_row);
+  }
+  if (basis.valid) {
+    std::vector<uint8_t> status(num_col);
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      status[iCol] = (uint8_t)basis.col_status[iCol];
+    writeSection(f, status.data(), num_col);
+    status.resize(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      status[iRow] = (uint8_t)basis.row_status[iRow];
+    writeSection(f, status.data(), num_row);
+  }
+  // Close the file so that any failure to flush it is detected
+  f.close();
+  if (!f) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Error writing HiGHS binary solution to %s\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
+
+HighsStatus readBinarySolutionFile(const HighsLogOptions& log_options,
+                                   const std::string filename,
+                                   const HighsInt num_col,
+                                   const HighsInt num_row,
+                                   HighsSolution& solution, HighsBasis& basis) {
+  BinaryModelFile file;
+  if (!file.open(filename)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Cannot open readable file \"%s\"\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  const char* data = file.data();
+  if ((size_t)file.size() < sizeof(BinarySolutionHeader) ||
+      memcmp(data, kBinarySolutionMagic, sizeof(kBinarySolutionMagic)) != 0) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "File %s is not a HiGHS binary solution\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  BinarySolutionHeader header;
+  memcpy(&header, data, sizeof(BinarySolutionHeader));
+  if (header.version != kBinarySolutionVersion ||
+      header.double_size != sizeof(double) ||
+      header.byte_order != kBinaryModelByteOrder) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary solution has version %d rather than %d, or "
+                 "different byte order or floating-point size\n",
+                 (int)header.version, (int)kBinarySolutionVersion);
+    return HighsStatus::kError;
+  }
+  if (header.num_col != num_col || header.num_row != num_row) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary solution is for %" PRId64 " columns and %" PRId64
+                 " rows, not %" HIGHSINT_FORMAT " and %" HIGHSINT_FORMAT "\n",
+                 header.num_col, header.num_row, num_col, num_row);
+    return HighsStatus::kError;
+  }
+  if (binarySolutionFileSize(header) > file.size()) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary solution is truncated or corrupt\n");
+    return HighsStatus::kError;
+  }
+  int64_t offset = alignedSize(sizeof(BinarySolutionHeader));
+  auto readValues = [&](std::vector<double>& col_values,
+                        std::vector<double>& row_values) {
+    copySection(data, offset, num_col, col_values);
+    offset += alignedSize(num_col * sizeof(double));
+    copySection(data, offset, num_row, row_values);
+    offset += alignedSize(num_row * sizeof(double));
+  };
+  solution.value_valid = header.flags & kBinarySolutionHasValue;
+  if (solution.value_valid) readValues(solution.col_value, solution.row_value);
+  solution.dual_valid = header.flags & kBinarySolutionHasDual;
+  if (solution.dual_valid) readValues(solution.col_dual, solution.row_dual);
+  basis.valid = header.flags & kBinarySolutionHasBasis;
+  if (basis.valid) {
+    const uint8_t* col_status = (const uint8_t*)(data + offset);
+    const uint8_t* row_status = col_status + alignedSize(num_col);
+    if (!copyBasisStatus(col_status, num_col, basis.col_status) ||
+        !copyBasisStatus(row_status, num_row, basis.row_status)) {
+      basis.valid = false;
+      highsLogUser(log_options, HighsLogType::kError,
+                   "HiGHS binary solution has an illegal basis status\n");
+      return HighsStatus::kError;
+    }
+  }
+  return HighsStatus::kOk;
+}
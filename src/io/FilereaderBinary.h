@@ -0,0 +1,77 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderBinary.h
+ * @brief Reader and writer for binary model snapshots (.hbm files)
+ *
+ * A snapshot is a fixed header followed by the model arrays exactly as
+ * they are held in memory, each starting on an 8-byte boundary:
+ *
+ *   a_start_, a_index_, a_value_ (column-wise), col_cost_, col_lower_,
+ *   col_upper_, row_lower_, row_upper_, then if flagged in the header:
+ *   integrality_, the Hessian q_start_, q_index_, q_value_, the names
+ *   (model, columns then rows) as a table of NUL-terminated strings, and
+ *   the column then row basis status as one byte each.
+ *
+ * The file is mapped into memory and each array is copied in bulk, so
+ * there is no per-element parsing. Snapshots are only read by builds
+ * with the same HighsInt size and byte order as the build that wrote
+ * them.
+ */
+
+#ifndef IO_FILEREADER_BINARY_H_
+#define IO_FILEREADER_BINARY_H_
+
+#include "io/Filereader.h"
+#include "io/HighsIO.h"  // For messages.
+
+const uint32_t kBinaryModelVersion = 1;
+const uint32_t kBinarySolutionVersion = 1;
+const std::string kBinarySolutionFilenameExt = ".hbs";
+
+class FilereaderBinary : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+  FilereaderRetcode readModelAndBasisFromFile(const HighsOptions& options,
+                                              const std::string filename,
+                                              HighsModel& model,
+                                              HighsBasis& basis);
+  HighsStatus writeModelAndBasisToFile(const HighsOptions& options,
+                                       const std::string filename,
+                                       const HighsModel& model,
+                                       const HighsBasis& basis);
+};
+
+bool isBinarySolutionFilename(const std::string& filename);
+
+// Writes the parts of the solution and basis that are valid
+HighsStatus writeBinarySolutionFile(const HighsLogOptions& log_options,
+                                    const std::string filename,
+                                    const HighsInt num_col,
+                                    const HighsInt num_row,
+                                    const HighsSolution& solution,
+                                    const HighsBasis& basis);
+
+// Reads the parts of the solution and basis that are in the file,
+// returning an error if it is not for num_col columns and num_row rows
+HighsStatus readBinarySolutionFile(const HighsLogOptions& log_options,
+                                   const std::string filename,
+                                   const HighsInt num_col,
+                                   const HighsInt num_row,
+                                   HighsSolution& solution, HighsBasis& basis);
+
+#endif
@@ -16,11 +16,12 @@
 
 #include "io/FilereaderLp.h"
 
-#include <cstdarg>
 #include <exception>
-#include <map>
+#include <vector>
 
 #include "../extern/filereaderlp/reader.hpp"
+#include "io/HighsInputStream.h"
+#include "io/HighsOutputBuffer.h"
 #include "lp_data/HighsLpUtils.h"
 
 FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
@@ -28,94 +29,69 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
                                                   HighsModel& model) {
   HighsLp& lp = model.lp_;
   HighsHessian& hessian = model.hessian_;
+  // Compressed files are decompressed while they are parsed
+  HighsInputStream stream(filename);
+  if (!stream.is_open()) return FilereaderRetcode::kFileNotFound;
   try {
-    Model m = readinstance(filename);
+    Model m = readinstance(stream);
+    if (stream.bad()) return FilereaderRetcode::kParserError;
 
-    // build variable index and gather variable information
-    std::map<std::string, unsigned int> varindex;
-
-    lp.num_col_ = m.variables.size();
-    lp.num_row_ = m.constraints.size();
-    for (HighsUInt i = 0; i < m.variables.size(); i++) {
-      varindex[m.variables[i]->name] = i;
-      lp.col_lower_.push_back(m.variables[i]->lowerbound);
-      lp.col_upper_.push_back(m.variables[i]->upperbound);
-      lp.col_names_.push_back(m.variables[i]->name);
-    }
+    lp.num_col_ = m.numvariables();
+    lp.num_row_ = m.numconstraints();
+    lp.col_lower_ = std::move(m.variablelowerbound);
+    lp.col_upper_ = std::move(m.variableupperbound);
+    lp.col_names_.resize(lp.num_col_);
+    for (HighsInt i = 0; i < lp.num_col_; i++)
+      lp.col_names_[i] = m.variablename(i);
 
     // get objective
-    if (m.objective->offset) {
+    if (m.objectiveoffset) {
       highsLogUser(options.log_options, HighsLogType::kWarning,
-                   "Ignoring m.objective->offset = %g\n", m.objective->offset);
-      lp.offset_ = 0;  // m.objective->offset;
-    }
-    lp.col_cost_.resize(lp.num_col_, 0.0);
-    for (HighsUInt i = 0; i < m.objective->linterms.size(); i++) {
-      std::shared_ptr<LinTerm> lt = m.objective->linterms[i];
-      lp.col_cost_[varindex[lt->var->name]] = lt->coef;
+                   "Ignoring m.objectiveoffset = %g\n", m.objectiveoffset);
+      lp.offset_ = 0;  // m.objectiveoffset;
     }
+    lp.col_cost_.assign(lp.num_col_, 0.0);
+    for (const LinTerm& lt : m.objectivelinterms)
+      lp.col_cost_[lt.var] += lt.coef;
 
-    std::map<std::shared_ptr<Variable>, std::vector<std::shared_ptr<Variable>>>
-        mat;
-    std::map<std::shared_ptr<Variable>, std::vector<double>> mat2;
-    for (std::shared_ptr<QuadTerm> qt : m.objective->quadterms) {
-      if (qt->var1 != qt->var2) {
-        mat[qt->var1].push_back(qt->var2);
-        mat2[qt->var1].push_back(qt->coef / 2);
-        mat[qt->var2].push_back(qt->var1);
-        mat2[qt->var2].push_back(qt->coef / 2);
+    // Form the square Hessian column by column, with the entries of
+    // each column in the order that they are read
+    std::vector<HighsInt> q_length(lp.num_col_, 0);
+    for (const QuadTerm& qt : m.objectivequadterms) {
+      q_length[qt.var1]++;
+      if (qt.var1 != qt.var2) {
+        q_length[qt.var2]++;
       } else {
-        mat[qt->var1].push_back(qt->var2);
-        mat2[qt->var1].push_back(qt->coef);
         hessian.dim_++;
       }
     }
-
-    unsigned int qnnz = 0;
-    for (std::shared_ptr<Variable> var : m.variables) {
-      hessian.q_start_.push_back(qnnz);
-
-      for (unsigned int i = 0; i < mat[var].size(); i++) {
-        hessian.q_index_.push_back(varindex[mat[var][i]->name]);
-        hessian.q_value_.push_back(mat2[var][i]);
-        qnnz++;
+    hessian.q_start_.resize(lp.num_col_ + 1);
+    hessian.q_start_[0] = 0;
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+      hessian.q_start_[iCol + 1] = hessian.q_start_[iCol] + q_length[iCol];
+    hessian.q_index_.resize(hessian.q_start_[lp.num_col_]);
+    hessian.q_value_.resize(hessian.q_start_[lp.num_col_]);
+    std::vector<HighsInt> q_next(hessian.q_start_.begin(),
+                                 hessian.q_start_.end() - 1);
+    for (const QuadTerm& qt : m.objectivequadterms) {
+      const double value = qt.var1 != qt.var2 ? qt.coef / 2 : qt.coef;
+      hessian.q_index_[q_next[qt.var1]] = qt.var2;
+      hessian.q_value_[q_next[qt.var1]++] = value;
+      if (qt.var1 != qt.var2) {
+        hessian.q_index_[q_next[qt.var2]] = qt.var1;
+        hessian.q_value_[q_next[qt.var2]++] = value;
       }
     }
-    hessian.q_start_.push_back(qnnz);
     hessian.format_ = HessianFormat::kSquare;
 
-    // handle constraints
-    std::map<std::shared_ptr<Variable>, std::vector<unsigned int>>
-        consofvarmap_index;
-    std::map<std::shared_ptr<Variable>, std::vector<double>> consofvarmap_value;
-    for (HighsUInt i = 0; i < m.constraints.size(); i++) {
-      std::shared_ptr<Constraint> con = m.constraints[i];
-      for (HighsUInt j = 0; j < con->expr->linterms.size(); j++) {
-        std::shared_ptr<LinTerm> lt = con->expr->linterms[j];
-        if (consofvarmap_index.count(lt->var) == 0) {
-          consofvarmap_index[lt->var] = std::vector<unsigned int>();
-          consofvarmap_value[lt->var] = std::vector<double>();
-        }
-        consofvarmap_index[lt->var].push_back(i);
-        consofvarmap_value[lt->var].push_back(lt->coef);
-      }
-
-      lp.row_lower_.push_back(con->lowerbound);
-      lp.row_upper_.push_back(con->upperbound);
-    }
-
-    HighsInt nz = 0;
-    for (HighsInt i = 0; i < lp.num_col_; i++) {
-      std::shared_ptr<Variable> var = m.variables[i];
-      lp.a_start_.push_back(nz);
-      for (HighsUInt j = 0; j < consofvarmap_index[var].size(); j++) {
-        lp.a_index_.push_back(consofvarmap_index[var][j]);
-        lp.a_value_.push_back(consofvarmap_value[var][j]);
-        nz++;
-      }
-    }
-    lp.a_start_.push_back(nz);
-    lp.format_ = MatrixFormat::kColwise;
+    // The constraints are read row-wise, and the matrix is made
+    // column-wise by setFormat
+    lp.row_lower_ = std::move(m.constraintlowerbound);
+    lp.row_upper_ = std::move(m.constraintupperbound);
+    lp.a_start_.assign(m.constraintstart.begin(), m.constraintstart.end());
+    lp.a_index_.assign(m.constraintindex.begin(), m.constraintindex.end());
+    lp.a_value_ = std::move(m.constraintvalue);
+    lp.format_ = MatrixFormat::kRowwise;
     lp.sense_ = m.sense == ObjectiveSense::MIN ? ObjSense::kMinimize
                                                : ObjSense::kMaximize;
   } catch (std::invalid_argument& ex) {
@@ -125,25 +101,39 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
   return FilereaderRetcode::kOk;
 }
 
-void FilereaderLp::writeToFile(FILE* file, const char* format, ...) {
-  va_list argptr;
-  va_start(argptr, format);
-  char stringbuffer[LP_MAX_LINE_LENGTH + 1];
-  HighsInt tokenlength = vsprintf(stringbuffer, format, argptr);
-  if (this->linelength + tokenlength >= LP_MAX_LINE_LENGTH) {
-    fprintf(file, "\n");
-    fprintf(file, "%s", stringbuffer);
-    this->linelength = tokenlength;
-  } else {
-    fprintf(file, "%s", stringbuffer);
-    this->linelength += tokenlength;
+// Terms are appended to a buffer, and a line is broken before any term
+// that would take it past LP_MAX_LINE_LENGTH
+class LpLineBuffer {
+ public:
+  explicit LpLineBuffer(HighsOutputBuffer& buffer)
+      : buffer_(buffer), line_start_(buffer.size()), term_start_(0) {}
+  void startTerm() { term_start_ = buffer_.size(); }
+  void endTerm() {
+    if (buffer_.size() - line_start_ >= LP_MAX_LINE_LENGTH &&
+        term_start_ > line_start_) {
+      buffer_.insert(term_start_, '\n');
+      line_start_ = term_start_ + 1;
+    }
   }
-}
+  void endLine() {
+    buffer_.append('\n');
+    line_start_ = buffer_.size();
+  }
+  void appendTerm(const double value, const HighsInt col) {
+    startTerm();
+    buffer_.appendSignedDouble(value);
+    buffer_.append(" x");
+    buffer_.appendInt(col + 1);
+    buffer_.append(' ');
+    endTerm();
+  }
+  HighsOutputBuffer& buffer() { return buffer_; }
 
-void FilereaderLp::writeToFileLineend(FILE* file) {
-  fprintf(file, "\n");
-  this->linelength = 0;
-}
+ private:
+  HighsOutputBuffer& buffer_;
+  size_t line_start_;
+  size_t term_start_;
+};
 
 HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
                                            const std::string filename,
@@ -151,131 +141,151 @@ HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
   const HighsLp& lp = model.lp_;
   assert(lp.format_ != MatrixFormat::kRowwise);
   FILE* file = fopen(filename.c_str(), "w");
+  if (file == nullptr) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
 
   // write comment at the start of the file
-  this->writeToFile(file, "\\ %s", LP_COMMENT_FILESTART);
-  this->writeToFileLineend(file);
+  HighsOutputBuffer buffer;
+  LpLineBuffer line(buffer);
+  buffer.append("\\ ");
+  buffer.append(LP_COMMENT_FILESTART);
+  line.endLine();
 
   // write objective
-  this->writeToFile(file, "%s",
-                    lp.sense_ == ObjSense::kMinimize ? "min" : "max");
-  this->writeToFileLineend(file);
-  this->writeToFile(file, " obj: ");
-  for (HighsInt i = 0; i < lp.num_col_; i++) {
-    this->writeToFile(file, "%+g x%" HIGHSINT_FORMAT " ", lp.col_cost_[i],
-                      (i + 1));
-  }
+  buffer.append(lp.sense_ == ObjSense::kMinimize ? "min" : "max");
+  line.endLine();
+  buffer.append(" obj: ");
+  for (HighsInt i = 0; i < lp.num_col_; i++)
+    line.appendTerm(lp.col_cost_[i], i);
   if (model.isQp()) {
-    this->writeToFile(file, "+ [ ");
+    const HighsHessian& hessian = model.hessian_;
+    buffer.append("+ [ ");
     for (HighsInt col = 0; col < lp.num_col_; col++) {
-      for (HighsInt i = model.hessian_.q_start_[col];
-           i < model.hessian_.q_start_[col + 1]; i++) {
-        if (col <= model.hessian_.q_index_[i]) {
-          this->writeToFile(
-              file, "%+g x%" HIGHSINT_FORMAT " * x%" HIGHSINT_FORMAT " ",
-              model.hessian_.q_value_[i], col, model.hessian_.q_index_[i]);
-        }
+      for (HighsInt i = hessian.q_start_[col]; i < hessian.q_start_[col + 1];
+           i++) {
+        const HighsInt row = hessian.q_index_[i];
+        if (col > row) continue;
+        // Within [ ]/2 each off-diagonal product appears once, so
+        // carries both of its Hessian entries
+        line.startTerm();
+        buffer.appendSignedDouble(col == row ? hessian.q_value_[i]
+                                             : 2 * hessian.q_value_[i]);
+        buffer.append(" x");
+        buffer.appendInt(col + 1);
+        buffer.append(" * x");
+        buffer.appendInt(row + 1);
+        buffer.append(' ');
+        line.endTerm();
       }
     }
-    this->writeToFile(file, " ]/2 ");
+    buffer.append(" ]/2 ");
   }
-  this->writeToFileLineend(file);
+  line.endLine();
 
   // write constraint section, lower & upper bounds are one constraint
   // each
-  this->writeToFile(file, "st");
-  this->writeToFileLineend(file);
-  for (HighsInt row = 0; row < lp.num_row_; row++) {
-    if (lp.row_lower_[row] == lp.row_upper_[row]) {
-      // equality constraint
-      this->writeToFile(file, " con%" HIGHSINT_FORMAT ": ", row + 1);
-      for (HighsInt var = 0; var < lp.num_col_; var++) {
-        for (HighsInt idx = lp.a_start_[var]; idx < lp.a_start_[var + 1];
-             idx++) {
-          if (lp.a_index_[idx] == row) {
-            this->writeToFile(file, "%+g x%" HIGHSINT_FORMAT " ",
-                              lp.a_value_[idx], var + 1);
-          }
-        }
-      }
-      this->writeToFile(file, "= %+g", lp.row_lower_[row]);
-      this->writeToFileLineend(file);
-    } else {
-      if (lp.row_lower_[row] > -kHighsInf) {
-        // has a lower bounds
-        this->writeToFile(file, " con%" HIGHSINT_FORMAT "lo: ", row + 1);
-        for (HighsInt var = 0; var < lp.num_col_; var++) {
-          for (HighsInt idx = lp.a_start_[var]; idx < lp.a_start_[var + 1];
-               idx++) {
-            if (lp.a_index_[idx] == row) {
-              this->writeToFile(file, "%+g x%" HIGHSINT_FORMAT " ",
-                                lp.a_value_[idx], var + 1);
-            }
-          }
-        }
-        this->writeToFile(file, ">= %+g", lp.row_lower_[row]);
-        this->writeToFileLineend(file);
-      } else if (lp.row_upper_[row] < kHighsInf) {
-        // has an upper bounds
-        this->writeToFile(file, " con%" HIGHSINT_FORMAT "up: ", row + 1);
-        for (HighsInt var = 0; var < lp.num_col_; var++) {
-          for (HighsInt idx = lp.a_start_[var]; idx < lp.a_start_[var + 1];
-               idx++) {
-            if (lp.a_index_[idx] == row) {
-              this->writeToFile(file, "%+g x%" HIGHSINT_FORMAT " ",
-                                lp.a_value_[idx], var + 1);
-            }
-          }
-        }
-        this->writeToFile(file, "<= %+g", lp.row_upper_[row]);
-        this->writeToFileLineend(file);
-      } else {
-        // constraint has infinite lower & upper bounds so not a proper
-        // constraint, does not get written
-      }
+  buffer.append("st");
+  line.endLine();
+  bool write_ok = buffer.write(file);
+
+  // The constraints are written row by row, so the matrix is transposed
+  // once, and blocks of rows are formatted in parallel
+  std::vector<HighsInt> ar_start(lp.num_row_ + 1, 0);
+  std::vector<HighsInt> ar_index(lp.a_start_[lp.num_col_]);
+  std::vector<double> ar_value(lp.a_start_[lp.num_col_]);
+  for (HighsInt el = 0; el < lp.a_start_[lp.num_col_]; el++)
+    ar_start[lp.a_index_[el] + 1]++;
+  for (HighsInt row = 0; row < lp.num_row_; row++)
+    ar_start[row + 1] += ar_start[row];
+  std::vector<HighsInt> ar_next(ar_start.begin(), ar_start.end() - 1);
+  for (HighsInt col = 0; col < lp.num_col_; col++) {
+    for (HighsInt el = lp.a_start_[col]; el < lp.a_start_[col + 1]; el++) {
+      const HighsInt row = lp.a_index_[el];
+      ar_index[ar_next[row]] = col;
+      ar_value[ar_next[row]++] = lp.a_value_[el];
     }
   }
+  auto formatConstraint = [&](LpLineBuffer& row_line, const HighsInt row,
+                              const char* suffix, const char* relation,
+                              const double bound) {
+    HighsOutputBuffer& row_buffer = row_line.buffer();
+    row_buffer.append(" con");
+    row_buffer.appendInt(row + 1);
+    row_buffer.append(suffix);
+    row_buffer.append(": ");
+    for (HighsInt el = ar_start[row]; el < ar_start[row + 1]; el++)
+      row_line.appendTerm(ar_value[el], ar_index[el]);
+    row_buffer.append(relation);
+    row_buffer.appendSignedDouble(bound);
+    row_line.endLine();
+  };
+  auto formatConstraints = [&](HighsOutputBuffer& block,
+                               const HighsInt from_row, const HighsInt to_row) {
+    LpLineBuffer row_line(block);
+    for (HighsInt row = from_row; row < to_row; row++) {
+      if (lp.row_lower_[row] == lp.row_upper_[row]) {
+        // equality constraint
+        formatConstraint(row_line, row, "", "= ", lp.row_lower_[row]);
+        continue;
+      }
+      // constraint with infinite lower & upper bounds is not a proper
+      // constraint, so does not get written
+      if (lp.row_lower_[row] > -kHighsInf)
+        formatConstraint(row_line, row, "lo", ">= ", lp.row_lower_[row]);
+      if (lp.row_upper_[row] < kHighsInf)
+        formatConstraint(row_line, row, "up", "<= ", lp.row_upper_[row]);
+    }
+  };
+  write_ok = write_ok && writeOutputBlocks(file, lp.num_row_, ar_start.data(),
+                                           formatConstraints);
 
   // write bounds section
-  this->writeToFile(file, "bounds");
-  this->writeToFileLineend(file);
-  for (HighsInt i = 0; i < lp.num_col_; i++) {
-    // if both lower/upper bound are +/-infinite: [name] free
-    if (lp.col_lower_[i] > -kHighsInf && lp.col_upper_[i] < kHighsInf) {
-      this->writeToFile(file, " %+g <= x%" HIGHSINT_FORMAT " <= %+g",
-                        lp.col_lower_[i], i + 1, lp.col_upper_[i]);
-      this->writeToFileLineend(file);
-    } else if (lp.col_lower_[i] <= -kHighsInf && lp.col_upper_[i] < kHighsInf) {
-      this->writeToFile(file, " -inf <= x%" HIGHSINT_FORMAT " <= %+g", i + 1,
-                        lp.col_upper_[i]);
-      this->writeToFileLineend(file);
-
-    } else if (lp.col_lower_[i] > -kHighsInf && lp.col_upper_[i] >= kHighsInf) {
-      this->writeToFile(file, " %+g <= x%" HIGHSINT_FORMAT " <= +inf",
-                        lp.col_lower_[i], i + 1);
-      this->writeToFileLineend(file);
-    } else {
-      this->writeToFile(file, " x%" HIGHSINT_FORMAT " free", i + 1);
-      this->writeToFileLineend(file);
+  buffer.append("bounds");
+  line.endLine();
+  write_ok = write_ok && buffer.write(file);
+  auto formatBounds = [&](HighsOutputBuffer& block, const HighsInt from_col,
+                          const HighsInt to_col) {
+    for (HighsInt i = from_col; i < to_col; i++) {
+      // if both lower/upper bound are +/-infinite: [name] free
+      const bool has_lower = lp.col_lower_[i] > -kHighsInf;
+      const bool has_upper = lp.col_upper_[i] < kHighsInf;
+      block.append(' ');
+      if (!has_lower && !has_upper) {
+        block.append('x');
+        block.appendInt(i + 1);
+        block.append(" free\n");
+        continue;
+      }
+      if (has_lower) {
+        block.appendSignedDouble(lp.col_lower_[i]);
+      } else {
+        block.append("-inf");
+      }
+      block.append(" <= x");
+      block.appendInt(i + 1);
+      block.append(" <= ");
+      if (has_upper) {
+        block.appendSignedDouble(lp.col_upper_[i]);
+      } else {
+        block.append("+inf");
+      }
+      block.append('\n');
     }
-  }
-
-  // write binary section
-  this->writeToFile(file, "bin");
-  this->writeToFileLineend(file);
-
-  // write general section
-  this->writeToFile(file, "gen");
-  this->writeToFileLineend(file);
-
-  // write semi section
-  this->writeToFile(file, "semi");
-  this->writeToFileLineend(file);
-
-  // write end
-  this->writeToFile(file, "end");
-  this->writeToFileLineend(file);
+  };
+  write_ok =
+      write_ok && writeOutputBlocks(file, lp.num_col_, nullptr, formatBounds);
 
+  // write binary, general and semi sections, and end
+  buffer.append("bin\ngen\nsemi\nend\n");
+  write_ok = write_ok && buffer.write(file);
   fclose(file);
+  if (!write_ok) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
   return HighsStatus::kOk;
 }
@@ -37,12 +37,6 @@ class FilereaderLp : public Filereader {
   HighsStatus writeModelToFile(const HighsOptions& options,
                                const std::string filename,
                                const HighsModel& model);
-
- private:
-  // functions to write files
-  HighsInt linelength;
-  void writeToFile(FILE* file, const char* format, ...);
-  void writeToFileLineend(FILE* file);
 };
 
 #endif
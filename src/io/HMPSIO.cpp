@@ -17,6 +17,7 @@
 
 #include <algorithm>
 
+#include "io/HighsOutputBuffer.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsModelUtils.h"
@@ -52,8 +53,8 @@ FilereaderRetcode readMps(const HighsLogOptions& log_options,
 #ifdef HiGHSDEV
   printf("readMPS: Trying to open file %s\n", filename.c_str());
 #endif
-  FILE* file = fopen(filename.c_str(), "r");
-  if (file == 0) {
+  HighsInputStream file(filename);
+  if (!file.is_open()) {
 #ifdef HiGHSDEV
     printf("readMPS: Not opened file OK\n");
 #endif
@@ -398,11 +399,11 @@ FilereaderRetcode readMps(const HighsLogOptions& log_options,
          numRow, numCol, num_int);
 #endif
   // Load ENDATA and close file
-  fclose(file);
+  file.close();
   return FilereaderRetcode::kOk;
 }
 
-bool load_mpsLine(FILE* file, HighsVarType& integerVar, HighsInt lmax,
+bool load_mpsLine(std::istream& file, HighsVarType& integerVar, HighsInt lmax,
                   char* line, char* flag, double* data) {
   HighsInt F1 = 1, F2 = 4, F3 = 14, F4 = 24, F5 = 39, F6 = 49;
   char* fgets_rt;
@@ -418,7 +419,7 @@ bool load_mpsLine(FILE* file, HighsVarType& integerVar, HighsInt lmax,
   // try to read some to the line
   for (;;) {
     // Line input
-    fgets_rt = fgets(line, lmax, file);
+    fgets_rt = getStreamLine(file, line, lmax);
     if (fgets_rt == NULL) {
       return false;
     }
@@ -670,148 +671,213 @@ HighsStatus writeMps(
   // BOUNDS
   //  LO BOUND     CFOOD01           850.
   //
-  fprintf(file, "NAME        %s\n", model_name.c_str());
-  fprintf(file, "ROWS\n");
-  fprintf(file, " N  COST\n");
-  for (HighsInt r_n = 0; r_n < num_row; r_n++) {
-    if (r_ty[r_n] == MPS_ROW_TY_E) {
-      fprintf(file, " E  %-8s\n", row_names[r_n].c_str());
-    } else if (r_ty[r_n] == MPS_ROW_TY_G) {
-      fprintf(file, " G  %-8s\n", row_names[r_n].c_str());
-    } else if (r_ty[r_n] == MPS_ROW_TY_L) {
-      fprintf(file, " L  %-8s\n", row_names[r_n].c_str());
-    } else {
-      fprintf(file, " N  %-8s\n", row_names[r_n].c_str());
-    }
-  }
+  // Zero columns with no cost, and the integer markers, depend on the
+  // columns before, so are found before the columns are formatted
+  vector<HighsInt> col_marker;
+  if (have_int) col_marker.assign(num_col, -1);
   bool integerFg = false;
   HighsInt nIntegerMk = 0;
-  fprintf(file, "COLUMNS\n");
   for (HighsInt c_n = 0; c_n < num_col; c_n++) {
     if (a_start[c_n] == a_start[c_n + 1] && col_cost[c_n] == 0) {
-      // Possibly skip this column as it's zero and has no cost
       num_zero_no_cost_columns++;
-      if (write_zero_no_cost_columns) {
-        // Give the column a presence by writing out a zero cost
-        double v = 0;
-        fprintf(file, "    %-8s  COST      %.15g\n", col_names[c_n].c_str(), v);
-      }
+      if (have_bounds &&
+          (!highs_isInfinity(col_upper[c_n]) || col_lower[c_n]))
+        num_zero_no_cost_columns_in_bounds_section++;
       continue;
     }
     if (have_int) {
       if (integrality[c_n] == HighsVarType::kInteger && !integerFg) {
         // Start an integer section
-        fprintf(file,
-                "    MARK%04" HIGHSINT_FORMAT
-                "  'MARKER'                 'INTORG'\n",
-                nIntegerMk);
-        nIntegerMk++;
+        col_marker[c_n] = nIntegerMk++;
         integerFg = true;
       } else if (integrality[c_n] != HighsVarType::kInteger && integerFg) {
         // End an integer section
-        fprintf(file,
-                "    MARK%04" HIGHSINT_FORMAT
-                "  'MARKER'                 'INTEND'\n",
-                nIntegerMk);
-        nIntegerMk++;
+        col_marker[c_n] = nIntegerMk++;
         integerFg = false;
       }
     }
-    if (col_cost[c_n] != 0) {
-      double v = (HighsInt)sense * col_cost[c_n];
-      fprintf(file, "    %-8s  COST      %.15g\n", col_names[c_n].c_str(), v);
-    }
-    for (HighsInt el_n = a_start[c_n]; el_n < a_start[c_n + 1]; el_n++) {
-      double v = a_value[el_n];
-      HighsInt r_n = a_index[el_n];
-      fprintf(file, "    %-8s  %-8s  %.15g\n", col_names[c_n].c_str(),
-              row_names[r_n].c_str(), v);
-    }
   }
+  auto isZeroNoCostColumn = [&](const HighsInt c_n) {
+    return a_start[c_n] == a_start[c_n + 1] && col_cost[c_n] == 0;
+  };
+
+  // The lines for blocks of rows and columns are formatted in parallel,
+  // and written in order
+  HighsOutputBuffer buffer;
+  buffer.append("NAME        ");
+  buffer.append(model_name);
+  buffer.append("\nROWS\n N  COST\n");
+  bool write_ok = buffer.write(file);
+  write_ok = write_ok &&
+             writeOutputBlocks(file, num_row, nullptr,
+                               [&](HighsOutputBuffer& block,
+                                   const HighsInt from_row,
+                                   const HighsInt to_row) {
+                                 for (HighsInt r_n = from_row; r_n < to_row;
+                                      r_n++) {
+                                   if (r_ty[r_n] == MPS_ROW_TY_E) {
+                                     block.append(" E  ");
+                                   } else if (r_ty[r_n] == MPS_ROW_TY_G) {
+                                     block.append(" G  ");
+                                   } else if (r_ty[r_n] == MPS_ROW_TY_L) {
+                                     block.append(" L  ");
+                                   } else {
+                                     block.append(" N  ");
+                                   }
+                                   block.appendPadded(row_names[r_n], 8);
+                                   block.append('\n');
+                                 }
+                               });
+  buffer.append("COLUMNS\n");
+  write_ok = write_ok && buffer.write(file);
+  auto formatColumns = [&](HighsOutputBuffer& block, const HighsInt from_col,
+                           const HighsInt to_col) {
+    for (HighsInt c_n = from_col; c_n < to_col; c_n++) {
+      if (isZeroNoCostColumn(c_n)) {
+        // Possibly skip this column as it's zero and has no cost
+        if (write_zero_no_cost_columns) {
+          // Give the column a presence by writing out a zero cost
+          block.append("    ");
+          block.appendPadded(col_names[c_n], 8);
+          block.append("  COST      0\n");
+        }
+        continue;
+      }
+      if (have_int && col_marker[c_n] >= 0)
+        block.appendFormat("    MARK%04" HIGHSINT_FORMAT
+                           "  'MARKER'                 '%s'\n",
+                           col_marker[c_n],
+                           integrality[c_n] == HighsVarType::kInteger
+                               ? "INTORG"
+                               : "INTEND");
+      if (col_cost[c_n] != 0) {
+        block.append("    ");
+        block.appendPadded(col_names[c_n], 8);
+        block.append("  COST      ");
+        block.appendDouble((HighsInt)sense * col_cost[c_n]);
+        block.append('\n');
+      }
+      for (HighsInt el_n = a_start[c_n]; el_n < a_start[c_n + 1]; el_n++) {
+        block.append("    ");
+        block.appendPadded(col_names[c_n], 8);
+        block.append("  ");
+        block.appendPadded(row_names[a_index[el_n]], 8);
+        block.append("  ");
+        block.appendDouble(a_value[el_n]);
+        block.append('\n');
+      }
+    }
+  };
+  write_ok = write_ok &&
+             writeOutputBlocks(file, num_col, a_start.data(), formatColumns);
   have_rhs = true;
   if (have_rhs) {
-    fprintf(file, "RHS\n");
+    buffer.append("RHS\n");
     if (offset) {
       // Handle the objective offset as a RHS entry for the cost row
-      double v = -(HighsInt)sense * offset;
-      fprintf(file, "    RHS_V     COST      %.15g\n", v);
-    }
-    for (HighsInt r_n = 0; r_n < num_row; r_n++) {
-      double v = rhs[r_n];
-      if (v) {
-        fprintf(file, "    RHS_V     %-8s  %.15g\n", row_names[r_n].c_str(), v);
-      }
+      buffer.append("    RHS_V     COST      ");
+      buffer.appendDouble(-(HighsInt)sense * offset);
+      buffer.append('\n');
     }
+    write_ok = write_ok && buffer.write(file);
+    write_ok = write_ok &&
+               writeOutputBlocks(file, num_row, nullptr,
+                                 [&](HighsOutputBuffer& block,
+                                     const HighsInt from_row,
+                                     const HighsInt to_row) {
+                                   for (HighsInt r_n = from_row; r_n < to_row;
+                                        r_n++) {
+                                     if (!rhs[r_n]) continue;
+                                     block.append("    RHS_V     ");
+                                     block.appendPadded(row_names[r_n], 8);
+                                     block.append("  ");
+                                     block.appendDouble(rhs[r_n]);
+                                     block.append('\n');
+                                   }
+                                 });
   }
   if (have_ranges) {
-    fprintf(file, "RANGES\n");
-    for (HighsInt r_n = 0; r_n < num_row; r_n++) {
-      double v = ranges[r_n];
-      if (v) {
-        fprintf(file, "    RANGE     %-8s  %.15g\n", row_names[r_n].c_str(), v);
-      }
-    }
+    buffer.append("RANGES\n");
+    write_ok = write_ok && buffer.write(file);
+    write_ok = write_ok &&
+               writeOutputBlocks(file, num_row, nullptr,
+                                 [&](HighsOutputBuffer& block,
+                                     const HighsInt from_row,
+                                     const HighsInt to_row) {
+                                   for (HighsInt r_n = from_row; r_n < to_row;
+                                        r_n++) {
+                                     if (!ranges[r_n]) continue;
+                                     block.append("    RANGE     ");
+                                     block.appendPadded(row_names[r_n], 8);
+                                     block.append("  ");
+                                     block.appendDouble(ranges[r_n]);
+                                     block.append('\n');
+                                   }
+                                 });
   }
   if (have_bounds) {
-    fprintf(file, "BOUNDS\n");
-    for (HighsInt c_n = 0; c_n < num_col; c_n++) {
-      double lb = col_lower[c_n];
-      double ub = col_upper[c_n];
-      bool discrete = false;
-      if (have_int) discrete = integrality[c_n] == HighsVarType::kInteger;
-      if (a_start[c_n] == a_start[c_n + 1] && col_cost[c_n] == 0) {
-        // Possibly skip this column if it's zero and has no cost
-        if (!highs_isInfinity(ub) || lb) {
-          // Column would have a bound to report
-          num_zero_no_cost_columns_in_bounds_section++;
-        }
-        if (write_zero_no_cost_columns) continue;
+    buffer.append("BOUNDS\n");
+    write_ok = write_ok && buffer.write(file);
+    auto formatBound = [&](HighsOutputBuffer& block, const char* type,
+                           const HighsInt c_n, const double* value) {
+      block.append(type);
+      block.appendPadded(col_names[c_n], 8);
+      if (value) {
+        block.append("  ");
+        block.appendDouble(*value);
       }
-      if (lb == ub) {
-        // Equal lower and upper bounds: Fixed
-        fprintf(file, " FX BOUND     %-8s  %.15g\n", col_names[c_n].c_str(),
-                lb);
-      } else if (highs_isInfinity(-lb) && highs_isInfinity(ub)) {
-        // Infinite lower and upper bounds: Free
-        fprintf(file, " FR BOUND     %-8s\n", col_names[c_n].c_str());
-      } else {
-        if (discrete) {
-          if (lb == 0 && ub == 1) {
-            // Binary
-            fprintf(file, " BV BOUND     %-8s\n", col_names[c_n].c_str());
+      block.append('\n');
+    };
+    auto formatBounds = [&](HighsOutputBuffer& block, const HighsInt from_col,
+                            const HighsInt to_col) {
+      for (HighsInt c_n = from_col; c_n < to_col; c_n++) {
+        const double lb = col_lower[c_n];
+        const double ub = col_upper[c_n];
+        bool discrete = false;
+        if (have_int) discrete = integrality[c_n] == HighsVarType::kInteger;
+        // Possibly skip this column if it's zero and has no cost
+        if (isZeroNoCostColumn(c_n) && write_zero_no_cost_columns) continue;
+        if (lb == ub) {
+          // Equal lower and upper bounds: Fixed
+          formatBound(block, " FX BOUND     ", c_n, &lb);
+        } else if (highs_isInfinity(-lb) && highs_isInfinity(ub)) {
+          // Infinite lower and upper bounds: Free
+          formatBound(block, " FR BOUND     ", c_n, nullptr);
+        } else {
+          if (discrete) {
+            if (lb == 0 && ub == 1) {
+              // Binary
+              formatBound(block, " BV BOUND     ", c_n, nullptr);
+            } else {
+              if (!highs_isInfinity(-lb)) {
+                // Finite lower bound. No need to state this if LB is
+                // zero unless UB is infinte
+                if (lb || highs_isInfinity(ub))
+                  formatBound(block, " LI BOUND     ", c_n, &lb);
+              }
+              if (!highs_isInfinity(ub)) {
+                // Finite upper bound
+                formatBound(block, " UI BOUND     ", c_n, &ub);
+              }
+            }
           } else {
             if (!highs_isInfinity(-lb)) {
-              // Finite lower bound. No need to state this if LB is
-              // zero unless UB is infinte
-              if (lb || highs_isInfinity(ub))
-                fprintf(file, " LI BOUND     %-8s  %.15g\n",
-                        col_names[c_n].c_str(), lb);
+              // Lower bounded variable - default is 0
+              if (lb) formatBound(block, " LO BOUND     ", c_n, &lb);
+            } else {
+              // Infinite lower bound
+              formatBound(block, " MI BOUND     ", c_n, nullptr);
             }
             if (!highs_isInfinity(ub)) {
-              // Finite upper bound
-              fprintf(file, " UI BOUND     %-8s  %.15g\n",
-                      col_names[c_n].c_str(), ub);
-            }
-          }
-        } else {
-          if (!highs_isInfinity(-lb)) {
-            // Lower bounded variable - default is 0
-            if (lb) {
-              fprintf(file, " LO BOUND     %-8s  %.15g\n",
-                      col_names[c_n].c_str(), lb);
+              // Upper bounded variable
+              formatBound(block, " UP BOUND     ", c_n, &ub);
             }
-          } else {
-            // Infinite lower bound
-            fprintf(file, " MI BOUND     %-8s\n", col_names[c_n].c_str());
-          }
-          if (!highs_isInfinity(ub)) {
-            // Upper bounded variable
-            fprintf(file, " UP BOUND     %-8s  %.15g\n", col_names[c_n].c_str(),
-                    ub);
           }
         }
       }
-    }
+    };
+    write_ok =
+        write_ok && writeOutputBlocks(file, num_col, nullptr, formatBounds);
   }
   if (q_dim) {
     // Write out Hessian info
@@ -821,17 +887,35 @@ HighsStatus writeMps(
     assert((HighsInt)q_value.size() >= hessian_num_nz);
 
     // Assumes that Hessian entries are the lower triangle column-wise
-    fprintf(file, "QUADOBJ\n");
-    for (HighsInt col = 0; col < q_dim; col++) {
-      for (HighsInt el = q_start[col]; el < q_start[col + 1]; el++) {
-        HighsInt row = q_index[el];
-        assert(row >= col);
-        fprintf(file, "    %-8s  %-8s  %.15g\n", col_names[col].c_str(),
-                col_names[row].c_str(), q_value[el]);
+    buffer.append("QUADOBJ\n");
+    write_ok = write_ok && buffer.write(file);
+    auto formatHessian = [&](HighsOutputBuffer& block, const HighsInt from_col,
+                             const HighsInt to_col) {
+      for (HighsInt col = from_col; col < to_col; col++) {
+        for (HighsInt el = q_start[col]; el < q_start[col + 1]; el++) {
+          HighsInt row = q_index[el];
+          assert(row >= col);
+          block.append("    ");
+          block.appendPadded(col_names[col], 8);
+          block.append("  ");
+          block.appendPadded(col_names[row], 8);
+          block.append("  ");
+          block.appendDouble(q_value[el]);
+          block.append('\n');
+        }
       }
-    }
+    };
+    write_ok = write_ok &&
+               writeOutputBlocks(file, q_dim, q_start.data(), formatHessian);
+  }
+  buffer.append("ENDATA\n");
+  write_ok = write_ok && buffer.write(file);
+  if (!write_ok) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Error writing file %s\n", filename.c_str());
+    fclose(file);
+    return HighsStatus::kError;
   }
-  fprintf(file, "ENDATA\n");
   //#ifdef HiGHSDEV
   if (num_zero_no_cost_columns) {
     printf("Model has %" HIGHSINT_FORMAT
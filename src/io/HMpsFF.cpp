@@ -141,10 +141,10 @@ HighsInt HMpsFF::fillHessian() {
 
 FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
                                          const std::string& filename) {
-  std::ifstream f;
+  // Compressed files are decompressed while they are parsed
+  HighsInputStream f(filename);
   HMpsFF::Parsekey keyword = HMpsFF::Parsekey::kNone;
 
-  f.open(filename.c_str(), std::ios::in);
   if (f.is_open()) {
     start_time = getWallTime();
     nnz = 0;
@@ -205,6 +205,12 @@ FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
       f.close();
       return FreeFormatParserReturnCode::kParserError;
     }
+    if (f.bad()) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "Error reading file %s\n", filename.c_str());
+      f.close();
+      return FreeFormatParserReturnCode::kParserError;
+    }
   } else {
     f.close();
     return FreeFormatParserReturnCode::kFileNotFound;
@@ -345,7 +351,7 @@ HMpsFF::Parsekey HMpsFF::checkFirstWord(std::string& strline, HighsInt& start,
     return HMpsFF::Parsekey::kNone;
 }
 
-HMpsFF::Parsekey HMpsFF::parseDefault(std::ifstream& file) {
+HMpsFF::Parsekey HMpsFF::parseDefault(std::istream& file) {
   std::string strline, word;
   if (getline(file, strline)) {
     strline = trim(strline);
@@ -371,7 +377,7 @@ double getWallTime() {
 }
 
 HMpsFF::Parsekey HMpsFF::parseObjsense(const HighsLogOptions& log_options,
-                                       std::ifstream& file) {
+                                       std::istream& file) {
   std::string strline, word;
 
   while (getline(file, strline)) {
@@ -400,7 +406,7 @@ HMpsFF::Parsekey HMpsFF::parseObjsense(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
-                                   std::ifstream& file) {
+                                   std::istream& file) {
   std::string strline, word;
   size_t nrows = 0;
   bool hasobj = false;
@@ -497,7 +503,7 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
 }
 
 typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
-                                            std::ifstream& file) {
+                                            std::istream& file) {
   std::string colname = "";
   std::string strline, word;
   HighsInt rowidx, start, end;
@@ -670,7 +676,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
-                                  std::ifstream& file) {
+                                  std::istream& file) {
   std::string strline;
 
   auto parsename = [this](const std::string& name, HighsInt& rowidx) {
@@ -819,7 +825,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
-                                     std::ifstream& file) {
+                                     std::istream& file) {
   HighsInt numWarnings = 0;
   std::string strline, word;
 
@@ -1053,7 +1059,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
-                                     std::ifstream& file) {
+                                     std::istream& file) {
   std::string strline, word;
 
   auto parsename = [this](const std::string& name, HighsInt& rowidx) {
@@ -1173,7 +1179,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
 }
 
 typename HMpsFF::Parsekey HMpsFF::parseHessian(
-    const HighsLogOptions& log_options, std::ifstream& file,
+    const HighsLogOptions& log_options, std::istream& file,
     const HMpsFF::Parsekey keyword) {
   // Parse Hessian information from QSECTION, QUADOBJ or QMATRIX
   // section according to keyword
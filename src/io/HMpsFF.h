@@ -34,6 +34,7 @@
 #include <vector>
 
 #include "io/HighsIO.h"
+#include "io/HighsInputStream.h"
 #include "model/HighsModel.h"
 //#include "util/HighsInt.h"
 #include "util/stringutil.h"
@@ -158,21 +159,21 @@ class HMpsFF {
   HMpsFF::Parsekey checkFirstWord(std::string& strline, HighsInt& start,
                                   HighsInt& end, std::string& word) const;
 
-  HMpsFF::Parsekey parseDefault(std::ifstream& file);
+  HMpsFF::Parsekey parseDefault(std::istream& file);
   HMpsFF::Parsekey parseObjsense(const HighsLogOptions& log_options,
-                                 std::ifstream& file);
+                                 std::istream& file);
   HMpsFF::Parsekey parseRows(const HighsLogOptions& log_options,
-                             std::ifstream& file);
+                             std::istream& file);
   HMpsFF::Parsekey parseCols(const HighsLogOptions& log_options,
-                             std::ifstream& file);
+                             std::istream& file);
   HMpsFF::Parsekey parseRhs(const HighsLogOptions& log_options,
-                            std::ifstream& file);
+                            std::istream& file);
   HMpsFF::Parsekey parseRanges(const HighsLogOptions& log_options,
-                               std::ifstream& file);
+                               std::istream& file);
   HMpsFF::Parsekey parseBounds(const HighsLogOptions& log_options,
-                               std::ifstream& file);
+                               std::istream& file);
   HMpsFF::Parsekey parseHessian(const HighsLogOptions& log_options,
-                                std::ifstream& file,
+                                std::istream& file,
                                 const HMpsFF::Parsekey keyword);
   bool cannotParseSection(const HighsLogOptions& log_options,
                           const HMpsFF::Parsekey keyword);
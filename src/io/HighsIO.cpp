@@ -15,17 +15,50 @@
  */
 #include "HighsIO.h"
 
+#include <cassert>
 #include <cstdarg>
 #include <cstdio>
+#include <vector>
 
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsOptions.h"
 
-void (*printmsgcb)(HighsInt, const char*, void*) = NULL;
-void (*logmsgcb)(HighsLogType, const char*, void*) = NULL;
-void* msgcb_data = NULL;
+// Size of the buffer in which each message is formatted. Longer messages
+// are truncated
+const HighsInt kMessageBufferSize = 65536;
 
-char msgbuffer[65536];
+// Each thread formats messages in its own buffer, so Highs instances on
+// different threads share no logging state, and each message is passed
+// on with a single call
+static std::vector<char>& threadMessageBuffer() {
+  thread_local std::vector<char> message_buffer(kMessageBufferSize);
+  return message_buffer;
+}
+
+static const char* formatMessage(const char* prefix, const char* format,
+                                 va_list argptr) {
+  std::vector<char>& message_buffer = threadMessageBuffer();
+  char* message = message_buffer.data();
+  const int size = message_buffer.size();
+  int len = 0;
+  if (prefix != NULL) len = snprintf(message, size, "%-9s", prefix);
+  if (len < size) vsnprintf(message + len, size - len, format, argptr);
+  return message;
+}
+
+static void outputMessage(const HighsLogOptions& log_options_,
+                          const HighsLogType type, const char* message) {
+  if (log_options_.logmsgcb != NULL) {
+    log_options_.logmsgcb(type, message, log_options_.msgcb_data);
+    return;
+  }
+  // Write to log file stream
+  if (log_options_.log_file_stream != NULL)
+    fputs(message, log_options_.log_file_stream);
+  // Write to stdout unless log file stream is stdout
+  if (*log_options_.log_to_console && log_options_.log_file_stream != stdout)
+    fputs(message, stdout);
+}
 
 void highsLogUser(const HighsLogOptions& log_options_, const HighsLogType type,
                   const char* format, ...) {
@@ -36,39 +69,16 @@ void highsLogUser(const HighsLogOptions& log_options_, const HighsLogType type,
   // HighsLogType::kVerbose
   assert(type != HighsLogType::kDetailed);
   assert(type != HighsLogType::kVerbose);
-  const bool prefix =
-      type == HighsLogType::kWarning || type == HighsLogType::kError;
+  // Messages passed to a callback always have a prefix, possibly blank
+  const bool prefix = log_options_.logmsgcb != NULL ||
+                      type == HighsLogType::kWarning ||
+                      type == HighsLogType::kError;
   va_list argptr;
   va_start(argptr, format);
-  if (logmsgcb == NULL) {
-    if (log_options_.log_file_stream != NULL) {
-      // Write to log file stream
-      if (prefix)
-        fprintf(log_options_.log_file_stream, "%-9s",
-                HighsLogTypeTag[(int)type]);
-      vfprintf(log_options_.log_file_stream, format, argptr);
-      va_start(argptr, format);
-    }
-    if (*log_options_.log_to_console &&
-        log_options_.log_file_stream != stdout) {
-      // Write to stdout unless log file stream is stdout
-      if (prefix) fprintf(stdout, "%-9s", HighsLogTypeTag[(int)type]);
-      vfprintf(stdout, format, argptr);
-    }
-  } else {
-    int len;
-    len = snprintf(msgbuffer, sizeof(msgbuffer), "%-9s",
-                   HighsLogTypeTag[(int)type]);
-    if (len < (int)sizeof(msgbuffer))
-      len +=
-          vsnprintf(msgbuffer + len, sizeof(msgbuffer) - len, format, argptr);
-    if (len >= (int)sizeof(msgbuffer)) {
-      // Output was truncated: for now just ensure string is null-terminated
-      msgbuffer[sizeof(msgbuffer) - 1] = '\0';
-    }
-    logmsgcb(type, msgbuffer, msgcb_data);
-  }
+  const char* message =
+      formatMessage(prefix ? HighsLogTypeTag[(int)type] : NULL, format, argptr);
   va_end(argptr);
+  outputMessage(log_options_, type, message);
 }
 
 void highsLogDev(const HighsLogOptions& log_options_, const HighsLogType type,
@@ -92,43 +102,25 @@ void highsLogDev(const HighsLogOptions& log_options_, const HighsLogType type,
     return;
   va_list argptr;
   va_start(argptr, format);
-  if (logmsgcb == NULL) {
-    if (log_options_.log_file_stream != NULL) {
-      // Write to log file stream
-      vfprintf(log_options_.log_file_stream, format, argptr);
-      va_start(argptr, format);
-    }
-    if (*log_options_.log_to_console &&
-        log_options_.log_file_stream != stdout) {
-      // Write to stdout unless log file stream is stdout
-      vfprintf(stdout, format, argptr);
-    }
-  } else {
-    int len;
-    len = vsnprintf(msgbuffer, sizeof(msgbuffer), format, argptr);
-    if (len >= (int)sizeof(msgbuffer)) {
-      // Output was truncated: for now just ensure string is null-terminated
-      msgbuffer[sizeof(msgbuffer) - 1] = '\0';
-    }
-    logmsgcb(type, msgbuffer, msgcb_data);
-  }
+  const char* message = formatMessage(NULL, format, argptr);
   va_end(argptr);
+  outputMessage(log_options_, type, message);
 }
 
-void highsSetLogCallback(void (*printmsgcb_)(HighsInt level, const char* msg,
+void highsSetLogCallback(HighsLogOptions& log_options_,
+                         void (*printmsgcb_)(HighsInt level, const char* msg,
                                              void* msgcb_data),
                          void (*logmsgcb_)(HighsLogType type, const char* msg,
                                            void* msgcb_data),
                          void* msgcb_data_) {
-  printmsgcb = printmsgcb_;
-  logmsgcb = logmsgcb_;
-  msgcb_data = msgcb_data_;
+  log_options_.printmsgcb = printmsgcb_;
+  log_options_.logmsgcb = logmsgcb_;
+  log_options_.msgcb_data = msgcb_data_;
 }
 
 void highsSetLogCallback(HighsOptions& options) {
-  printmsgcb = options.printmsgcb;
-  logmsgcb = options.logmsgcb;
-  msgcb_data = options.msgcb_data;
+  highsSetLogCallback(options.log_options, options.printmsgcb,
+                      options.logmsgcb, options.msgcb_data);
 }
 
 void highsReportLogOptions(const HighsLogOptions& log_options_) {
@@ -149,13 +141,8 @@ void highsReportLogOptions(const HighsLogOptions& log_options_) {
 std::string highsFormatToString(const char* format, ...) {
   va_list argptr;
   va_start(argptr, format);
-  int len = vsnprintf(msgbuffer, sizeof(msgbuffer), format, argptr);
-  if (len >= (int)sizeof(msgbuffer)) {
-    // Output was truncated: for now just ensure string is null-terminated
-    msgbuffer[sizeof(msgbuffer) - 1] = '\0';
-  }
+  std::string local_string(formatMessage(NULL, format, argptr));
   va_end(argptr);
-  std::string local_string(msgbuffer);
   return local_string;
 }
 
@@ -43,6 +43,12 @@ struct HighsLogOptions {
   bool* output_flag;
   bool* log_to_console;
   HighsInt* log_dev_level;
+  // Callbacks that receive messages in place of the log file and
+  // console, and the data passed to them. They belong to these log
+  // options, so Highs instances on different threads log independently
+  void (*printmsgcb)(HighsInt level, const char* msg, void* msgcb_data) = NULL;
+  void (*logmsgcb)(HighsLogType type, const char* msg, void* msgcb_data) = NULL;
+  void* msgcb_data = NULL;
 };
 
 /**
@@ -59,18 +65,20 @@ void highsLogDev(const HighsLogOptions& log_options_, const HighsLogType type,
                  const char* format, ...);
 
 /*
- * @brief sets the callbacks used to print output and and log
+ * @brief sets the callbacks used to print output and and log with the
+ * given log options
  *
  * Set to NULL to reset to default, which is to print to logfile and output file
  */
-void highsSetLogCallback(void (*printmsgcb_)(HighsInt level, const char* msg,
+void highsSetLogCallback(HighsLogOptions& log_options_,
+                         void (*printmsgcb_)(HighsInt level, const char* msg,
                                              void* msgcb_data),
                          void (*logmsgcb_)(HighsLogType type, const char* msg,
                                            void* msgcb_data),
                          void* msgcb_data_);
 
 /*
- * @brief sets callbacks from options
+ * @brief sets the callbacks of the log options from options
  */
 void highsSetLogCallback(HighsOptions& options  //!< the options
 );
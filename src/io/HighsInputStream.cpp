@@ -0,0 +1,207 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsInputStream.cpp
+ * @brief
+ */
+#include "io/HighsInputStream.h"
+
+#include <fstream>
+#include <vector>
+
+#include "HConfig.h"
+
+#ifdef ZLIB_FOUND
+#include <zlib.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// Size of the buffer for reading uncompressed files
+const HighsInt kFileBufferSize = 1 << 20;
+
+class BufferedFilebuf : public std::filebuf {
+ public:
+  // The buffer must be set before the file is opened to take effect
+  BufferedFilebuf() : buffer_(kFileBufferSize) {
+    pubsetbuf(buffer_.data(), kFileBufferSize);
+  }
+
+ private:
+  std::vector<char> buffer_;
+};
+
+#ifdef ZLIB_FOUND
+// Size of each block of decompressed data, and the number of blocks
+// that the decompressing thread may fill ahead of the parser
+const HighsInt kDecompressBlockSize = 1 << 20;
+const HighsInt kNumDecompressBlock = 4;
+// Size of the zlib buffer for reading the compressed file
+const HighsInt kCompressedBufferSize = 1 << 18;
+
+class GzipStreambuf : public std::streambuf {
+ public:
+  explicit GzipStreambuf(gzFile file);
+  ~GzipStreambuf();
+
+ protected:
+  int_type underflow() override;
+
+ private:
+  void decompress();
+
+  gzFile file_;
+  std::vector<char> block_[kNumDecompressBlock];
+  HighsInt block_size_[kNumDecompressBlock];
+  // Blocks are filled and consumed in turn, so block i % kNumDecompressBlock
+  // is the i-th to be filled. Both counts are guarded by mutex_
+  HighsInt num_filled_ = 0;
+  HighsInt num_consumed_ = 0;
+  bool holding_block_ = false;
+  bool done_ = false;
+  bool error_ = false;
+  bool stop_ = false;
+  std::mutex mutex_;
+  std::condition_variable filled_;
+  std::condition_variable consumed_;
+  std::thread thread_;
+};
+
+GzipStreambuf::GzipStreambuf(gzFile file) : file_(file) {
+  for (HighsInt i = 0; i < kNumDecompressBlock; i++)
+    block_[i].resize(kDecompressBlockSize);
+  thread_ = std::thread(&GzipStreambuf::decompress, this);
+}
+
+GzipStreambuf::~GzipStreambuf() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  consumed_.notify_one();
+  thread_.join();
+  gzclose(file_);
+}
+
+void GzipStreambuf::decompress() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    consumed_.wait(lock, [this] {
+      return stop_ || num_filled_ - num_consumed_ < kNumDecompressBlock;
+    });
+    if (stop_) break;
+    const HighsInt block = num_filled_ % kNumDecompressBlock;
+    // The block is not visible to the parser until num_filled_ is
+    // increased, so it can be filled without holding the lock
+    lock.unlock();
+    const int num_read =
+        gzread(file_, block_[block].data(), kDecompressBlockSize);
+    lock.lock();
+    if (num_read <= 0) {
+      error_ = num_read < 0;
+      done_ = true;
+      filled_.notify_one();
+      break;
+    }
+    block_size_[block] = num_read;
+    num_filled_++;
+    filled_.notify_one();
+  }
+}
+
+GzipStreambuf::int_type GzipStreambuf::underflow() {
+  if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (holding_block_) {
+    // Hand the block that has been parsed back to the decompressing thread
+    holding_block_ = false;
+    num_consumed_++;
+    consumed_.notify_one();
+  }
+  filled_.wait(lock, [this] { return done_ || num_filled_ > num_consumed_; });
+  if (num_filled_ == num_consumed_) {
+    // Throwing sets badbit on the stream, so that a corrupt file is not
+    // mistaken for one that has simply ended
+    if (error_) throw std::ios_base::failure("gzread failed");
+    return traits_type::eof();
+  }
+  const HighsInt block = num_consumed_ % kNumDecompressBlock;
+  holding_block_ = true;
+  char* data = block_[block].data();
+  setg(data, data, data + block_size_[block]);
+  return traits_type::to_int_type(*gptr());
+}
+#endif
+
+HighsInputStream::HighsInputStream(const std::string& filename)
+    : std::istream(nullptr) {
+  if (isCompressedFilename(filename)) {
+#ifdef ZLIB_FOUND
+    gzFile file = gzopen(filename.c_str(), "rb");
+    if (file != nullptr) {
+      gzbuffer(file, kCompressedBufferSize);
+      buffer_.reset(new GzipStreambuf(file));
+    }
+#endif
+  } else {
+    BufferedFilebuf* file_buffer = new BufferedFilebuf();
+    buffer_.reset(file_buffer);
+    if (!file_buffer->open(filename.c_str(), std::ios::in)) buffer_.reset();
+  }
+  rdbuf(buffer_.get());
+  if (buffer_ == nullptr) setstate(std::ios::failbit);
+}
+
+HighsInputStream::~HighsInputStream() { close(); }
+
+void HighsInputStream::close() {
+  rdbuf(nullptr);
+  buffer_.reset();
+}
+
+bool isCompressedFilename(const std::string& filename) {
+  const std::size_t ext_size = kCompressedFilenameExt.size();
+  return filename.size() > ext_size &&
+         filename.compare(filename.size() - ext_size, ext_size,
+                          kCompressedFilenameExt) == 0;
+}
+
+std::string uncompressedFilename(const std::string& filename) {
+  if (!isCompressedFilename(filename)) return filename;
+  return filename.substr(0, filename.size() - kCompressedFilenameExt.size());
+}
+
+bool canReadCompressedFile() {
+#ifdef ZLIB_FOUND
+  return true;
+#else
+  return false;
+#endif
+}
+
+char* getStreamLine(std::istream& stream, char* line, const HighsInt lmax) {
+  if (lmax < 2) return nullptr;
+  // Reads up to lmax-1 characters, stopping before any newline
+  stream.get(line, lmax);
+  HighsInt count = stream.gcount();
+  // An empty line sets failbit, which would stop all further reads
+  if (count == 0) stream.clear(stream.rdstate() & ~std::ios::failbit);
+  if (count < lmax - 1 && stream.peek() == '\n') {
+    stream.get();
+    line[count++] = '\n';
+    line[count] = '\0';
+  }
+  if (count == 0) return nullptr;
+  return line;
+}
@@ -0,0 +1,58 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsInputStream.h
+ * @brief Buffered input stream for model files, which may be compressed
+ *
+ * A file whose name ends in ".gz" is decompressed by a separate thread
+ * into a ring of large blocks while the parser consumes earlier blocks,
+ * so decompression overlaps with parsing. Other files are read through
+ * a large std::filebuf buffer.
+ */
+#ifndef IO_HIGHS_INPUT_STREAM_H_
+#define IO_HIGHS_INPUT_STREAM_H_
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+#include "util/HighsInt.h"
+
+const std::string kCompressedFilenameExt = ".gz";
+
+class HighsInputStream : public std::istream {
+ public:
+  explicit HighsInputStream(const std::string& filename);
+  ~HighsInputStream();
+  bool is_open() const { return buffer_ != nullptr; }
+  void close();
+
+ private:
+  std::unique_ptr<std::streambuf> buffer_;
+};
+
+// Whether the file is compressed, judging by its name
+bool isCompressedFilename(const std::string& filename);
+
+// The filename without any compression extension
+std::string uncompressedFilename(const std::string& filename);
+
+// Whether compressed files can be read by this build
+bool canReadCompressedFile();
+
+// Read a line of at most lmax-1 characters into line, with the same
+// semantics as fgets: any newline is kept and a line that is too long
+// is returned in pieces. Returns nullptr at end of input.
+char* getStreamLine(std::istream& stream, char* line, const HighsInt lmax);
+
+#endif
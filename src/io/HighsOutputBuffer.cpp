@@ -0,0 +1,142 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsOutputBuffer.cpp
+ * @brief
+ */
+#include "io/HighsOutputBuffer.h"
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdlib>
+
+// Integers of smaller magnitude are written by %.15g without an exponent
+const double kMaxOutputIntegerValue = 1e15;
+// Nor are values of at least this magnitude
+const double kMinOutputFixedValue = 1e-4;
+// Values with up to this many decimal places are written without snprintf
+const HighsInt kMaxOutputDecimalPlaces = 9;
+
+void HighsOutputBuffer::appendPadded(const std::string& text,
+                                     const HighsInt width) {
+  text_.append(text);
+  if ((HighsInt)text.size() < width) text_.append(width - text.size(), ' ');
+}
+
+static void appendInteger(std::string& text, const int64_t value) {
+  char digits[24];
+  HighsInt num_digit = 0;
+  // Negate in unsigned arithmetic so that the most negative value is safe
+  uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+  do {
+    digits[num_digit++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude);
+  if (value < 0) text.push_back('-');
+  while (num_digit) text.push_back(digits[--num_digit]);
+}
+
+// Writes value / 10^decimal_places in fixed notation, without trailing
+// zeros after the decimal point
+static void appendDecimal(std::string& text, const int64_t value,
+                          const HighsInt decimal_places) {
+  char digits[24];
+  HighsInt num_digit = 0;
+  uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+  while (magnitude || num_digit <= decimal_places) {
+    digits[num_digit++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  }
+  HighsInt last_digit = 0;
+  while (last_digit < decimal_places && digits[last_digit] == '0')
+    last_digit++;
+  if (value < 0) text.push_back('-');
+  while (num_digit > decimal_places) text.push_back(digits[--num_digit]);
+  if (num_digit == last_digit) return;
+  text.push_back('.');
+  while (num_digit > last_digit) text.push_back(digits[--num_digit]);
+}
+
+void HighsOutputBuffer::appendInt(const HighsInt value) {
+  appendInteger(text_, value);
+}
+
+void HighsOutputBuffer::appendDouble(const double value) {
+  // Integer values are common in models, and are written without
+  // snprintf, exactly as %.15g would write them
+  if (std::fabs(value) < kMaxOutputIntegerValue &&
+      value == (double)(int64_t)value) {
+    if (value == 0 && std::signbit(value)) text_.push_back('-');
+    appendInteger(text_, (int64_t)value);
+    return;
+  }
+  // So are values with a few decimal places. If value * 10^d is an
+  // integer r, and r / 10^d is value, then the decimal r * 10^-d reads
+  // back as value since both are correctly rounded
+  const double magnitude = std::fabs(value);
+  if (magnitude >= kMinOutputFixedValue &&
+      magnitude < kMaxOutputIntegerValue) {
+    double scale = 1;
+    for (HighsInt decimal_places = 1;
+         decimal_places <= kMaxOutputDecimalPlaces; decimal_places++) {
+      scale *= 10;
+      const double scaled = value * scale;
+      if (std::fabs(scaled) >= kMaxOutputIntegerValue) break;
+      if (scaled != std::floor(scaled) || scaled / scale != value) continue;
+      appendDecimal(text_, (int64_t)scaled, decimal_places);
+      return;
+    }
+  }
+  // Use the fewest significant digits that read back as the same value:
+  // %.17g always does, but 15 digits are enough for most values
+  char number[32];
+  if (std::isfinite(value)) {
+    for (int precision = 15; precision < 17; precision++) {
+      snprintf(number, sizeof(number), "%.*g", precision, value);
+      if (strtod(number, nullptr) == value) {
+        text_.append(number);
+        return;
+      }
+    }
+  }
+  snprintf(number, sizeof(number), "%.17g", value);
+  text_.append(number);
+}
+
+void HighsOutputBuffer::appendSignedDouble(const double value) {
+  if (!std::signbit(value)) text_.push_back('+');
+  appendDouble(value);
+}
+
+void HighsOutputBuffer::appendFormat(const char* format, ...) {
+  va_list argptr;
+  va_start(argptr, format);
+  char text[256];
+  const int length = vsnprintf(text, sizeof(text), format, argptr);
+  va_end(argptr);
+  if (length < (int)sizeof(text)) {
+    text_.append(text);
+  } else {
+    std::vector<char> long_text(length + 1);
+    va_start(argptr, format);
+    vsnprintf(long_text.data(), long_text.size(), format, argptr);
+    va_end(argptr);
+    text_.append(long_text.data());
+  }
+}
+
+bool HighsOutputBuffer::write(FILE* file) {
+  const bool ok = fwrite(text_.data(), 1, text_.size(), file) == text_.size();
+  text_.clear();
+  return ok;
+}
@@ -0,0 +1,98 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsOutputBuffer.h
+ * @brief Text formatted in memory before being written to a file
+ *
+ * Model and solution files are formatted into buffers, with the lines
+ * for blocks of rows or columns formatted in parallel, and the buffers
+ * are written to the file in order with a few large writes. The file is
+ * the same for any number of threads.
+ */
+#ifndef IO_HIGHS_OUTPUT_BUFFER_H_
+#define IO_HIGHS_OUTPUT_BUFFER_H_
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "util/HighsInt.h"
+
+class HighsOutputBuffer {
+ public:
+  void append(const char* text) { text_.append(text); }
+  void append(const std::string& text) { text_.append(text); }
+  void append(const char c) { text_.push_back(c); }
+  // As %-<width>s
+  void appendPadded(const std::string& text, const HighsInt width);
+  void appendInt(const HighsInt value);
+  // The shortest %g representation that reads back as the same value
+  void appendDouble(const double value);
+  // As %+g, but with the representation of appendDouble
+  void appendSignedDouble(const double value);
+  void appendFormat(const char* format, ...);
+  void insert(const size_t position, const char c) {
+    text_.insert(position, 1, c);
+  }
+  size_t size() const { return text_.size(); }
+  void clear() { text_.clear(); }
+  // Writes the text to the file and clears the buffer
+  bool write(FILE* file);
+
+ private:
+  std::string text_;
+};
+
+// Number of items formatted in each block, and the number of blocks
+// formatted at once before they are written
+const HighsInt kOutputBlockSize = 1 << 14;
+const HighsInt kNumOutputBlock = 64;
+
+// Formats items [0, num_item) with format(buffer, from, to) for blocks of
+// consecutive items, and writes the blocks to the file in order. If
+// item_start is given, each block spans about kOutputBlockSize entries
+// of item_start, so blocks of columns can be sized by their nonzeros.
+template <typename Format>
+bool writeOutputBlocks(FILE* file, const HighsInt num_item,
+                       const HighsInt* item_start, Format format) {
+  std::vector<HighsInt> block_start;
+  block_start.push_back(0);
+  HighsInt block_work = 0;
+  for (HighsInt item = 0; item < num_item; item++) {
+    block_work += item_start ? item_start[item + 1] - item_start[item] : 0;
+    block_work++;
+    if (block_work >= kOutputBlockSize) {
+      block_start.push_back(item + 1);
+      block_work = 0;
+    }
+  }
+  if (block_start.back() < num_item) block_start.push_back(num_item);
+  const HighsInt num_block = block_start.size() - 1;
+
+  std::vector<HighsOutputBuffer> buffer(std::min(num_block, kNumOutputBlock));
+  for (HighsInt from_block = 0; from_block < num_block;
+       from_block += kNumOutputBlock) {
+    const HighsInt to_block =
+        std::min(from_block + kNumOutputBlock, num_block);
+    const HighsInt batch_size = to_block - from_block;
+#pragma omp parallel for schedule(dynamic) if (batch_size > 1)
+    for (HighsInt block = 0; block < batch_size; block++)
+      format(buffer[block], block_start[from_block + block],
+             block_start[from_block + block + 1]);
+    for (HighsInt block = 0; block < batch_size; block++)
+      if (!buffer[block].write(file)) return false;
+  }
+  return true;
+}
+
+#endif
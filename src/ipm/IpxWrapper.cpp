@@ -488,6 +488,30 @@ void reportIpmNoProgress(const HighsOptions& options,
                ipx_info.abs_dresidual);
 }
 
+ipx::Int ipxIterationCallback(ipx::Int iter, double pobjective,
+                              double dobjective, void* data) {
+  IpxCallbackData& callback_data = *(IpxCallbackData*)data;
+  const HighsOptions& options = *callback_data.options;
+  const HighsLp& lp = *callback_data.lp;
+  // IPX minimizes the costs multiplied by the sense of the LP, and
+  // without the offset
+  const double sense = (HighsInt)lp.sense_;
+  HighsCallbackDataOut data_out = {};
+  data_out.running_time = callback_data.timer->readRunHighsClock();
+  data_out.ipm_iteration_count = callback_data.ipm_iteration_count + iter;
+  data_out.objective_function_value = sense * pobjective + lp.offset_;
+  data_out.ipm_dual_objective_value = sense * dobjective + lp.offset_;
+  data_out.mip_primal_bound = kHighsInf;
+  data_out.mip_dual_bound = -kHighsInf;
+  data_out.mip_gap = kHighsInf;
+  if (options.user_callback(kHighsCallbackIpmIteration, &data_out,
+                            options.user_callback_data)) {
+    callback_data.interrupted = true;
+    return 1;
+  }
+  return 0;
+}
+
 void getHighsNonVertexSolution(const HighsLogOptions& log_options,
                                const HighsLp& lp, const ipx::Int num_col,
                                const ipx::Int num_row,
@@ -596,6 +620,11 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
 
   // Set the internal IPX parameters
   lps.SetParameters(parameters);
+  // Pass IPM iterations to any user callback
+  IpxCallbackData callback_data = {&options, &timer, &lp,
+                                   iteration_counts.ipm, false};
+  if (options.user_callback != NULL)
+    lps.SetIterationCallback(ipxIterationCallback, &callback_data);
 
   ipx::Int num_col, num_row;
   std::vector<ipx::Int> Ap, Ai;
@@ -697,7 +726,9 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
     // Can stop with iter limit
     // Can stop with no progress
     if (ipx_info.status_ipm == IPX_STATUS_time_limit) {
-      model_status = HighsModelStatus::kTimeLimit;
+      // The user callback interrupts IPX as if the time limit is reached
+      model_status = callback_data.interrupted ? HighsModelStatus::kInterrupt
+                                               : HighsModelStatus::kTimeLimit;
       return HighsStatus::kWarning;
     } else if (ipx_info.status_ipm == IPX_STATUS_iter_limit) {
       model_status = HighsModelStatus::kIterationLimit;
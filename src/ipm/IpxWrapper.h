@@ -58,6 +58,19 @@ bool illegalIpxStoppedCrossoverStatus(const ipx::Info& ipx_info,
 void reportIpmNoProgress(const HighsOptions& options,
                          const ipx::Info& ipx_info);
 
+// Data for passing IPM iterations to the user callback, recording
+// whether it interrupted IPX
+struct IpxCallbackData {
+  const HighsOptions* options;
+  HighsTimer* timer;
+  const HighsLp* lp;
+  HighsInt ipm_iteration_count;
+  bool interrupted;
+};
+
+ipx::Int ipxIterationCallback(ipx::Int iter, double pobjective,
+                              double dobjective, void* data);
+
 void getHighsNonVertexSolution(const HighsLogOptions& log_options,
                                const HighsLp& lp, const ipx::Int num_col,
                                const ipx::Int num_row,
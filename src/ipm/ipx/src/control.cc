@@ -17,6 +17,20 @@ Int Control::InterruptCheck() const {
     return 0;
 }
 
+void Control::SetIterationCallback(IterationCallback callback, void* data) {
+    iteration_callback_ = callback;
+    iteration_callback_data_ = data;
+}
+
+Int Control::IterationCallbackCheck(Int iter, double pobjective,
+                                    double dobjective) const {
+    if (iteration_callback_ &&
+        iteration_callback_(iter, pobjective, dobjective,
+                            iteration_callback_data_))
+        return IPX_ERROR_interrupt_time;
+    return 0;
+}
+
 std::ostream& Control::Log() const {
     return output_;
 }
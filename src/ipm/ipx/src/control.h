@@ -40,6 +40,18 @@ public:
     // Returns IPX_ERROR_* if interrupt is requested, 0 otherwise.
     Int InterruptCheck() const;
 
+    // A callback can be called after each IPM iteration with the iteration
+    // count and the primal and dual objective values of the iterate after
+    // postprocessing. If it
+    // returns nonzero, IterationCallbackCheck() returns
+    // IPX_ERROR_interrupt_time, so that the solver stops as if the time
+    // limit had been reached.
+    typedef Int (*IterationCallback)(Int iter, double pobjective,
+                                     double dobjective, void* data);
+    void SetIterationCallback(IterationCallback callback, void* data);
+    Int IterationCallbackCheck(Int iter, double pobjective,
+                               double dobjective) const;
+
     // Returns output streams for log and debugging messages. The streams
     // evaluate to false if they discard output, so that we can write
     //
@@ -104,6 +116,8 @@ private:
     mutable Timer interval_;     // time since last interval log
     mutable Multistream output_; // forwards to logfile and/or console
     mutable Multistream dummy_;  // discards everything
+    IterationCallback iteration_callback_{nullptr};
+    void* iteration_callback_data_{nullptr};
 };
 
 // Formats integer, string literal or floating point value into a string of
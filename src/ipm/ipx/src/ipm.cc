@@ -78,6 +78,10 @@ void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
         MakeStep(step);
         info->iter++;
         PrintOutput();
+        if ((info->errflag = control_.IterationCallbackCheck(
+                 info->iter, iterate->pobjective_after_postproc(),
+                 iterate->dobjective_after_postproc())) != 0)
+            break;
     }
 
     // Set status_ipm if errflag terminated IPM.
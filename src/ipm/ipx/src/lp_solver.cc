@@ -141,6 +141,11 @@ void LpSolver::SetParameters(Parameters new_parameters) {
     control_.parameters(new_parameters);
 }
 
+void LpSolver::SetIterationCallback(Control::IterationCallback callback,
+                                    void* data) {
+    control_.SetIterationCallback(callback, data);
+}
+
 void LpSolver::ClearModel() {
     model_.clear();
     ClearSolution();
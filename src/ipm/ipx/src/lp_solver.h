@@ -100,6 +100,11 @@ public:
     Parameters GetParameters() const;
     void SetParameters(Parameters new_parameters);
 
+    // Sets a callback to be called after each IPM iteration. See
+    // Control::SetIterationCallback().
+    void SetIterationCallback(Control::IterationCallback callback,
+                              void* data);
+
     // Discards the model and solution (if any) but keeps the parameters.
     void ClearModel();
 
@@ -143,8 +143,9 @@ enum class HighsModelStatus {
   kTimeLimit,
   kIterationLimit,
   kUnknown,
+  kInterrupt,
   kMin = kNotset,
-  kMax = kUnknown
+  kMax = kInterrupt
 };
 
 /** SCIP/CPLEX-like HiGHS basis status for columns and rows. */
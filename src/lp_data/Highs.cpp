@@ -23,7 +23,9 @@
 
 #include "HConfig.h"
 #include "io/Filereader.h"
+#include "io/FilereaderBinary.h"
 #include "io/HighsIO.h"
+#include "io/HighsInputStream.h"
 #include "io/LoadOptions.h"
 #include "lp_data/HighsInfoDebug.h"
 #include "lp_data/HighsLpUtils.h"
@@ -33,6 +35,7 @@
 #include "mip/HighsMipSolver.h"
 #include "model/HighsHessianUtils.h"
 #include "presolve/ICrashX.h"
+#include "qpsolver/interiorpoint.hpp"
 #include "qpsolver/solver.hpp"
 #include "simplex/HSimplexDebug.h"
 #include "util/HighsMatrixPic.h"
@@ -123,6 +126,24 @@ HighsStatus Highs::passOptions(const HighsOptions& options) {
   return HighsStatus::kError;
 }
 
+HighsStatus Highs::setLogCallback(
+    void (*printmsgcb)(HighsInt level, const char* msg, void* msgcb_data),
+    void (*logmsgcb)(HighsLogType type, const char* msg, void* msgcb_data),
+    void* msgcb_data) {
+  options_.printmsgcb = printmsgcb;
+  options_.logmsgcb = logmsgcb;
+  options_.msgcb_data = msgcb_data;
+  highsSetLogCallback(options_);
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::setCallback(HighsCallbackFunctionType user_callback,
+                               void* user_callback_data) {
+  options_.user_callback = user_callback;
+  options_.user_callback_data = user_callback_data;
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::getOptionValue(const std::string& option, bool& value) {
   if (getLocalOptionValue(options_.log_options, option, options_.records,
                           value) == OptionStatus::kOk)
@@ -281,7 +302,13 @@ HighsStatus Highs::passModel(HighsModel model) {
   return returnFromHighs(return_status);
 }
 
-HighsStatus Highs::passModel(HighsLp lp) {
+HighsStatus Highs::passModel(const HighsLp& lp) {
+  HighsModel model;
+  model.lp_ = lp;
+  return passModel(std::move(model));
+}
+
+HighsStatus Highs::passModel(HighsLp&& lp) {
   HighsModel model;
   model.lp_ = std::move(lp);
   return passModel(std::move(model));
@@ -327,12 +354,23 @@ HighsStatus Highs::passModel(
     assert(aindex != NULL);
     assert(avalue != NULL);
     if (a_rowwise) {
-      lp.a_start_.assign(astart, astart + num_row);
+      // Form the column-wise matrix directly from the arrays, so that a
+      // row-wise copy isn't held while it is transposed
+      if (!colWiseMatrixFromRowWise(num_col, num_row, num_nz, astart, aindex,
+                                    avalue, lp.a_start_, lp.a_index_,
+                                    lp.a_value_)) {
+        highsLogUser(options_.log_options, HighsLogType::kError,
+                     "Row-wise matrix has illegal starts or indices\n");
+        return HighsStatus::kError;
+      }
+      a_rowwise = false;
     } else {
+      // Reserve space for the final start so that it's not reallocated
+      lp.a_start_.reserve(num_col + 1);
       lp.a_start_.assign(astart, astart + num_col);
+      lp.a_index_.assign(aindex, aindex + num_nz);
+      lp.a_value_.assign(avalue, avalue + num_nz);
     }
-    lp.a_index_.assign(aindex, aindex + num_nz);
-    lp.a_value_.assign(avalue, avalue + num_nz);
   }
   if (a_rowwise) {
     lp.a_start_.resize(num_row + 1);
@@ -445,8 +483,9 @@ HighsStatus Highs::readModel(const std::string filename) {
   }
 
   HighsModel model;
+  HighsBasis read_basis;
   FilereaderRetcode call_code =
-      reader->readModelFromFile(options_, filename, model);
+      reader->readModelAndBasisFromFile(options_, filename, model, read_basis);
   delete reader;
   if (call_code != FilereaderRetcode::kOk) {
     interpretFilereaderRetcode(options_.log_options, filename.c_str(),
@@ -458,6 +497,11 @@ HighsStatus Highs::readModel(const std::string filename) {
   model.lp_.model_name_ = extractModelName(filename);
   return_status = interpretCallStatus(passModel(std::move(model)),
                                       return_status, "passModel");
+  if (return_status == HighsStatus::kError) return return_status;
+  // Use any basis that was read with the model
+  if (read_basis.valid)
+    return_status = interpretCallStatus(setBasis(read_basis), return_status,
+                                        "setBasis");
   return returnFromHighs(return_status);
 }
 
@@ -465,9 +509,23 @@ HighsStatus Highs::readBasis(const std::string filename) {
   HighsStatus return_status = HighsStatus::kOk;
   // Try to read basis file into read_basis
   HighsBasis read_basis = basis_;
-  return_status = interpretCallStatus(
-      readBasisFile(options_.log_options, read_basis, filename), return_status,
-      "readBasis");
+  if (isBinarySolutionFilename(filename)) {
+    HighsSolution read_solution;
+    return_status = interpretCallStatus(
+        readBinarySolutionFile(options_.log_options, filename,
+                               model_.lp_.num_col_, model_.lp_.num_row_,
+                               read_solution, read_basis),
+        return_status, "readBinarySolutionFile");
+    if (return_status == HighsStatus::kOk && !read_basis.valid) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "readBasis: %s has no basis\n", filename.c_str());
+      return_status = HighsStatus::kError;
+    }
+  } else {
+    return_status = interpretCallStatus(
+        readBasisFile(options_.log_options, read_basis, filename),
+        return_status, "readBasis");
+  }
   if (return_status != HighsStatus::kOk) return return_status;
   // Basis read OK: check whether it's consistent with the LP
   if (!isBasisConsistent(model_.lp_, read_basis)) {
@@ -485,6 +543,37 @@ HighsStatus Highs::readBasis(const std::string filename) {
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::readSolution(const std::string filename) {
+  HighsStatus return_status = HighsStatus::kOk;
+  if (!isBinarySolutionFilename(filename)) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "readSolution: Only %s files can be read\n",
+                 kBinarySolutionFilenameExt.c_str());
+    return HighsStatus::kError;
+  }
+  HighsSolution read_solution;
+  HighsBasis read_basis;
+  return_status = interpretCallStatus(
+      readBinarySolutionFile(options_.log_options, filename,
+                             model_.lp_.num_col_, model_.lp_.num_row_,
+                             read_solution, read_basis),
+      return_status, "readBinarySolutionFile");
+  if (return_status != HighsStatus::kOk) return return_status;
+  if (read_basis.valid && !isBasisConsistent(model_.lp_, read_basis)) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "readSolution: invalid basis\n");
+    return HighsStatus::kError;
+  }
+  // The values were written for this model, so are used as they are
+  // rather than through setSolution, which recomputes row values
+  solution_ = std::move(read_solution);
+  if (read_basis.valid) {
+    basis_ = std::move(read_basis);
+    if (hmos_.size() > 0) clearBasisInterface();
+  }
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::writeModel(const std::string filename) {
   HighsStatus return_status = HighsStatus::kOk;
 
@@ -497,15 +586,18 @@ HighsStatus Highs::writeModel(const std::string filename) {
     reportModel();
     return_status = HighsStatus::kOk;
   } else {
-    Filereader* writer = Filereader::getFilereader(filename);
+    // Model files are only written uncompressed
+    Filereader* writer = isCompressedFilename(filename)
+                             ? NULL
+                             : Filereader::getFilereader(filename);
     if (writer == NULL) {
       highsLogUser(options_.log_options, HighsLogType::kError,
                    "Model file %s not supported\n", filename.c_str());
       return HighsStatus::kError;
     }
     return_status = interpretCallStatus(
-        writer->writeModelToFile(options_, filename, model_), return_status,
-        "writeModelToFile");
+        writer->writeModelAndBasisToFile(options_, filename, model_, basis_),
+        return_status, "writeModelToFile");
     delete writer;
   }
   return returnFromHighs(return_status);
@@ -513,6 +605,19 @@ HighsStatus Highs::writeModel(const std::string filename) {
 
 HighsStatus Highs::writeBasis(const std::string filename) {
   HighsStatus return_status = HighsStatus::kOk;
+  if (isBinarySolutionFilename(filename)) {
+    if (!basis_.valid) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "writeBasis: Cannot write an invalid basis\n");
+      return HighsStatus::kError;
+    }
+    return_status = interpretCallStatus(
+        writeBinarySolutionFile(options_.log_options, filename,
+                                model_.lp_.num_col_, model_.lp_.num_row_,
+                                HighsSolution(), basis_),
+        return_status, "writeBinarySolutionFile");
+    return returnFromHighs(return_status);
+  }
   return_status = interpretCallStatus(
       writeBasisFile(options_.log_options, basis_, filename), return_status,
       "writeBasis");
@@ -523,6 +628,7 @@ HighsStatus Highs::writeBasis(const std::string filename) {
 // with callSolveLp(..)
 HighsStatus Highs::run() {
   if (!haveHmo("run")) return HighsStatus::kError;
+  rows_added_since_run_ = false;
   // Ensure that there is exactly one Highs model object
   assert((HighsInt)hmos_.size() == 1);
   HighsInt min_highs_debug_level = kHighsDebugLevelMin;
@@ -624,7 +730,9 @@ HighsStatus Highs::run() {
     highsLogDev(options_.log_options, HighsLogType::kVerbose,
                 "Solving model: %s\n", model_.lp_.model_name_.c_str());
 
-  if (!options_.solver.compare(kHighsChooseString) && model_.isQp()) {
+  if ((!options_.solver.compare(kHighsChooseString) ||
+       !options_.solver.compare(kIpmString)) &&
+      model_.isQp()) {
     // Solve the model as a QP
     call_status = callSolveQp();
     return_status =
@@ -990,7 +1098,8 @@ HighsStatus Highs::run() {
            solved_model_status == HighsModelStatus::kUnbounded ||
            solved_model_status == HighsModelStatus::kUnboundedOrInfeasible ||
            solved_model_status == HighsModelStatus::kTimeLimit ||
-           solved_model_status == HighsModelStatus::kIterationLimit);
+           solved_model_status == HighsModelStatus::kIterationLimit ||
+           solved_model_status == HighsModelStatus::kInterrupt);
     setHighsModelStatusAndInfo(solved_model_status);
   } else {
     setHighsModelStatusBasisSolutionAndInfo();
@@ -1060,6 +1169,46 @@ HighsStatus Highs::run() {
   return returnFromRun(return_status);
 }
 
+HighsStatus Highs::solveBatch(const std::vector<HighsLp>& lps,
+                              std::vector<HighsModelStatus>& model_status,
+                              std::vector<HighsSolution>& solution,
+                              std::vector<double>& objective_function_value) {
+  const HighsInt num_lp = lps.size();
+  model_status.assign(num_lp, HighsModelStatus::kNotset);
+  solution.assign(num_lp, HighsSolution());
+  objective_function_value.assign(num_lp, 0);
+  std::vector<HighsStatus> run_status(num_lp, HighsStatus::kOk);
+  HighsInt num_thread = 1;
+#ifdef OPENMP
+  num_thread = std::max(1, std::min(omp_get_max_threads(), (int)num_lp));
+#endif
+  // Setting up a Highs instance, with its options and timer, can cost
+  // more than solving a small LP, so each thread sets up one instance
+  // and reuses it. Each LP is passed to it afresh, so the results don't
+  // depend on which thread solves which LP
+#pragma omp parallel num_threads(num_thread)
+  {
+    Highs highs;
+    highs.passOptions(options_);
+    highs.setLogCallback(options_.printmsgcb, options_.logmsgcb,
+                         options_.msgcb_data);
+    highs.setCallback(options_.user_callback, options_.user_callback_data);
+#pragma omp for schedule(dynamic)
+    for (HighsInt iLp = 0; iLp < num_lp; iLp++) {
+      run_status[iLp] = highs.passModel(lps[iLp]);
+      if (run_status[iLp] == HighsStatus::kError) continue;
+      run_status[iLp] = highs.run();
+      model_status[iLp] = highs.getModelStatus();
+      solution[iLp] = highs.getSolution();
+      objective_function_value[iLp] = highs.getInfo().objective_function_value;
+    }
+  }
+  HighsStatus return_status = HighsStatus::kOk;
+  for (HighsInt iLp = 0; iLp < num_lp; iLp++)
+    return_status = interpretCallStatus(run_status[iLp], return_status);
+  return return_status;
+}
+
 HighsStatus Highs::getDualRay(bool& has_dual_ray, double* dual_ray_value) {
   if (!haveHmo("getDualRay")) return HighsStatus::kError;
   return getDualRayInterface(has_dual_ray, dual_ray_value);
@@ -1320,6 +1469,37 @@ HighsStatus Highs::getReducedColumn(const HighsInt col, double* col_vector,
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::getBasisInverseRows(const HighsInt num_set_entries,
+                                       const HighsInt* row_set,
+                                       std::vector<HighsInt>& row_start,
+                                       std::vector<HighsInt>& row_index,
+                                       std::vector<double>& row_value) {
+  if (!haveHmo("getBasisInverseRows")) return HighsStatus::kError;
+  if (checkBasisInverseRowSet(num_set_entries, row_set,
+                              "getBasisInverseRows") != HighsStatus::kOk)
+    return HighsStatus::kError;
+  return basisInverseRowsInterface(num_set_entries, row_set, false, row_start,
+                                   row_index, row_value);
+}
+
+HighsStatus Highs::getReducedRows(const HighsInt num_set_entries,
+                                  const HighsInt* row_set,
+                                  std::vector<HighsInt>& row_start,
+                                  std::vector<HighsInt>& row_index,
+                                  std::vector<double>& row_value) {
+  if (!haveHmo("getReducedRows")) return HighsStatus::kError;
+  // Ensure that the LP is column-wise
+  HighsStatus return_status = HighsStatus::kOk;
+  return_status =
+      interpretCallStatus(setFormat(model_.lp_), return_status, "setFormat");
+  if (return_status == HighsStatus::kError) return return_status;
+  if (checkBasisInverseRowSet(num_set_entries, row_set, "getReducedRows") !=
+      HighsStatus::kOk)
+    return HighsStatus::kError;
+  return basisInverseRowsInterface(num_set_entries, row_set, true, row_start,
+                                   row_index, row_value);
+}
+
 HighsStatus Highs::setSolution(const HighsSolution& solution) {
   HighsStatus return_status = HighsStatus::kOk;
   // Check if primal solution is valid.
@@ -1387,6 +1567,22 @@ HighsStatus Highs::setBasis() {
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::setQpHotStart(const HighsBasis& active_set,
+                                 const std::vector<double>& col_value) {
+  if ((HighsInt)active_set.col_status.size() != model_.lp_.num_col_ ||
+      (HighsInt)active_set.row_status.size() != model_.lp_.num_row_ ||
+      (HighsInt)col_value.size() != model_.lp_.num_col_) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "setQpHotStart: active set or column values of the wrong "
+                 "size\n");
+    return HighsStatus::kError;
+  }
+  qp_hot_start_active_set_ = active_set;
+  qp_hot_start_active_set_.valid = true;
+  qp_hot_start_col_value_ = col_value;
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::addRow(const double lower_bound, const double upper_bound,
                           const HighsInt num_new_nz, const HighsInt* indices,
                           const double* values) {
@@ -2215,7 +2411,10 @@ void Highs::clearSolution() {
   clearSolutionUtil(solution_);
 }
 
-void Highs::clearBasis() { clearBasisUtil(basis_); }
+void Highs::clearBasis() {
+  clearBasisUtil(basis_);
+  clearBasisUtil(qp_active_set_);
+}
 
 void Highs::clearInfo() { info_.clear(); }
 
@@ -2325,11 +2524,42 @@ HighsStatus Highs::callSolveQp() {
                  rt.statistics.density_nullspace[rep],
                  rt.statistics.density_factor[rep]);
   });
-  runtime.settings.iterationlimit = std::numeric_limits<int>::max();
-  runtime.settings.ratiotest =
-      new RatiotestTwopass(instance, 0.000000001, 0.000001);
-  Solver solver(runtime);
-  solver.solve();
+  const bool use_ipm = !options_.solver.compare(kIpmString);
+  if (use_ipm) {
+    // Solve the QP with the interior point method, which has an iteration
+    // count that is largely independent of the number of active set changes
+    runtime.settings.reportingfequency = 1;
+    runtime.settings.iterationlimit = options_.ipm_iteration_limit;
+    runtime.settings.timelimit = options_.time_limit;
+    runtime.settings.ipm_optimality_tolerance =
+        options_.ipm_optimality_tolerance;
+    InteriorPointSolver solver(runtime);
+    solver.solve();
+  } else {
+    runtime.settings.iterationlimit = std::numeric_limits<int>::max();
+    runtime.settings.ratiotest =
+        new RatiotestTwopass(instance, 0.000000001, 0.000001);
+    runtime.settings.hotstart_feasibility_tolerance =
+        options_.primal_feasibility_tolerance;
+    Solver solver(runtime);
+    // Start from any active set and primal values passed by setQpHotStart,
+    // as when solving a sequence of QPs that differ in costs or bounds,
+    // unless the model dimensions have since changed
+    const bool hot_start =
+        qp_hot_start_active_set_.valid &&
+        (HighsInt)qp_hot_start_active_set_.col_status.size() ==
+            lp.num_col_ &&
+        (HighsInt)qp_hot_start_active_set_.row_status.size() == lp.num_row_;
+    if (hot_start) {
+      solver.solve(qp_hot_start_active_set_.col_status,
+                   qp_hot_start_active_set_.row_status,
+                   qp_hot_start_col_value_);
+    } else {
+      solver.solve();
+    }
+    clearBasisUtil(qp_hot_start_active_set_);
+    qp_hot_start_col_value_.clear();
+  }
 
   //
   // Cheating now, but need to set this honestly!
@@ -2337,11 +2567,28 @@ HighsStatus Highs::callSolveQp() {
   return_status = interpretCallStatus(call_status, return_status, "QpSolver");
   if (return_status == HighsStatus::kError) return return_status;
   // Cheating now, but need to set this honestly!
-  scaled_model_status_ = runtime.status == ProblemStatus::OPTIMAL
-                             ? HighsModelStatus::kOptimal
-                             : runtime.status == ProblemStatus::UNBOUNDED
-                                   ? HighsModelStatus::kUnbounded
-                                   : HighsModelStatus::kInfeasible;
+  switch (runtime.status) {
+    case ProblemStatus::OPTIMAL:
+      scaled_model_status_ = HighsModelStatus::kOptimal;
+      break;
+    case ProblemStatus::UNBOUNDED:
+      scaled_model_status_ = HighsModelStatus::kUnbounded;
+      break;
+    case ProblemStatus::ITERATIONLIMIT:
+      scaled_model_status_ = HighsModelStatus::kIterationLimit;
+      break;
+    case ProblemStatus::TIMELIMIT:
+      scaled_model_status_ = HighsModelStatus::kTimeLimit;
+      break;
+    case ProblemStatus::INDETERMINED:
+      // The IPM stops without a status when its iterates diverge without
+      // a ray being found, or the augmented system cannot be factorized
+      scaled_model_status_ = use_ipm ? HighsModelStatus::kSolveError
+                                     : HighsModelStatus::kInfeasible;
+      break;
+    default:
+      scaled_model_status_ = HighsModelStatus::kInfeasible;
+  }
   model_status_ = scaled_model_status_;
   solution_.col_value.resize(lp.num_col_);
   solution_.col_dual.resize(lp.num_col_);
@@ -2357,6 +2604,15 @@ HighsStatus Highs::callSolveQp() {
   }
   solution_.value_valid = true;
   solution_.dual_valid = true;
+  // Keep the active set solver's final active set for a later hot start.
+  // The IPM yields none
+  if (!use_ipm && (HighsInt)runtime.status_var.size() == lp.num_col_) {
+    qp_active_set_.col_status = runtime.status_var;
+    qp_active_set_.row_status = runtime.status_con;
+    qp_active_set_.valid = true;
+  } else {
+    clearBasisUtil(qp_active_set_);
+  }
   const double model_objective_function_value =
       model_.objectiveValue(solution_.col_value);
   //  const double runtime_objective_function_value =
@@ -2399,10 +2655,17 @@ HighsStatus Highs::callSolveQp() {
   //  Most come from solution_params...
   copyFromSolutionParams(info_, solution_params);
   // ... and iteration counts...
-  info_.simplex_iteration_count = runtime.statistics.phase1_iterations;
-  info_.ipm_iteration_count = iteration_counts_.ipm;
-  info_.crossover_iteration_count = iteration_counts_.crossover;
-  info_.qp_iteration_count = runtime.statistics.num_iterations;
+  if (use_ipm) {
+    info_.simplex_iteration_count = 0;
+    info_.ipm_iteration_count = runtime.statistics.num_iterations;
+    info_.crossover_iteration_count = 0;
+    info_.qp_iteration_count = 0;
+  } else {
+    info_.simplex_iteration_count = runtime.statistics.phase1_iterations;
+    info_.ipm_iteration_count = iteration_counts_.ipm;
+    info_.crossover_iteration_count = iteration_counts_.crossover;
+    info_.qp_iteration_count = runtime.statistics.num_iterations;
+  }
   // ... but others are QP-specific. Are there any?
   info_.valid = true;
 
@@ -2491,14 +2754,27 @@ HighsStatus Highs::writeSolution(const std::string filename,
                                  const bool pretty) const {
   HighsStatus return_status = HighsStatus::kOk;
   HighsStatus call_status;
+  if (isBinarySolutionFilename(filename))
+    return interpretCallStatus(
+        writeBinarySolutionFile(options_.log_options, filename,
+                                model_.lp_.num_col_, model_.lp_.num_row_,
+                                solution_, basis_),
+        return_status, "writeBinarySolutionFile");
   FILE* file;
   bool html;
   call_status = openWriteFile(filename, "writeSolution", file, html);
   return_status =
       interpretCallStatus(call_status, return_status, "openWriteFile");
   if (return_status == HighsStatus::kError) return return_status;
-  writeSolutionToFile(file, model_.lp_, basis_, solution_, pretty);
-  if (file != stdout) fclose(file);
+  bool write_ok =
+      writeSolutionToFile(file, model_.lp_, basis_, solution_, pretty);
+  if (file != stdout) write_ok = fclose(file) == 0 && write_ok;
+  if (!write_ok) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "writeSolution: Error writing file \"%s\"\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
   return HighsStatus::kOk;
 }
 
@@ -2692,6 +2968,41 @@ bool Highs::haveHmo(const string method_name) const {
   return have_hmo;
 }
 
+HighsStatus Highs::checkBasisInverseRowSet(const HighsInt num_set_entries,
+                                           const HighsInt* row_set,
+                                           const std::string method_name) {
+  if (num_set_entries < 0) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "%s: num_set_entries = %" HIGHSINT_FORMAT " is negative\n",
+                 method_name.c_str(), num_set_entries);
+    return HighsStatus::kError;
+  }
+  if (num_set_entries > 0 && row_set == NULL) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "%s: row_set is NULL\n", method_name.c_str());
+    return HighsStatus::kError;
+  }
+  HighsInt numRow = model_.lp_.num_row_;
+  for (HighsInt ix = 0; ix < num_set_entries; ix++) {
+    const HighsInt row = row_set[ix];
+    if (row < 0 || row >= numRow) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "Row index %" HIGHSINT_FORMAT
+                   " out of range [0, %" HIGHSINT_FORMAT "] in %s\n",
+                   row, numRow - 1, method_name.c_str());
+      return HighsStatus::kError;
+    }
+  }
+  bool has_invert = hmos_[0].ekk_instance_.status_.has_invert;
+  if (!has_invert) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "No invertible representation for %s\n",
+                 method_name.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
+
 // Applies checks before returning from run()
 HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
   assert(!called_return_from_run);
@@ -2789,6 +3100,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kUnknown:
+    case HighsModelStatus::kInterrupt:
       assert(model_status_ == scaled_model_status_);
       assert(return_status == HighsStatus::kWarning);
       break;
@@ -2827,6 +3139,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kUnknown:
+    case HighsModelStatus::kInterrupt:
       // Have info and primal solution (unless infeasible). No primal solution
       // in some other case, too!
       assert(have_info == true);
@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallbackStruct.h
+ * @brief Data passed to the user callback, usable from C and C++
+ */
+#ifndef LP_DATA_HIGHS_CALLBACK_STRUCT_H_
+#define LP_DATA_HIGHS_CALLBACK_STRUCT_H_
+
+#include "util/HighsInt.h"
+
+// Events at which the user callback is called
+const HighsInt kHighsCallbackSimplexRebuild = 0;
+const HighsInt kHighsCallbackIpmIteration = 1;
+const HighsInt kHighsCallbackMipNode = 2;
+const HighsInt kHighsCallbackMipImprovingSolution = 3;
+
+/**
+ * Progress of the solver when the user callback is called. Values that
+ * don't apply to the solver are zero, other than the MIP bounds and gap,
+ * which are infinite until they are known
+ */
+typedef struct {
+  double running_time;
+  HighsInt simplex_iteration_count;
+  HighsInt ipm_iteration_count;
+  // Current objective value of the simplex solver, or the primal
+  // objective value of the IPM iterate
+  double objective_function_value;
+  // Dual objective value of the IPM iterate
+  double ipm_dual_objective_value;
+  int64_t mip_node_count;
+  double mip_primal_bound;
+  double mip_dual_bound;
+  // Relative gap between the MIP bounds as a percentage, as in HighsInfo
+  double mip_gap;
+} HighsCallbackDataOut;
+
+/**
+ * The user callback is passed the event, the progress of the solver and
+ * the data given when it was set. A nonzero return value interrupts the
+ * solve, which returns with model status kInterrupt
+ */
+typedef HighsInt (*HighsCallbackFunctionType)(
+    const HighsInt callback_type, const HighsCallbackDataOut* data_out,
+    void* user_callback_data);
+
+#endif
@@ -13,6 +13,8 @@
 /**@file lp_data/HighsInterface.cpp
  * @brief
  */
+#include <algorithm>
+
 #include "HConfig.h"
 #include "Highs.h"
 #include "lp_data/HighsLpUtils.h"
@@ -20,6 +22,10 @@
 #include "simplex/HSimplex.h"
 #include "util/HighsSort.h"
 
+#ifdef OPENMP
+#include "omp.h"
+#endif
+
 HighsStatus Highs::addColsInterface(HighsInt XnumNewCol, const double* XcolCost,
                                     const double* XcolLower,
                                     const double* XcolUpper, HighsInt XnumNewNZ,
@@ -314,11 +320,14 @@ HighsStatus Highs::addRowsInterface(HighsInt XnumNewRow,
         return_status, "assessMatrix");
     if (return_status == HighsStatus::kError) return return_status;
     local_num_new_nz = local_ARstart[XnumNewRow];
-    // Append the rows to LP matrix
+    // Append the rows to LP matrix. The first rows added after a solve
+    // are inserted column-wise, since the LP is likely to be re-solved
+    const bool insert_colwise = !rows_added_since_run_;
+    rows_added_since_run_ = true;
     return_status = interpretCallStatus(
         appendRowsToLpMatrix(lp, XnumNewRow, local_num_new_nz,
                              &local_ARstart[0], &local_ARindex[0],
-                             &local_ARvalue[0]),
+                             &local_ARvalue[0], insert_colwise),
         return_status, "appendRowsToLpMatrix");
     if (return_status == HighsStatus::kError) return return_status;
     if (valid_simplex_lp) {
@@ -337,7 +346,7 @@ HighsStatus Highs::addRowsInterface(HighsInt XnumNewRow,
       return_status = interpretCallStatus(
           appendRowsToLpMatrix(simplex_lp, XnumNewRow, local_num_new_nz,
                                &local_ARstart[0], &local_ARindex[0],
-                               &local_ARvalue[0]),
+                               &local_ARvalue[0], insert_colwise),
           return_status, "appendRowsToLpMatrix");
       if (return_status == HighsStatus::kError) return return_status;
       // Should be extendSimplexLpRandomVectors
@@ -1536,6 +1545,139 @@ HighsStatus Highs::basisSolveInterface(const vector<double>& rhs,
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::basisInverseRowsInterface(const HighsInt num_set_entries,
+                                             const HighsInt* row_set,
+                                             const bool reduced,
+                                             vector<HighsInt>& row_start,
+                                             vector<HighsInt>& row_index,
+                                             vector<double>& row_value) {
+  HighsModelObject& highs_model_object = hmos_[0];
+  HEkk& ekk_instance = highs_model_object.ekk_instance_;
+  const HighsLp& lp = model_.lp_;
+  const HighsInt numRow = ekk_instance.lp_.num_row_;
+  const HighsInt numCol = ekk_instance.lp_.num_col_;
+  const HighsScale& scale = highs_model_object.scale_;
+  const vector<HighsInt>& basicIndex = ekk_instance.basis_.basicIndex_;
+
+  // For rows of B^{-1}A, form a row-wise copy of A so that each row
+  // is formed from the nonzeros in the row of B^{-1}
+  vector<HighsInt> ar_start;
+  vector<HighsInt> ar_index;
+  vector<double> ar_value;
+  if (reduced) {
+    ar_start.assign(numRow + 1, 0);
+    ar_index.resize(lp.a_start_[numCol]);
+    ar_value.resize(lp.a_start_[numCol]);
+    for (HighsInt el = 0; el < lp.a_start_[numCol]; el++)
+      ar_start[lp.a_index_[el] + 1]++;
+    for (HighsInt row = 0; row < numRow; row++)
+      ar_start[row + 1] += ar_start[row];
+    vector<HighsInt> ar_put = ar_start;
+    for (HighsInt col = 0; col < numCol; col++) {
+      for (HighsInt el = lp.a_start_[col]; el < lp.a_start_[col + 1]; el++) {
+        const HighsInt put = ar_put[lp.a_index_[el]]++;
+        ar_index[put] = col;
+        ar_value[put] = lp.a_value_[el];
+      }
+    }
+  }
+
+  // The rows are formed in batches of one block of BTRANs for each
+  // thread, with scratch space for each thread to form rows of B^{-1}A
+  HighsInt num_threads = 1;
+#ifdef OPENMP
+  num_threads = omp_get_max_threads();
+#endif
+  const HighsInt batch_size = kBlockSolveWidth * num_threads;
+  vector<HVector> solve_vector(min(batch_size, num_set_entries));
+  for (HVector& solve : solve_vector) solve.setup(numRow);
+  vector<vector<HighsInt>> batch_index(solve_vector.size());
+  vector<vector<double>> batch_value(solve_vector.size());
+  vector<vector<double>> thread_work;
+  vector<vector<HighsInt>> thread_list;
+  if (reduced) {
+    thread_work.assign(num_threads, vector<double>(numCol, 0));
+    thread_list.assign(num_threads, vector<HighsInt>(numCol));
+  }
+
+  row_start.assign(num_set_entries + 1, 0);
+  row_index.clear();
+  row_value.clear();
+  for (HighsInt from_entry = 0; from_entry < num_set_entries;
+       from_entry += batch_size) {
+    const HighsInt num_batch_entries =
+        min(batch_size, num_set_entries - from_entry);
+    solve_vector.resize(num_batch_entries);
+    // Set up the suitably scaled unit RHS for B^Tx=e_row
+    for (HighsInt ix = 0; ix < num_batch_entries; ix++) {
+      HVector& solve = solve_vector[ix];
+      const HighsInt row = row_set[from_entry + ix];
+      const HighsInt var = basicIndex[row];
+      solve.clear();
+      solve.count = 1;
+      solve.index[0] = row;
+      solve.array[row] =
+          var < numCol ? scale.col[var] : 1 / scale.row[var - numCol];
+    }
+    ekk_instance.factor_.btran(solve_vector, 1);
+#pragma omp parallel for schedule(dynamic)
+    for (HighsInt ix = 0; ix < num_batch_entries; ix++) {
+      const HVector& solve = solve_vector[ix];
+      vector<HighsInt>& index = batch_index[ix];
+      vector<double>& value = batch_value[ix];
+      index.clear();
+      value.clear();
+      if (!reduced) {
+        // Unscale the row of B^{-1}, listing its nonzeros in order
+        for (HighsInt iX = 0; iX < solve.count; iX++)
+          index.push_back(solve.index[iX]);
+        std::sort(index.begin(), index.end());
+        for (HighsInt row : index)
+          value.push_back(solve.array[row] * scale.row[row]);
+        continue;
+      }
+      // Form the row of B^{-1}A from the unscaled row of B^{-1}
+      HighsInt thread = 0;
+#ifdef OPENMP
+      thread = omp_get_thread_num();
+#endif
+      vector<double>& work = thread_work[thread];
+      HighsInt* list = &thread_list[thread][0];
+      HighsInt list_count = 0;
+      for (HighsInt iX = 0; iX < solve.count; iX++) {
+        const HighsInt row = solve.index[iX];
+        const double multiplier = solve.array[row] * scale.row[row];
+        for (HighsInt el = ar_start[row]; el < ar_start[row + 1]; el++) {
+          const HighsInt col = ar_index[el];
+          if (!work[col]) list[list_count++] = col;
+          work[col] += multiplier * ar_value[el];
+          // Cancellation to zero is represented by kHighsZero, so
+          // that the column isn't listed again
+          if (!work[col]) work[col] = kHighsZero;
+        }
+      }
+      std::sort(list, list + list_count);
+      for (HighsInt iX = 0; iX < list_count; iX++) {
+        const HighsInt col = list[iX];
+        if (fabs(work[col]) > kHighsTiny) {
+          index.push_back(col);
+          value.push_back(work[col]);
+        }
+        work[col] = 0;
+      }
+    }
+    // Append the rows in the batch
+    for (HighsInt ix = 0; ix < num_batch_entries; ix++) {
+      row_index.insert(row_index.end(), batch_index[ix].begin(),
+                       batch_index[ix].end());
+      row_value.insert(row_value.end(), batch_value[ix].begin(),
+                       batch_value[ix].end());
+      row_start[from_entry + ix + 1] = row_index.size();
+    }
+  }
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::getDualRayInterface(bool& has_dual_ray,
                                        double* dual_ray_value) {
   HighsModelObject& highs_model_object = hmos_[0];
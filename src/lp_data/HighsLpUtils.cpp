@@ -17,11 +17,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cctype>
 
 #include "HConfig.h"
 #include "io/Filereader.h"
 #include "io/HMPSIO.h"
 #include "io/HighsIO.h"
+#include "io/HighsInputStream.h"
+#include "io/HighsOutputBuffer.h"
 #include "lp_data/HighsModelUtils.h"
 #include "lp_data/HighsStatus.h"
 #include "util/HighsSort.h"
@@ -885,7 +888,8 @@ HighsStatus appendRowsToLpMatrix(HighsLp& lp, const HighsInt num_new_row,
                                  const HighsInt num_new_nz,
                                  const HighsInt* XARstart,
                                  const HighsInt* XARindex,
-                                 const double* XARvalue) {
+                                 const double* XARvalue,
+                                 const bool insert_colwise) {
   if (num_new_row < 0) return HighsStatus::kError;
   if (num_new_row == 0) return HighsStatus::kOk;
   // Check that nonzeros aren't being appended to a matrix with no columns
@@ -914,6 +918,15 @@ HighsStatus appendRowsToLpMatrix(HighsLp& lp, const HighsInt num_new_row,
       // then constraints one-by-one.
       lp.format_ = MatrixFormat::kRowwise;
       lp.a_start_.assign(lp.num_row_ + 1, 0);
+    } else if (num_new_nz > 0 && !insert_colwise) {
+      // Inserting rows into a column-wise matrix shifts all its
+      // entries, so each call costs O(number of nonzeros). Unless the
+      // column-wise matrix is about to be used, transpose the matrix
+      // once, after which these and any subsequent rows are appended
+      // at a cost proportional to their number of nonzeros. The matrix
+      // is restored to column-wise storage by setFormat when it is
+      // next needed in that form.
+      setFormat(lp, MatrixFormat::kRowwise);
     }
   }
   if (lp.format_ == MatrixFormat::kRowwise) {
@@ -1751,7 +1764,7 @@ void analyseScaledLp(const HighsLogOptions& log_options,
   analyseLp(log_options, scaled_lp, "Scaled");
 }
 
-void writeSolutionToFile(FILE* file, const HighsLp& lp, const HighsBasis& basis,
+bool writeSolutionToFile(FILE* file, const HighsLp& lp, const HighsBasis& basis,
                          const HighsSolution& solution, const bool pretty) {
   const bool have_value = solution.value_valid;
   const bool have_dual = solution.dual_valid;
@@ -1774,7 +1787,8 @@ void writeSolutionToFile(FILE* file, const HighsLp& lp, const HighsBasis& basis,
     use_col_status = basis.col_status;
     use_row_status = basis.row_status;
   }
-  if (!have_value && !have_dual && !have_basis) return;
+  if (!have_value && !have_dual && !have_basis) return true;
+  bool write_ok = true;
   if (pretty) {
     writeModelBoundSol(file, true, lp.num_col_, lp.col_lower_, lp.col_upper_,
                        lp.col_names_, use_col_value, use_col_dual,
@@ -1807,22 +1821,40 @@ void writeSolutionToFile(FILE* file, const HighsLp& lp, const HighsBasis& basis,
     }
     fprintf(file, " Basis\n");
     fprintf(file, "Columns\n");
-    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
-      if (have_value) fprintf(file, "%.15g", use_col_value[iCol]);
-      if (have_dual) fprintf(file, "%.15g", use_col_dual[iCol]);
-      if (have_basis)
-        fprintf(file, " %" HIGHSINT_FORMAT "", (HighsInt)use_col_status[iCol]);
-      fprintf(file, " \n");
-    }
+    // Lines for blocks of columns and rows are formatted in parallel
+    auto formatLines = [&](HighsOutputBuffer& block, const HighsInt from,
+                           const HighsInt to, const vector<double>& value,
+                           const vector<double>& dual,
+                           const vector<HighsBasisStatus>& status) {
+      for (HighsInt i = from; i < to; i++) {
+        if (have_value) block.appendDouble(value[i]);
+        if (have_value && have_dual) block.append(' ');
+        if (have_dual) block.appendDouble(dual[i]);
+        if (have_basis) {
+          block.append(' ');
+          block.appendInt((HighsInt)status[i]);
+        }
+        block.append(" \n");
+      }
+    };
+    write_ok = writeOutputBlocks(
+        file, lp.num_col_, nullptr,
+        [&](HighsOutputBuffer& block, const HighsInt from_col,
+            const HighsInt to_col) {
+          formatLines(block, from_col, to_col, use_col_value, use_col_dual,
+                      use_col_status);
+        });
     fprintf(file, "Rows\n");
-    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
-      if (have_value) fprintf(file, "%.15g", use_row_value[iRow]);
-      if (have_dual) fprintf(file, "%.15g", use_row_dual[iRow]);
-      if (have_basis)
-        fprintf(file, " %" HIGHSINT_FORMAT "", (HighsInt)use_row_status[iRow]);
-      fprintf(file, " \n");
-    }
+    write_ok = write_ok &&
+               writeOutputBlocks(
+                   file, lp.num_row_, nullptr,
+                   [&](HighsOutputBuffer& block, const HighsInt from_row,
+                       const HighsInt to_row) {
+                     formatLines(block, from_row, to_row, use_row_value,
+                                 use_row_dual, use_row_status);
+                   });
   }
+  return write_ok;
 }
 
 HighsStatus writeBasisFile(const HighsLogOptions& log_options,
@@ -1834,47 +1866,99 @@ HighsStatus writeBasisFile(const HighsLogOptions& log_options,
                  "writeBasisFile: Cannot write an invalid basis\n");
     return HighsStatus::kError;
   }
-  std::ofstream outFile(filename);
-  if (outFile.fail()) {
+  FILE* file = fopen(filename.c_str(), "w");
+  if (file == nullptr) {
     highsLogUser(log_options, HighsLogType::kError,
                  "writeBasisFile: Cannot open writeable file \"%s\"\n",
                  filename.c_str());
     return HighsStatus::kError;
   }
-  outFile << "HiGHS Version " << HIGHS_VERSION_MAJOR << std::endl;
-  outFile << basis.col_status.size() << " " << basis.row_status.size()
-          << std::endl;
-  for (const auto& status : basis.col_status) {
-    outFile << (HighsInt)status << " ";
-  }
-  outFile << std::endl;
-  for (const auto& status : basis.row_status) {
-    outFile << (HighsInt)status << " ";
+  const HighsInt num_col = basis.col_status.size();
+  const HighsInt num_row = basis.row_status.size();
+  HighsOutputBuffer buffer;
+  buffer.append("HiGHS Version ");
+  buffer.appendInt(HIGHS_VERSION_MAJOR);
+  buffer.append('\n');
+  buffer.appendInt(num_col);
+  buffer.append(' ');
+  buffer.appendInt(num_row);
+  buffer.append('\n');
+  bool write_ok = buffer.write(file);
+  auto formatStatus = [](HighsOutputBuffer& block,
+                         const vector<HighsBasisStatus>& status,
+                         const HighsInt from, const HighsInt to) {
+    for (HighsInt i = from; i < to; i++) {
+      block.appendInt((HighsInt)status[i]);
+      block.append(' ');
+    }
+  };
+  write_ok = write_ok &&
+             writeOutputBlocks(file, num_col, nullptr,
+                               [&](HighsOutputBuffer& block,
+                                   const HighsInt from_col,
+                                   const HighsInt to_col) {
+                                 formatStatus(block, basis.col_status,
+                                              from_col, to_col);
+                               });
+  buffer.append('\n');
+  write_ok = write_ok && buffer.write(file);
+  write_ok = write_ok &&
+             writeOutputBlocks(file, num_row, nullptr,
+                               [&](HighsOutputBuffer& block,
+                                   const HighsInt from_row,
+                                   const HighsInt to_row) {
+                                 formatStatus(block, basis.row_status,
+                                              from_row, to_row);
+                               });
+  buffer.append("\n\n");
+  write_ok = write_ok && buffer.write(file);
+  if (fclose(file) != 0 || !write_ok) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "writeBasisFile: Error writing file \"%s\"\n",
+                 filename.c_str());
+    return_status = HighsStatus::kError;
   }
-  outFile << std::endl;
-  outFile << std::endl;
-  outFile.close();
   return return_status;
 }
 
+// Reads the next whitespace-separated integer from the stream buffer,
+// without the overhead of formatted stream input
+static bool readBasisInteger(std::streambuf* buffer, HighsInt& value) {
+  typedef std::streambuf::traits_type traits;
+  traits::int_type c = buffer->sgetc();
+  while (c != traits::eof() && isspace(c)) c = buffer->snextc();
+  const bool negative = c == '-';
+  if (negative) c = buffer->snextc();
+  if (c == traits::eof() || !isdigit(c)) return false;
+  value = 0;
+  while (c != traits::eof() && isdigit(c)) {
+    value = 10 * value + (c - '0');
+    c = buffer->snextc();
+  }
+  if (negative) value = -value;
+  return true;
+}
+
 HighsStatus readBasisFile(const HighsLogOptions& log_options, HighsBasis& basis,
                           const std::string filename) {
   // Reads a basis file, returning an error if what's read is
   // inconsistent with the sizes of the HighsBasis passed in
   HighsStatus return_status = HighsStatus::kOk;
-  std::ifstream inFile(filename);
-  if (inFile.fail()) {
+  HighsInputStream inFile(filename);
+  if (!inFile.is_open()) {
     highsLogUser(log_options, HighsLogType::kError,
                  "readBasisFile: Cannot open readable file \"%s\"\n",
                  filename.c_str());
     return HighsStatus::kError;
   }
   std::string string_highs, string_version;
-  HighsInt highs_version_number;
+  HighsInt highs_version_number = 0;
   inFile >> string_highs >> string_version >> highs_version_number;
   if (highs_version_number == 1) {
-    HighsInt numCol, numRow;
-    inFile >> numCol >> numRow;
+    std::streambuf* buffer = inFile.rdbuf();
+    HighsInt numCol = -1, numRow = -1;
+    readBasisInteger(buffer, numCol);
+    readBasisInteger(buffer, numRow);
     HighsInt basis_numCol = (HighsInt)basis.col_status.size();
     HighsInt basis_numRow = (HighsInt)basis.row_status.size();
     if (numCol != basis_numCol) {
@@ -1891,16 +1975,19 @@ HighsStatus readBasisFile(const HighsLogOptions& log_options, HighsBasis& basis,
                    numRow, basis_numRow);
       return HighsStatus::kError;
     }
-    HighsInt int_status;
+    HighsInt int_status = 0;
+    bool read_ok = true;
     for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-      inFile >> int_status;
+      read_ok = readBasisInteger(buffer, int_status);
+      if (!read_ok) break;
       basis.col_status[iCol] = (HighsBasisStatus)int_status;
     }
-    for (HighsInt iRow = 0; iRow < numRow; iRow++) {
-      inFile >> int_status;
+    for (HighsInt iRow = 0; read_ok && iRow < numRow; iRow++) {
+      read_ok = readBasisInteger(buffer, int_status);
+      if (!read_ok) break;
       basis.row_status[iRow] = (HighsBasisStatus)int_status;
     }
-    if (inFile.eof()) {
+    if (!read_ok) {
       highsLogUser(
           log_options, HighsLogType::kError,
           "readBasisFile: Reached end of file before reading complete basis\n");
@@ -1913,7 +2000,6 @@ HighsStatus readBasisFile(const HighsLogOptions& log_options, HighsBasis& basis,
                  highs_version_number);
     return_status = HighsStatus::kError;
   }
-  inFile.close();
   return return_status;
 }
 
@@ -2428,9 +2514,9 @@ void ensureColWise(HighsLp& lp) {
         Astart[iCol + 1] = Astart[iCol] + Alength[iCol];
       assert(Astart[lp.num_col_] == num_nz);
       // Now update the LP's matrix
-      lp.a_start_ = Astart;
-      lp.a_index_ = Aindex;
-      lp.a_value_ = Avalue;
+      lp.a_start_ = std::move(Astart);
+      lp.a_index_ = std::move(Aindex);
+      lp.a_value_ = std::move(Avalue);
     }
   }
   if (empty_matrix) {
@@ -2447,6 +2533,47 @@ void ensureColWise(HighsLp& lp) {
   lp.format_ = MatrixFormat::kColwise;
 }
 
+bool colWiseMatrixFromRowWise(const HighsInt num_col, const HighsInt num_row,
+                              const HighsInt num_nz, const HighsInt* ar_start,
+                              const HighsInt* ar_index,
+                              const double* ar_value,
+                              vector<HighsInt>& a_start,
+                              vector<HighsInt>& a_index,
+                              vector<double>& a_value) {
+  // Check the row starts and column indices, and count the entries in
+  // each column
+  vector<HighsInt> a_length(num_col, 0);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const HighsInt from_el = ar_start[iRow];
+    const HighsInt to_el = iRow + 1 < num_row ? ar_start[iRow + 1] : num_nz;
+    if (from_el < 0 || from_el > to_el || to_el > num_nz) return false;
+  }
+  if (num_row > 0 && ar_start[0] != 0) return false;
+  for (HighsInt iEl = 0; iEl < num_nz; iEl++) {
+    const HighsInt iCol = ar_index[iEl];
+    if (iCol < 0 || iCol >= num_col) return false;
+    a_length[iCol]++;
+  }
+  a_start.resize(num_col + 1);
+  a_index.resize(num_nz);
+  a_value.resize(num_nz);
+  a_start[0] = 0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    a_start[iCol + 1] = a_start[iCol] + a_length[iCol];
+  // Use a_length for the position of the next entry in each column
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    a_length[iCol] = a_start[iCol];
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const HighsInt to_el = iRow + 1 < num_row ? ar_start[iRow + 1] : num_nz;
+    for (HighsInt iEl = ar_start[iRow]; iEl < to_el; iEl++) {
+      const HighsInt iCol_el = a_length[ar_index[iEl]]++;
+      a_index[iCol_el] = iRow;
+      a_value[iCol_el] = ar_value[iEl];
+    }
+  }
+  return true;
+}
+
 void ensureRowWise(HighsLp& lp) {
   // Should only call this is orientation is COLWISE
   assert(lp.format_ == MatrixFormat::kColwise);
@@ -2492,9 +2619,9 @@ void ensureRowWise(HighsLp& lp) {
         ARstart[iRow + 1] = ARstart[iRow] + ARlength[iRow];
       assert(ARstart[lp.num_row_] == num_nz);
       // Now update the LP's matrix
-      lp.a_start_ = ARstart;
-      lp.a_index_ = ARindex;
-      lp.a_value_ = ARvalue;
+      lp.a_start_ = std::move(ARstart);
+      lp.a_index_ = std::move(ARindex);
+      lp.a_value_ = std::move(ARvalue);
     }
   }
   if (empty_matrix) {
@@ -112,11 +112,17 @@ HighsStatus appendRowsToLpVectors(HighsLp& lp, const HighsInt num_new_row,
                                   const vector<double>& rowLower,
                                   const vector<double>& rowUpper);
 
+// Rows with nonzeros are inserted into a column-wise matrix if
+// insert_colwise is true, since the matrix is about to be used in that
+// form. Otherwise the matrix is transposed, so that these and any
+// subsequent rows are appended at a cost proportional to their number
+// of nonzeros
 HighsStatus appendRowsToLpMatrix(HighsLp& lp, const HighsInt num_new_row,
                                  const HighsInt num_new_nz,
                                  const HighsInt* XARstart,
                                  const HighsInt* XARindex,
-                                 const double* XARvalue);
+                                 const double* XARvalue,
+                                 const bool insert_colwise = true);
 
 HighsStatus deleteLpCols(const HighsLogOptions& log_options, HighsLp& lp,
                          const HighsIndexCollection& index_collection);
@@ -247,7 +253,8 @@ void analyseLp(const HighsLogOptions& log_options, const HighsLp& lp,
 void analyseScaledLp(const HighsLogOptions& log_options,
                      const HighsScale& scale, const HighsLp& scaled_lp);
 
-void writeSolutionToFile(FILE* file, const HighsLp& lp, const HighsBasis& basis,
+// Returns false if the solution could not be written to the file
+bool writeSolutionToFile(FILE* file, const HighsLp& lp, const HighsBasis& basis,
                          const HighsSolution& solution, const bool pretty);
 
 HighsStatus calculateRowValues(const HighsLp& lp, HighsSolution& solution);
@@ -278,4 +285,14 @@ HighsStatus setFormat(
     HighsLp& lp, const MatrixFormat desired_format = MatrixFormat::kColwise);
 void ensureColWise(HighsLp& lp);
 void ensureRowWise(HighsLp& lp);
+// Forms the column-wise matrix from the arrays of a row-wise matrix
+// with num_row starts, returning false if the starts or indices are
+// not valid
+bool colWiseMatrixFromRowWise(const HighsInt num_col, const HighsInt num_row,
+                              const HighsInt num_nz, const HighsInt* ar_start,
+                              const HighsInt* ar_index,
+                              const double* ar_value,
+                              vector<HighsInt>& a_start,
+                              vector<HighsInt>& a_index,
+                              vector<double>& a_value);
 #endif  // LP_DATA_HIGHSLPUTILS_H_
@@ -21,6 +21,7 @@
 
 #include "io/HighsIO.h"
 #include "lp_data/HConst.h"
+#include "lp_data/HighsCallbackStruct.h"
 #include "lp_data/HighsStatus.h"
 #include "simplex/HFactor.h"
 #include "simplex/SimplexConst.h"
@@ -307,6 +308,7 @@ struct HighsOptionsStruct {
   HighsInt simplex_permute_strategy;
   HighsInt max_dual_simplex_cleanup_level;
   HighsInt simplex_price_strategy;
+  HighsInt simplex_reinversion_strategy;
   HighsInt presolve_substitution_maxfillin;
   bool simplex_initial_condition_check;
   double simplex_initial_condition_tolerance;
@@ -344,6 +346,10 @@ struct HighsOptionsStruct {
   void (*logmsgcb)(HighsLogType type, const char* msg, void* msgcb_data) = NULL;
   void* msgcb_data = NULL;
   HighsLogOptions log_options;
+
+  // User callback for progress and interrupts, and its data
+  HighsCallbackFunctionType user_callback = NULL;
+  void* user_callback_data = NULL;
   virtual ~HighsOptionsStruct() {}
 };
 
@@ -732,6 +738,16 @@ class HighsOptions : public HighsOptionsStruct {
         kSimplexPriceStrategyRowSwitchColSwitch, kSimplexPriceStrategyMax);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "simplex_reinversion_strategy",
+        "Strategy for reinversion in simplex: 0 => Synthetic clock; 1 => "
+        "Adaptive to growth in solve cost",
+        advanced, &simplex_reinversion_strategy,
+        kSimplexReinversionStrategyMin,
+        kSimplexReinversionStrategySyntheticClock,
+        kSimplexReinversionStrategyMax);
+    records.push_back(record_int);
+
     record_bool =
         new OptionRecordBool("simplex_initial_condition_check",
                              "Perform initial basis condition check in simplex",
@@ -23,6 +23,10 @@
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsModelUtils.h"
 
+#ifdef OPENMP
+#include "omp.h"
+#endif
+
 double infProduct(double value) {
   // Multiplying value and kHighsInf
   if (value == 0) {
@@ -94,8 +98,6 @@ HighsStatus getRangingData(HighsRanging& ranging,
 
   vector<HighsInt> iWork_(numTotal);
   vector<double> dWork_(numTotal);
-  HVector column;
-  column.setup(numRow);
   // As rgda/HModel.cpp HModel::sense() {
 
   vector<double> xi = Bvalue_;
@@ -157,15 +159,53 @@ HighsStatus getRangingData(HighsRanging& ranging,
   vector<double> aci_dec(numRow, 0);
   vector<HighsInt> jci_dec(numRow, -1);
 
+  // The updated columns of the nonbasic variables are formed in
+  // batches, so that their FTRANs can be performed together. Each
+  // thread gets one block of solves: larger batches gain nothing, and
+  // lose the benefit of the cache when the columns are used.
+  HighsInt num_threads = 1;
+#ifdef OPENMP
+  num_threads = omp_get_max_threads();
+#endif
+  const HighsInt batch_size = kBlockSolveWidth * num_threads;
+  vector<HighsInt> batch_var;
+  vector<HVector> batch_column(batch_size);
+  for (HighsInt iX = 0; iX < batch_size; iX++) batch_column[iX].setup(numRow);
+
+  // The FTRANs are given a running average of the density of their
+  // results, starting from that of the simplex solver
+  double col_aq_density = simplex_info.col_aq_density;
+
   // Major "theta" loop
+  HighsInt next_nonbasic = 0;
+  HighsInt batch_count = 0;
   for (HighsInt j = 0; j < numTotal; j++) {
     // Skip basic column
     if (!Nflag_[j]) continue;
 
-    // Form updated column
-    column.clear();
-    matrix.collect_aj(column, j, 1);
-    factor.ftran(column, 0);
+    if (batch_count == (HighsInt)batch_var.size()) {
+      // Form the next batch of updated columns
+      batch_var.clear();
+      for (; next_nonbasic < numTotal; next_nonbasic++) {
+        if (!Nflag_[next_nonbasic]) continue;
+        if ((HighsInt)batch_var.size() == batch_size) break;
+        batch_var.push_back(next_nonbasic);
+      }
+      batch_column.resize(batch_var.size());
+      for (HighsInt iX = 0; iX < (HighsInt)batch_var.size(); iX++) {
+        batch_column[iX].clear();
+        matrix.collect_aj(batch_column[iX], batch_var[iX], 1);
+      }
+      factor.ftran(batch_column, col_aq_density);
+      for (const HVector& column : batch_column) {
+        const double local_col_aq_density = (double)column.count / numRow;
+        col_aq_density = (1 - kRunningAverageMultiplier) * col_aq_density +
+                         kRunningAverageMultiplier * local_col_aq_density;
+      }
+      batch_count = 0;
+    }
+    assert(batch_var[batch_count] == j);
+    const HVector& column = batch_column[batch_count++];
     HighsInt nWork = 0;
     for (HighsInt k = 0; k < column.count; k++) {
       HighsInt iRow = column.index[k];
@@ -146,6 +146,7 @@ restart:
         search.flushStatistics();
       }
 
+      mipdata_->interruptByCallback(kHighsCallbackMipNode);
       if (mipdata_->checkLimits()) {
         limit_reached = true;
         break;
@@ -323,6 +324,7 @@ restart:
           break;
         }
 
+        mipdata_->interruptByCallback(kHighsCallbackMipNode);
         if (mipdata_->checkLimits()) {
           limit_reached = true;
           break;
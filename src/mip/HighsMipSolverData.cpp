@@ -193,6 +193,7 @@ void HighsMipSolverData::init() {
   sepa_lp_iterations_before_run = 0;
   sb_lp_iterations_before_run = 0;
   num_disp_lines = 0;
+  user_interrupt = false;
   cliquesExtracted = false;
   rowMatrixSet = false;
   lower_bound = -kHighsInf;
@@ -832,6 +833,7 @@ bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
       }
       pruned_treeweight += nodequeue.performBounding(upper_limit);
       printDisplayLine(source);
+      interruptByCallback(kHighsCallbackMipImprovingSolution);
     }
   } else if (incumbent.empty())
     incumbent = sol;
@@ -1368,6 +1370,14 @@ restart:
 
 bool HighsMipSolverData::checkLimits() const {
   const HighsOptions& options = *mipsolver.options_mip_;
+  if (user_interrupt) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "interrupted by user callback\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kInterrupt;
+    }
+    return true;
+  }
   if (options.mip_max_nodes != kHighsIInf &&
       num_nodes >= options.mip_max_nodes) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
@@ -1399,6 +1409,33 @@ bool HighsMipSolverData::checkLimits() const {
   return false;
 }
 
+bool HighsMipSolverData::interruptByCallback(const HighsInt callback_type) {
+  // Sub-MIPs solved by the heuristics copy the options, so must not
+  // pass their progress to the user callback
+  const HighsOptions& options = *mipsolver.options_mip_;
+  if (options.user_callback == NULL || mipsolver.submip) return false;
+  if (user_interrupt) return true;
+  const double offset = mipsolver.model_->offset_;
+  HighsCallbackDataOut data_out = {};
+  data_out.running_time = mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  data_out.mip_node_count = num_nodes;
+  data_out.mip_primal_bound = kHighsInf;
+  data_out.mip_dual_bound = lower_bound + offset;
+  data_out.mip_gap = kHighsInf;
+  if (upper_bound != kHighsInf) {
+    data_out.mip_primal_bound = upper_bound + offset;
+    data_out.mip_dual_bound =
+        std::min(data_out.mip_primal_bound, data_out.mip_dual_bound);
+    data_out.mip_gap =
+        100 * (data_out.mip_primal_bound - data_out.mip_dual_bound) /
+        std::max(1.0, std::abs(data_out.mip_primal_bound));
+  }
+  if (options.user_callback(callback_type, &data_out,
+                            options.user_callback_data))
+    user_interrupt = true;
+  return user_interrupt;
+}
+
 void HighsMipSolverData::checkObjIntegrality() {
   objintscale = 600.0;
 
@@ -98,6 +98,7 @@ struct HighsMipSolverData {
   int64_t sepa_lp_iterations_before_run;
   int64_t sb_lp_iterations_before_run;
   int64_t num_disp_lines;
+  bool user_interrupt;
 
   HighsInt numImprovingSols;
   double lower_bound;
@@ -158,6 +159,7 @@ struct HighsMipSolverData {
   }
 
   bool checkLimits() const;
+  bool interruptByCallback(const HighsInt callback_type);
 };
 
 #endif
@@ -915,11 +915,22 @@ bool HighsSymmetryDetection::partitionRefinement() {
     // if there are none there is nothing to refine
     if (refineStart == cellEnd) continue;
 
+    // gather the updated hash values of the vertices to refine so that the
+    // sort and the scan below do not need to look them up in the hash table
+    // repeatedly. For large cells the lookups are done in parallel as they
+    // only read from the hash table.
+    HighsInt refineSize = cellEnd - refineStart;
+    cellHashBuffer.resize(refineSize);
+#pragma omp parallel for if (refineSize >= kParallelHashCellSize)
+    for (HighsInt k = 0; k < refineSize; ++k) {
+      HighsInt v = currentPartition[refineStart + k];
+      cellHashBuffer[k] = std::make_pair(*vertexHash.find(v), v);
+    }
+
     // sort the vertices that have updated hash values by their hash values
-    pdqsort(currentPartition.begin() + refineStart,
-            currentPartition.begin() + cellEnd, [&](HighsInt v1, HighsInt v2) {
-              return vertexHash[v1] < vertexHash[v2];
-            });
+    pdqsort(cellHashBuffer.begin(), cellHashBuffer.end());
+    for (HighsInt k = 0; k < refineSize; ++k)
+      currentPartition[refineStart + k] = cellHashBuffer[k].second;
 
     // if not all vertices have updated hash values directly create the first
     // new cell at the start of the range that we want to refine
@@ -943,11 +954,10 @@ bool HighsSymmetryDetection::partitionRefinement() {
     HighsInt i;
     assert(vertexHash.find(currentPartition[cellStart]) != nullptr);
     // store value of first hash
-    u64 lastHash = vertexHash[currentPartition[cellStart]];
+    u64 lastHash = cellHashBuffer[cellStart - refineStart].first;
     for (i = cellStart + 1; i < cellEnd; ++i) {
-      HighsInt vertex = currentPartition[i];
       // get this vertex hash value
-      u64 hash = vertexHash[vertex];
+      u64 hash = cellHashBuffer[i - refineStart].first;
 
       if (hash != lastHash) {
         // hash values do not match -> start of new cell
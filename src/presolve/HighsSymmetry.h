@@ -144,6 +144,10 @@ class HighsSymmetryDetection {
   using u64 = std::uint64_t;
   using u32 = std::uint32_t;
 
+  // minimal number of vertices in a cell for its hash values to be gathered
+  // in parallel during partition refinement
+  static constexpr HighsInt kParallelHashCellSize = 4096;
+
   const HighsLp* model;
   // compressed graph storage
   std::vector<HighsInt> Gstart;
@@ -175,6 +179,8 @@ class HighsSymmetryDetection {
   std::vector<HighsInt> bestLeavePartition;
 
   HighsHashTable<HighsInt, u32> vertexHash;
+  // buffer of (hash, vertex) pairs for the cell currently being refined
+  std::vector<std::pair<u32, HighsInt>> cellHashBuffer;
   HighsHashTable<std::tuple<HighsInt, HighsInt, HighsUInt>> firstLeaveGraph;
   HighsHashTable<std::tuple<HighsInt, HighsInt, HighsUInt>> bestLeaveGraph;
 
@@ -15,8 +15,8 @@ class DevexHarrisPricing : public Pricing {
   std::vector<double> weights;
 
   HighsInt chooseconstrainttodrop(const Vector& lambda) {
-    auto activeconstraintidx = basis.getactive();
-    auto constraintindexinbasisfactor = basis.getindexinfactor();
+    const auto& activeconstraintidx = basis.getactive();
+    const auto& constraintindexinbasisfactor = basis.getindexinfactor();
 
     HighsInt minidx = -1;
     double maxabslambda = 0.0;
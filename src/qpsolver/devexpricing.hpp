@@ -4,6 +4,7 @@
 #include "basis.hpp"
 #include "reducedcosts.hpp"
 #include "runtime.hpp"
+#include "parallel.hpp"
 #include "pricing.hpp"
 
 // 42726, 78965776.391299, 559, 104.321553, 0.000669, 7937
@@ -17,8 +18,8 @@ class DevexPricing : public Pricing {
   std::vector<double> weights;
 
   HighsInt chooseconstrainttodrop(const Vector& lambda) {
-    auto activeconstraintidx = basis.getactive();
-    auto constraintindexinbasisfactor = basis.getindexinfactor();
+    const auto& activeconstraintidx = basis.getactive();
+    const auto& constraintindexinbasisfactor = basis.getindexinfactor();
 
     HighsInt minidx = -1;
     double maxabslambda = 0.0;
@@ -77,18 +78,24 @@ class DevexPricing : public Pricing {
                       HighsInt q) {
     HighsInt rowindex_p = basis.getindexinfactor()[p];
     double weight_p = weights[rowindex_p];
-    for (HighsInt i = 0; i < runtime.instance.num_var; i++) {
-      if (i == rowindex_p) {
-        weights[i] = weight_p / (aq.value[rowindex_p] * aq.value[rowindex_p]);
-      } else {
-        weights[i] += (aq.value[i] * aq.value[i]) /
-                      (aq.value[rowindex_p] * aq.value[rowindex_p]) * weight_p *
-                      weight_p;
-      }
-      if (weights[i] > 10E6) {
-        weights[i] = 1.0;
-      }
-    }
+    double aq_p_squared = aq.value[rowindex_p] * aq.value[rowindex_p];
+    HighsInt num_var = runtime.instance.num_var;
+    parallel_for(
+        num_var,
+        [&](HighsInt first, HighsInt last) {
+          for (HighsInt i = first; i < last; i++) {
+            if (i == rowindex_p) {
+              weights[i] = weight_p / aq_p_squared;
+            } else {
+              weights[i] += (aq.value[i] * aq.value[i]) / aq_p_squared *
+                            weight_p * weight_p;
+            }
+            if (weights[i] > 10E6) {
+              weights[i] = 1.0;
+            }
+          }
+        },
+        parallel_setting(num_var));
   }
 };
 
@@ -1,6 +1,7 @@
 #ifndef __SRC_LIB_EVENTHANDLER_HPP__
 #define __SRC_LIB_EVENTHANDLER_HPP__
 
+#include <functional>
 #include <vector>
 
 template <typename T>  // T: void (*fncptr)(int, double)
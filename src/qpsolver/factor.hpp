@@ -16,12 +16,17 @@ class NewCholeskyFactor {
   Runtime& runtime;
   Nullspace& nullspace;
 
-  std::vector<std::vector<double>> orig;
-
   HighsInt current_k = 0;
-  HighsInt current_k_max;
+  // lower triangular factor L of the reduced Hessian Z'QZ = LL', packed by
+  // rows so that row i (column i of R = L') starts at rowStart(i). Adding a
+  // column to the nullspace appends a row, so the storage is k(k+1)/2
+  // entries for the current dimension k
   std::vector<double> L;
 
+  static size_t rowStart(HighsInt row) {
+    return (size_t)row * (row + 1) / 2;
+  }
+
   void recompute() {
     Matrix& Z = nullspace.getNullspace();
     // M = (Q' * Z)' * Z
@@ -31,54 +36,89 @@ class NewCholeskyFactor {
                           .tran_mat_(Z.mat),
                       false);
 
-    orig.assign(m.mat.num_col, std::vector<double>(m.mat.num_col, 0.0));
+    HighsInt k = m.mat.num_col;
+    L.assign(rowStart(k), 0.0);
 
-    for (HighsInt i = 0; i < m.mat.num_col; i++) {
-      for (HighsInt j = m.mat.start[i]; j < m.mat.start[i + 1]; j++) {
+    // scatter the lower triangle of the (symmetric) sparse matrix M into the
+    // factor storage, rather than going through a dense copy of M
+    for (HighsInt col = 0; col < k; col++) {
+      for (HighsInt j = m.mat.start[col]; j < m.mat.start[col + 1]; j++) {
         HighsInt row = m.mat.index[j];
-        orig[row][i] = m.mat.value[j];
+        if (row <= col) L[rowStart(col) + row] = m.mat.value[j];
       }
     }
 
-    for (size_t col = 0; col < orig.size(); col++) {
-      for (size_t row = 0; row <= col; row++) {
-        double sum = 0;
-        if (row == col) {
-          for (size_t k = 0; k < row; k++)
-            sum += L[k * current_k_max + row] * L[k * current_k_max + row];
-          L[row * current_k_max + row] = sqrt(orig[row][row] - sum);
-        } else {
-          for (size_t k = 0; k < row; k++)
-            sum += (L[k * current_k_max + col] * L[k * current_k_max + row]);
-          L[row * current_k_max + col] =
-              (orig[col][row] - sum) / L[row * current_k_max + row];
-        }
+    // in-place Cholesky factorization by rows, so that each entry is formed
+    // from a dot product of two contiguous rows of L
+    for (HighsInt row = 0; row < k; row++) {
+      double* l_row = &L[rowStart(row)];
+      for (HighsInt col = 0; col < row; col++) {
+        const double* l_col = &L[rowStart(col)];
+        double sum = l_row[col];
+        for (HighsInt i = 0; i < col; i++) sum -= l_row[i] * l_col[i];
+        l_row[col] = sum / l_col[col];
       }
+      double pivot = l_row[row];
+      for (HighsInt i = 0; i < row; i++) pivot -= l_row[i] * l_row[i];
+      l_row[row] = sqrt(pivot);
     }
-    current_k = Z.mat.num_col;
+    current_k = k;
     uptodate = true;
   }
 
-  void resize(HighsInt new_k_max) {
-    std::vector<double> L_old = L;
-    L.clear();
-    L.resize((new_k_max) * (new_k_max));
-    for (HighsInt i = 0; i < current_k_max; i++) {
-      for (HighsInt j = 0; j < current_k_max; j++) {
-        L[i * (new_k_max) + j] = L_old[i * current_k_max + j];
+  // Entry (row, col) of R = L' while reduce() has moved a row of R to the
+  // bottom: the part of the last row left of the diagonal is held in spike
+  double& entryR(std::vector<double>& spike, HighsInt row, HighsInt col) {
+    if (row == current_k - 1 && col < row) return spike[col];
+    assert(row <= col);
+    return L[rowStart(col) + row];
+  }
+
+  // Givens rotation of rows i and j of R to eliminate R(j, i), where the
+  // entries of both rows are zero in the columns before min(i, j)
+  void eliminate(std::vector<double>& spike, HighsInt i, HighsInt j) {
+    // i = col, j = row
+    if (entryR(spike, j, i) == 0.0) {
+      return;
+    }
+    const double r_ii = entryR(spike, i, i);
+    const double r_ji = entryR(spike, j, i);
+    double z = sqrt(r_ii * r_ii + r_ji * r_ji);
+    double cos_, sin_;
+    if (z == 0) {
+      cos_ = 1.0;
+      sin_ = 0.0;
+    } else {
+      cos_ = r_ii / z;
+      sin_ = -r_ji / z;
+    }
+
+    const HighsInt from_col = min(i, j);
+    if (sin_ == 0.0) {
+      if (cos_ <= 0.0) {
+        for (HighsInt k = from_col; k < current_k; k++) {
+          entryR(spike, i, k) = -entryR(spike, i, k);
+          entryR(spike, j, k) = -entryR(spike, j, k);
+        }
+      }
+    } else {
+      for (HighsInt k = from_col; k < current_k; k++) {
+        // update entry i and j of column k
+        double& a_ik = entryR(spike, i, k);
+        double& a_jk = entryR(spike, j, k);
+        const double a_ik_old = a_ik;
+        a_ik = cos_ * a_ik_old - sin_ * a_jk;
+        a_jk = sin_ * a_ik_old + cos_ * a_jk;
       }
     }
-    current_k_max = new_k_max;
+    entryR(spike, j, i) = 0.0;
   }
 
  public:
   NewCholeskyFactor(Runtime& rt, Basis& basis, Nullspace& ns)
       : runtime(rt), nullspace(ns) {
     uptodate = false;
-    current_k_max =
-        max(min((HighsInt)ceil(rt.instance.num_var / 16.0), (HighsInt)1000),
-            basis.getnuminactive());
-    L.resize(current_k_max * current_k_max);
+    L.reserve(rowStart(basis.getnuminactive()));
   }
 
   void expand(Vector& yp, Vector& gyp, Vector& l) {
@@ -91,14 +131,15 @@ class NewCholeskyFactor {
 
     assert(lambda > 0);
 
-    if (current_k_max <= current_k + 1) {
-      resize(current_k_max * 2);
+    // append the new row of L
+    assert(L.size() == rowStart(current_k));
+    L.resize(rowStart(current_k + 1), 0.0);
+    double* l_row = &L[rowStart(current_k)];
+    for (HighsInt i = 0; i < l.num_nz; i++) {
+      HighsInt idx = l.index[i];
+      l_row[idx] = l.value[idx];
     }
-
-    for (HighsInt i = 0; i < current_k; i++) {
-      L[i * current_k_max + current_k] = l.value[i];
-    }
-    L[current_k * current_k_max + current_k] = sqrt(lambda);
+    l_row[current_k] = sqrt(lambda);
 
     current_k++;
   }
@@ -108,23 +149,26 @@ class NewCholeskyFactor {
       recompute();
     }
 
-    for (HighsInt r = 0; r < rhs.dim; r++) {
-      for (HighsInt j = 0; j < r; j++) {
-        rhs.value[r] -= rhs.value[j] * L[j * current_k_max + r];
-      }
-
-      rhs.value[r] /= L[r * current_k_max + r];
+    // row-oriented forward substitution, each row of L being contiguous
+    for (HighsInt i = 0; i < rhs.dim; i++) {
+      const double* l_row = &L[rowStart(i)];
+      double sum = rhs.value[i];
+      for (HighsInt j = 0; j < i; j++) sum -= l_row[j] * rhs.value[j];
+      rhs.value[i] = sum / l_row[i];
     }
   }
 
   // solve L' u = v
   void solveLT(Vector& rhs) {
+    // column-oriented backward substitution with L' = R: entries of the
+    // solution that are zero do not contribute, and each update runs along a
+    // contiguous row of L
     for (HighsInt i = rhs.dim - 1; i >= 0; i--) {
-      double sum = 0.0;
-      for (HighsInt j = rhs.dim - 1; j > i; j--) {
-        sum += rhs.value[j] * L[i * current_k_max + j];
-      }
-      rhs.value[i] = (rhs.value[i] - sum) / L[i * current_k_max + i];
+      const double* l_row = &L[rowStart(i)];
+      rhs.value[i] /= l_row[i];
+      double u_i = rhs.value[i];
+      if (u_i == 0.0) continue;
+      for (HighsInt j = 0; j < i; j++) rhs.value[j] -= u_i * l_row[j];
     }
   }
 
@@ -139,72 +183,12 @@ class NewCholeskyFactor {
     rhs.resparsify();
   }
 
-  void eliminate(std::vector<double>& m, HighsInt i, HighsInt j, HighsInt kmax,
-                 HighsInt currentk) {
-    // i = col, j = row
-    if (m[j * kmax + i] == 0.0) {
-      return;
-    }
-    double z = sqrt(m[i * kmax + i] * m[i * kmax + i] +
-                    m[j * kmax + i] * m[j * kmax + i]);
-    double cos_, sin_;
-    if (z == 0) {
-      cos_ = 1.0;
-      sin_ = 0.0;
-    } else {
-      cos_ = m[i * kmax + i] / z;
-      sin_ = -m[j * kmax + i] / z;
-    }
-
-    if (sin_ == 0.0) {
-      if (cos_ > 0.0) {
-        // nothing
-      } else {
-        for (HighsInt k = 0; k < current_k; k++) {
-          // update entry i and j of column k
-          double a_ik = m[i * kmax + k];
-          // entry i
-          m[i * kmax + k] = -a_ik;
-          m[j * kmax + k] = -m[j * kmax + k];
-        }
-      }
-    } else if (cos_ == 0.0) {
-      if (sin_ > 0.0) {
-        for (HighsInt k = 0; k < current_k; k++) {
-          // update entry i and j of column k
-          double a_ik = m[i * kmax + k];
-          // entry i
-          m[i * kmax + k] = -m[j * kmax + k];
-          m[j * kmax + k] = a_ik;
-        }
-      } else {
-        for (HighsInt k = 0; k < current_k; k++) {
-          // update entry i and j of column k
-          double a_ik = m[i * kmax + k];
-          // entry i
-          m[i * kmax + k] = m[j * kmax + k];
-          m[j * kmax + k] = -a_ik;
-        }
-      }
-    } else {
-      // #pragma omp parallel for
-      for (HighsInt k = 0; k < current_k; k++) {
-        // update entry i and j of column k
-        double a_ik = m[i * kmax + k];
-        // entry i
-        m[i * kmax + k] = cos_ * a_ik - sin_ * m[j * kmax + k];
-        m[j * kmax + k] = sin_ * a_ik + cos_ * m[j * kmax + k];
-      }
-    }
-    m[j * kmax + i] = 0.0;
-  }
-
   void reduce(NullspaceReductionResult& nrr) {
     if (current_k == 0) {
       return;
     }
 
-    unsigned p = nrr.maxabsd;  // col we push to the right and remove
+    HighsInt p = nrr.maxabsd;  // col we push to the right and remove
 
     // start situation: p=3, current_k = 5
     // |1 x  | |x    |       |1   | |xxxxx|
@@ -212,37 +196,31 @@ class NewCholeskyFactor {
     // |  x1 | |xxx  |       |xxxx| |  xxx|
     // |  x 1| |xxxx |       |  1 | |   xx|
     //         |xxxxx|       |   1| |    x|
-    // next step: move row/col p to the bottom/right
-
-    //> save row p
-    std::vector<double> row_p(current_k, 0.0);
-    for (HighsInt i = 0; i < current_k; i++) {
-      row_p[i] = L[p * current_k_max + i];
-    }
-
-    //> move all rows > p up by one row
-    for (HighsInt row = p; row < current_k - 1; row++) {
-      for (HighsInt i = 0; i < current_k; i++) {
-        L[row * current_k_max + i] = L[(row + 1) * current_k_max + i];
-      }
-    }
-
-    //> load row p
-    for (HighsInt i = 0; i < current_k; i++) {
-      L[(current_k - 1) * current_k_max + i] = row_p[i];
-    }
-
-    //> now move col p to the right in each row
-    for (HighsInt row = 0; row < current_k; row++) {
-      double p_entry = L[row * current_k_max + p];
-      for (HighsInt col = p; col < current_k - 1; col++) {
-        L[row * current_k_max + col] = L[row * current_k_max + col + 1];
-      }
-      L[row * current_k_max + current_k - 1] = p_entry;
+    // next step: move row/col p of R to the bottom/right. The rows of L
+    // (columns of R) other than p keep their order, so they are compacted
+    // in place after saving row p of L and the entries of row p of R,
+    // which becomes the spike left of the diagonal in the last row of R
+    std::vector<double> l_row_p(&L[rowStart(p)], &L[rowStart(p + 1)]);
+    std::vector<double> spike(current_k, 0.0);
+    for (HighsInt col = p + 1; col < current_k; col++)
+      spike[col - 1] = L[rowStart(col) + p];
+
+    size_t to_el = rowStart(p);
+    for (HighsInt col = p + 1; col < current_k; col++) {
+      const double* l_col = &L[rowStart(col)];
+      for (HighsInt row = 0; row <= col; row++)
+        if (row != p) L[to_el++] = l_col[row];
     }
+    // the last row of L is the saved row p, with a diagonal entry from
+    // the old R(p, p)
+    assert(to_el == rowStart(current_k - 1));
+    for (HighsInt i = 0; i < p; i++) L[to_el++] = l_row_p[i];
+    for (HighsInt i = p; i < current_k - 1; i++) L[to_el++] = 0.0;
+    L[to_el] = l_row_p[p];
 
     if (current_k == 1) {
       current_k--;
+      L.clear();
       return;
     }
 
@@ -254,8 +232,8 @@ class NewCholeskyFactor {
       // |   1x| |xxxxx|       |   1| |   x |
       //         |xx  x|       |xxxx| |  xxx|
       // next: remove nonzero entries in last column except for diagonal element
-      for (HighsInt r = (HighsInt)p - 1; r >= 0; r--) {  // to current_k-1
-        eliminate(L, current_k - 1, r, current_k_max, current_k);
+      for (HighsInt r = p - 1; r >= 0; r--) {  // to current_k-1
+        eliminate(spike, current_k - 1, r);
       }
 
       // situation now:
@@ -267,36 +245,31 @@ class NewCholeskyFactor {
       // next: multiply product
       // new last row: old last row (first current_k-1 elements) + r *
       // R_current_k_current_k
-
+      const double r_last = L[rowStart(current_k) - 1];
       for (HighsInt i = 0; i < nrr.d.num_nz; i++) {
         HighsInt idx = nrr.d.index[i];
         if (idx == nrr.maxabsd) {
           continue;
         }
-        if (idx < nrr.maxabsd) {
-          L[(current_k - 1) * current_k_max + idx] +=
-              -nrr.d.value[idx] / nrr.d.value[nrr.maxabsd] *
-              L[(current_k - 1) * current_k_max + current_k - 1];
-        } else {
-          L[(current_k - 1) * current_k_max + idx - 1] +=
-              -nrr.d.value[idx] / nrr.d.value[nrr.maxabsd] *
-              L[(current_k - 1) * current_k_max + current_k - 1];
-        }
+        const HighsInt col = idx < nrr.maxabsd ? idx : idx - 1;
+        spike[col] +=
+            -nrr.d.value[idx] / nrr.d.value[nrr.maxabsd] * r_last;
       }
       // situation now: as above, but no more product
     }
     // next: eliminate last row
     for (HighsInt i = 0; i < current_k - 1; i++) {
-      eliminate(L, i, current_k - 1, current_k_max, current_k);
+      eliminate(spike, i, current_k - 1);
     }
     current_k--;
+    L.resize(rowStart(current_k));
   }
 
   void report(std::string name = "") {
     printf("%s\n", name.c_str());
     for (HighsInt i = 0; i < current_k; i++) {
       for (HighsInt j = 0; j < current_k; j++) {
-        printf("%lf ", L[i * current_k_max + j]);
+        printf("%lf ", j < i ? 0.0 : L[rowStart(j) + i]);
       }
       printf("\n");
     }
@@ -308,11 +281,9 @@ class NewCholeskyFactor {
     }
 
     HighsInt num_nz = 0;
-    for (HighsInt i = 0; i < current_k; i++) {
-      for (HighsInt j = 0; j < current_k; j++) {
-        if (fabs(L[i * current_k_max + j]) > 10e-8) {
-          num_nz++;
-        }
+    for (const double value : L) {
+      if (fabs(value) > 10e-8) {
+        num_nz++;
       }
     }
     return (double)num_nz / (current_k * (current_k + 1) / 2.0);
@@ -104,4 +104,97 @@ void computestartingpoint(Runtime& runtime, CrashSolution*& result) {
   result->rowact = ra;
 }
 
+// Construct a starting point from a previous active set and primal values.
+// Variable bounds that were active are imposed at their (possibly changed)
+// value, other variables are moved into their bounds and constraints that
+// are no longer at their bound are released from the active set. Returns
+// false if the resulting point is infeasible or the active set does not
+// match the instance, in which case the crash start must be used.
+bool computehotstart(Runtime& runtime,
+                     const std::vector<HighsBasisStatus>& status_var,
+                     const std::vector<HighsBasisStatus>& status_con,
+                     const std::vector<double>& x0, CrashSolution*& result) {
+  const Instance& instance = runtime.instance;
+  const HighsInt num_var = instance.num_var;
+  const HighsInt num_con = instance.num_con;
+  if ((HighsInt)status_var.size() != num_var ||
+      (HighsInt)status_con.size() != num_con ||
+      (HighsInt)x0.size() < num_var)
+    return false;
+  const double tolerance = runtime.settings.hotstart_feasibility_tolerance;
+
+  std::vector<HighsInt> initialactive;
+  std::vector<HighsInt> initialinactive;
+  std::vector<BasisStatus> atlower;
+
+  std::vector<double> x(num_var);
+  for (HighsInt i = 0; i < num_var; i++) {
+    const double lower = instance.var_lo[i];
+    const double upper = instance.var_up[i];
+    x[i] = std::min(std::max(x0[i], lower), upper);
+    const HighsBasisStatus status = status_var[i];
+    if (status == HighsBasisStatus::kBasic) continue;
+    if (status == HighsBasisStatus::kLower && lower > -kHighsInf) {
+      x[i] = lower;
+      initialactive.push_back(num_con + i);
+      atlower.push_back(BasisStatus::ActiveAtLower);
+    } else if (status == HighsBasisStatus::kUpper && upper < kHighsInf) {
+      x[i] = upper;
+      initialactive.push_back(num_con + i);
+      atlower.push_back(BasisStatus::ActiveAtUpper);
+    } else {
+      initialinactive.push_back(num_con + i);
+    }
+  }
+
+  std::vector<double> rowact(num_con, 0.0);
+  for (HighsInt col = 0; col < num_var; col++) {
+    if (x[col] == 0.0) continue;
+    for (HighsInt idx = instance.A.mat.start[col];
+         idx < instance.A.mat.start[col + 1]; idx++)
+      rowact[instance.A.mat.index[idx]] += instance.A.mat.value[idx] * x[col];
+  }
+
+  for (HighsInt i = 0; i < num_con; i++) {
+    const double lower = instance.con_lo[i];
+    const double upper = instance.con_up[i];
+    if (rowact[i] < lower - tolerance || rowact[i] > upper + tolerance)
+      return false;
+    const HighsBasisStatus status = status_con[i];
+    if (status == HighsBasisStatus::kBasic) continue;
+    if (status == HighsBasisStatus::kLower &&
+        fabs(rowact[i] - lower) <= tolerance) {
+      initialactive.push_back(i);
+      atlower.push_back(BasisStatus::ActiveAtLower);
+    } else if (status == HighsBasisStatus::kUpper &&
+               fabs(rowact[i] - upper) <= tolerance) {
+      initialactive.push_back(i);
+      atlower.push_back(BasisStatus::ActiveAtUpper);
+    } else {
+      initialinactive.push_back(i);
+    }
+  }
+
+  if ((HighsInt)(initialactive.size() + initialinactive.size()) != num_var)
+    return false;
+
+  result = new CrashSolution(num_var, num_con);
+  result->rowstatus = atlower;
+  result->active = initialactive;
+  result->inactive = initialinactive;
+  for (HighsInt i = 0; i < num_var; i++) {
+    if (x[i] != 0.0) {
+      result->primal.value[i] = x[i];
+      result->primal.index[result->primal.num_nz++] = i;
+    }
+  }
+  for (HighsInt i = 0; i < num_con; i++) {
+    if (rowact[i] != 0.0) {
+      result->rowact.value[i] = rowact[i];
+      result->rowact.index[result->rowact.num_nz++] = i;
+    }
+  }
+  return true;
+}
+
 #endif
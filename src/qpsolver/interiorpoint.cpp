@@ -0,0 +1,543 @@
+#include "interiorpoint.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+void InteriorPointSolver::setup() {
+  const Instance& instance = runtime.instance;
+  num_var = instance.num_var;
+  num_con = instance.num_con;
+  num_tot = num_var + num_con;
+  num_kkt = num_tot + num_con;
+
+  lower.resize(num_tot);
+  upper.resize(num_tot);
+  for (HighsInt j = 0; j < num_var; j++) {
+    lower[j] = instance.var_lo[j];
+    upper[j] = instance.var_up[j];
+  }
+  for (HighsInt r = 0; r < num_con; r++) {
+    lower[num_var + r] = instance.con_lo[r];
+    upper[num_var + r] = instance.con_up[r];
+  }
+  has_lower.resize(num_tot);
+  has_upper.resize(num_tot);
+  is_fixed.resize(num_tot);
+  for (HighsInt j = 0; j < num_tot; j++) {
+    has_lower[j] = lower[j] > -std::numeric_limits<double>::infinity();
+    has_upper[j] = upper[j] < std::numeric_limits<double>::infinity();
+    is_fixed[j] = lower[j] == upper[j];
+  }
+
+  // Build the pattern of the augmented matrix column by column. Rows and
+  // columns of fixed variables are replaced by unit vectors so that their
+  // Newton step is zero.
+  const MatrixBase& A = instance.A.mat;
+  const MatrixBase& Q = instance.Q.mat;
+  const bool has_hessian = Q.value.size() > 0;
+  std::vector<HighsInt> a_row_count(num_con, 0);
+  for (HighsInt j = 0; j < num_var; j++) {
+    if (is_fixed[j]) continue;
+    for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++)
+      a_row_count[A.index[el]]++;
+  }
+  // row-wise copy of the entries of A in non-fixed columns, used for the
+  // columns of the dual variables
+  std::vector<HighsInt> ar_start(num_con + 1, 0);
+  for (HighsInt r = 0; r < num_con; r++)
+    ar_start[r + 1] = ar_start[r] + a_row_count[r];
+  std::vector<HighsInt> ar_index(ar_start[num_con]);
+  std::vector<double> ar_value(ar_start[num_con]);
+  for (HighsInt j = 0; j < num_var; j++) {
+    if (is_fixed[j]) continue;
+    for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++) {
+      HighsInt r = A.index[el];
+      HighsInt put = ar_start[r + 1] - a_row_count[r]--;
+      ar_index[put] = j;
+      ar_value[put] = A.value[el];
+    }
+  }
+
+  kkt_start.assign(1, 0);
+  kkt_index.clear();
+  kkt_value.clear();
+  kkt_diag.assign(num_tot, -1);
+  hessian_diag.assign(num_tot, 0.0);
+  for (HighsInt j = 0; j < num_var; j++) {
+    kkt_diag[j] = kkt_index.size();
+    kkt_index.push_back(j);
+    kkt_value.push_back(1.0);
+    if (!is_fixed[j]) {
+      if (has_hessian) {
+        for (HighsInt el = Q.start[j]; el < Q.start[j + 1]; el++) {
+          HighsInt i = Q.index[el];
+          if (i == j) {
+            hessian_diag[j] += Q.value[el];
+          } else if (!is_fixed[i] && Q.value[el] != 0.0) {
+            kkt_index.push_back(i);
+            kkt_value.push_back(-Q.value[el]);
+          }
+        }
+      }
+      for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++) {
+        kkt_index.push_back(num_tot + A.index[el]);
+        kkt_value.push_back(A.value[el]);
+      }
+    }
+    kkt_start.push_back(kkt_index.size());
+  }
+  for (HighsInt r = 0; r < num_con; r++) {
+    HighsInt j = num_var + r;
+    kkt_diag[j] = kkt_index.size();
+    kkt_index.push_back(j);
+    kkt_value.push_back(1.0);
+    if (!is_fixed[j]) {
+      kkt_index.push_back(num_tot + r);
+      kkt_value.push_back(-1.0);
+    }
+    kkt_start.push_back(kkt_index.size());
+  }
+  for (HighsInt r = 0; r < num_con; r++) {
+    for (HighsInt el = ar_start[r]; el < ar_start[r + 1]; el++) {
+      kkt_index.push_back(ar_index[el]);
+      kkt_value.push_back(ar_value[el]);
+    }
+    if (!is_fixed[num_var + r]) {
+      kkt_index.push_back(num_var + r);
+      kkt_value.push_back(-1.0);
+    }
+    kkt_index.push_back(num_tot + r);
+    kkt_value.push_back(dual_regularization);
+    kkt_start.push_back(kkt_index.size());
+  }
+
+  base_index.resize(num_kkt);
+  for (HighsInt k = 0; k < num_kkt; k++) base_index[k] = k;
+  factor.setup(num_kkt, num_kkt, &kkt_start[0], &kkt_index[0], &kkt_value[0],
+               &base_index[0]);
+  kkt_rhs.setup(num_kkt);
+
+  v.assign(num_tot, 0.0);
+  y.assign(num_con, 0.0);
+  zl.assign(num_tot, 0.0);
+  zu.assign(num_tot, 0.0);
+  res_primal.assign(num_con, 0.0);
+  res_dual.assign(num_tot, 0.0);
+}
+
+void InteriorPointSolver::initialPoint() {
+  const MatrixBase& A = runtime.instance.A.mat;
+  // start from the origin moved into the interior of the bounds, and row
+  // activities consistent with it before they are moved
+  auto moveInside = [&](HighsInt j, double value) {
+    if (is_fixed[j]) return lower[j];
+    if (has_lower[j] && has_upper[j]) {
+      double margin = std::min(1.0, 0.5 * (upper[j] - lower[j]));
+      return std::min(std::max(value, lower[j] + margin), upper[j] - margin);
+    }
+    if (has_lower[j]) return std::max(value, lower[j] + 1.0);
+    if (has_upper[j]) return std::min(value, upper[j] - 1.0);
+    return value;
+  };
+  for (HighsInt j = 0; j < num_var; j++) v[j] = moveInside(j, 0.0);
+  std::vector<double> activity(num_con, 0.0);
+  for (HighsInt j = 0; j < num_var; j++)
+    for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++)
+      activity[A.index[el]] += A.value[el] * v[j];
+  for (HighsInt r = 0; r < num_con; r++)
+    v[num_var + r] = moveInside(num_var + r, activity[r]);
+
+  for (HighsInt j = 0; j < num_tot; j++) {
+    if (is_fixed[j]) continue;
+    if (has_lower[j]) zl[j] = 1.0;
+    if (has_upper[j]) zu[j] = 1.0;
+  }
+}
+
+void InteriorPointSolver::computeResiduals() {
+  const Instance& instance = runtime.instance;
+  const MatrixBase& A = instance.A.mat;
+  const MatrixBase& Q = instance.Q.mat;
+  // rp = w - Ax
+  for (HighsInt r = 0; r < num_con; r++) res_primal[r] = v[num_var + r];
+  // rd = -(Qx + c - A'y - zl + zu) for x, and -(y - zl + zu) for w
+  for (HighsInt j = 0; j < num_var; j++) {
+    double gradient = instance.c.value[j];
+    if (Q.value.size() > 0)
+      for (HighsInt el = Q.start[j]; el < Q.start[j + 1]; el++)
+        gradient += Q.value[el] * v[Q.index[el]];
+    double aty = 0.0;
+    for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++) {
+      res_primal[A.index[el]] -= A.value[el] * v[j];
+      aty += A.value[el] * y[A.index[el]];
+    }
+    res_dual[j] = is_fixed[j] ? 0.0 : -(gradient - aty - zl[j] + zu[j]);
+  }
+  for (HighsInt r = 0; r < num_con; r++) {
+    HighsInt j = num_var + r;
+    res_dual[j] = is_fixed[j] ? 0.0 : -(y[r] - zl[j] + zu[j]);
+  }
+}
+
+double InteriorPointSolver::complementarity(HighsInt& num_pairs) const {
+  double sum = 0.0;
+  num_pairs = 0;
+  for (HighsInt j = 0; j < num_tot; j++) {
+    if (is_fixed[j]) continue;
+    if (has_lower[j]) {
+      sum += (v[j] - lower[j]) * zl[j];
+      num_pairs++;
+    }
+    if (has_upper[j]) {
+      sum += (upper[j] - v[j]) * zu[j];
+      num_pairs++;
+    }
+  }
+  return sum;
+}
+
+bool InteriorPointSolver::factorize() {
+  for (HighsInt j = 0; j < num_tot; j++) {
+    if (is_fixed[j]) {
+      kkt_value[kkt_diag[j]] = 1.0;
+      continue;
+    }
+    double theta = primal_regularization;
+    if (has_lower[j]) theta += zl[j] / (v[j] - lower[j]);
+    if (has_upper[j]) theta += zu[j] / (upper[j] - v[j]);
+    kkt_value[kkt_diag[j]] = -(hessian_diag[j] + theta);
+  }
+  for (HighsInt r = 0; r < num_con; r++)
+    kkt_value[kkt_start[num_tot + r + 1] - 1] = dual_regularization;
+
+  for (HighsInt k = 0; k < num_kkt; k++) base_index[k] = k;
+  return factor.build() == 0;
+}
+
+void InteriorPointSolver::solveNewton(const std::vector<double>& rhs_dual,
+                                      const std::vector<double>& rhs_primal,
+                                      const std::vector<double>& rhs_lower,
+                                      const std::vector<double>& rhs_upper,
+                                      std::vector<double>& dv,
+                                      std::vector<double>& dy,
+                                      std::vector<double>& dzl,
+                                      std::vector<double>& dzu) {
+  kkt_rhs.clear();
+  auto addRhs = [&](HighsInt k, double value) {
+    if (value == 0.0) return;
+    kkt_rhs.array[k] = value;
+    kkt_rhs.index[kkt_rhs.count++] = k;
+  };
+  for (HighsInt j = 0; j < num_tot; j++) {
+    if (is_fixed[j]) continue;
+    double rhs = rhs_dual[j];
+    if (has_lower[j]) rhs += rhs_lower[j] / (v[j] - lower[j]);
+    if (has_upper[j]) rhs -= rhs_upper[j] / (upper[j] - v[j]);
+    addRhs(j, -rhs);
+  }
+  for (HighsInt r = 0; r < num_con; r++) addRhs(num_tot + r, rhs_primal[r]);
+
+  factor.ftran(kkt_rhs, 1.0);
+
+  for (HighsInt k = 0; k < num_kkt; k++) {
+    HighsInt col = base_index[k];
+    double value = kkt_rhs.array[k];
+    if (col < num_tot)
+      dv[col] = value;
+    else
+      dy[col - num_tot] = value;
+  }
+  for (HighsInt j = 0; j < num_tot; j++) {
+    dzl[j] = 0.0;
+    dzu[j] = 0.0;
+    if (is_fixed[j]) {
+      dv[j] = 0.0;
+      continue;
+    }
+    if (has_lower[j]) dzl[j] = (rhs_lower[j] - zl[j] * dv[j]) / (v[j] - lower[j]);
+    if (has_upper[j]) dzu[j] = (rhs_upper[j] + zu[j] * dv[j]) / (upper[j] - v[j]);
+  }
+}
+
+double InteriorPointSolver::stepToBoundary(
+    const std::vector<double>& dv, const std::vector<double>& dzl,
+    const std::vector<double>& dzu) const {
+  double alpha = 1.0;
+  for (HighsInt j = 0; j < num_tot; j++) {
+    if (is_fixed[j]) continue;
+    if (has_lower[j]) {
+      if (dv[j] < 0) alpha = std::min(alpha, -(v[j] - lower[j]) / dv[j]);
+      if (dzl[j] < 0) alpha = std::min(alpha, -zl[j] / dzl[j]);
+    }
+    if (has_upper[j]) {
+      if (dv[j] > 0) alpha = std::min(alpha, (upper[j] - v[j]) / dv[j]);
+      if (dzu[j] < 0) alpha = std::min(alpha, -zu[j] / dzu[j]);
+    }
+  }
+  return alpha;
+}
+
+bool InteriorPointSolver::primalInfeasible() const {
+  // The dual iterate (y, zl, zu), scaled by its largest entry, is a Farkas
+  // ray if s = zu - zl for s = A'y for x and s = -y for w, where zl and zu
+  // are zero for infinite bounds and a fixed variable has a free
+  // multiplier, and l'zl - u'zu > 0
+  const MatrixBase& A = runtime.instance.A.mat;
+  const double tolerance = runtime.settings.ipm_infeasibility_tolerance;
+  double scale = 0.0;
+  for (HighsInt r = 0; r < num_con; r++) scale = std::max(scale, fabs(y[r]));
+  for (HighsInt j = 0; j < num_tot; j++)
+    scale = std::max(scale, std::max(zl[j], zu[j]));
+  if (scale < runtime.settings.ipm_ray_min_norm) return false;
+
+  double ray_objective = 0.0;
+  for (HighsInt j = 0; j < num_tot; j++) {
+    double s = 0.0;
+    if (j < num_var) {
+      for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++)
+        s += A.value[el] * y[A.index[el]];
+    } else {
+      s = -y[j - num_var];
+    }
+    if (is_fixed[j]) {
+      ray_objective -= lower[j] * s;
+      continue;
+    }
+    const double ray_zl = has_lower[j] ? zl[j] : 0.0;
+    const double ray_zu = has_upper[j] ? zu[j] : 0.0;
+    if (fabs(s - ray_zu + ray_zl) > tolerance * scale) return false;
+    if (has_lower[j]) ray_objective += lower[j] * ray_zl;
+    if (has_upper[j]) ray_objective -= upper[j] * ray_zu;
+  }
+  return ray_objective > tolerance * scale;
+}
+
+bool InteriorPointSolver::dualInfeasible() const {
+  // The primal iterate v = [x; w], scaled by its largest entry, is a
+  // direction of unbounded descent d if Ad_x = d_w, Qd_x = 0, d is in the
+  // recession cone of the bounds and c'd_x < 0
+  const Instance& instance = runtime.instance;
+  const MatrixBase& Q = instance.Q.mat;
+  const double tolerance = runtime.settings.ipm_infeasibility_tolerance;
+  double scale = 0.0;
+  for (HighsInt j = 0; j < num_tot; j++) scale = std::max(scale, fabs(v[j]));
+  if (scale < runtime.settings.ipm_ray_min_norm) return false;
+
+  for (HighsInt r = 0; r < num_con; r++)
+    if (fabs(res_primal[r]) > tolerance * scale) return false;
+  double ray_objective = 0.0;
+  for (HighsInt j = 0; j < num_tot; j++) {
+    if (has_lower[j] && v[j] - lower[j] < -tolerance * scale) return false;
+    if (has_upper[j] && v[j] - upper[j] > tolerance * scale) return false;
+    if (j >= num_var) continue;
+    ray_objective += instance.c.value[j] * v[j];
+    if (Q.value.size() == 0) continue;
+    double qx = 0.0;
+    for (HighsInt el = Q.start[j]; el < Q.start[j + 1]; el++)
+      qx += Q.value[el] * v[Q.index[el]];
+    if (fabs(qx) > tolerance * scale) return false;
+  }
+  return ray_objective < -tolerance * scale;
+}
+
+void InteriorPointSolver::extractSolution() {
+  const Instance& instance = runtime.instance;
+  const MatrixBase& A = instance.A.mat;
+  const MatrixBase& Q = instance.Q.mat;
+
+  runtime.primal.reset();
+  for (HighsInt j = 0; j < num_var; j++) runtime.primal.value[j] = v[j];
+  runtime.primal.resparsify();
+
+  runtime.rowactivity.reset();
+  for (HighsInt j = 0; j < num_var; j++)
+    for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++)
+      runtime.rowactivity.value[A.index[el]] += A.value[el] * v[j];
+  runtime.rowactivity.resparsify();
+
+  runtime.dualcon.reset();
+  for (HighsInt r = 0; r < num_con; r++) runtime.dualcon.value[r] = y[r];
+  runtime.dualcon.resparsify();
+
+  // reduced costs Qx + c - A'y, which equal zl - zu for variables that are
+  // not fixed
+  runtime.dualvar.reset();
+  for (HighsInt j = 0; j < num_var; j++) {
+    double dual = instance.c.value[j];
+    if (Q.value.size() > 0)
+      for (HighsInt el = Q.start[j]; el < Q.start[j + 1]; el++)
+        dual += Q.value[el] * v[Q.index[el]];
+    for (HighsInt el = A.start[j]; el < A.start[j + 1]; el++)
+      dual -= A.value[el] * y[A.index[el]];
+    runtime.dualvar.value[j] = dual;
+  }
+  runtime.dualvar.resparsify();
+}
+
+void InteriorPointSolver::solve() {
+  runtime.statistics.time_start = std::chrono::high_resolution_clock::now();
+  setup();
+  initialPoint();
+
+  const Instance& instance = runtime.instance;
+  const MatrixBase& Q = instance.Q.mat;
+  const double tolerance = runtime.settings.ipm_optimality_tolerance;
+  double max_cost = 0.0;
+  for (HighsInt j = 0; j < num_var; j++)
+    max_cost = std::max(max_cost, fabs(instance.c.value[j]));
+
+  std::vector<double> dv(num_tot), dy(num_con), dzl(num_tot), dzu(num_tot);
+  std::vector<double> dv_aff(num_tot), dy_aff(num_con), dzl_aff(num_tot),
+      dzu_aff(num_tot);
+  std::vector<double> rhs_lower(num_tot), rhs_upper(num_tot);
+
+  while (true) {
+    computeResiduals();
+    HighsInt num_pairs;
+    const double gap = complementarity(num_pairs);
+    double mu = num_pairs ? gap / num_pairs : 0.0;
+
+    double max_primal = 0.0;
+    double max_res_primal = 0.0;
+    double sum_res_primal = 0.0;
+    HighsInt num_res_primal = 0;
+    for (HighsInt j = 0; j < num_tot; j++)
+      max_primal = std::max(max_primal, fabs(v[j]));
+    for (HighsInt r = 0; r < num_con; r++) {
+      double res = fabs(res_primal[r]);
+      max_res_primal = std::max(max_res_primal, res);
+      sum_res_primal += res;
+      if (res > tolerance) num_res_primal++;
+    }
+    double max_res_dual = 0.0;
+    for (HighsInt j = 0; j < num_tot; j++)
+      max_res_dual = std::max(max_res_dual, fabs(res_dual[j]));
+
+    double objective = instance.offset;
+    for (HighsInt j = 0; j < num_var; j++) {
+      double qx = 0.0;
+      if (Q.value.size() > 0)
+        for (HighsInt el = Q.start[j]; el < Q.start[j + 1]; el++)
+          qx += Q.value[el] * v[Q.index[el]];
+      objective += (instance.c.value[j] + 0.5 * qx) * v[j];
+    }
+    double elapsed =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::high_resolution_clock::now() -
+            runtime.statistics.time_start)
+            .count();
+
+    if (runtime.statistics.num_iterations %
+            runtime.settings.reportingfequency ==
+        0) {
+      runtime.statistics.iteration.push_back(runtime.statistics.num_iterations);
+      runtime.statistics.nullspacedimension.push_back(0);
+      runtime.statistics.objval.push_back(objective);
+      runtime.statistics.time.push_back(elapsed);
+      runtime.statistics.sum_primal_infeasibilities.push_back(sum_res_primal);
+      runtime.statistics.num_primal_infeasibilities.push_back(num_res_primal);
+      runtime.statistics.density_nullspace.push_back(0.0);
+      runtime.statistics.density_factor.push_back(0.0);
+      runtime.endofiterationevent.fire(runtime);
+    }
+
+    const bool primal_feasible =
+        max_res_primal <= tolerance * (1.0 + max_primal);
+    const bool dual_feasible = max_res_dual <= tolerance * (1.0 + max_cost);
+    // the sum of the complementarity products is the duality gap
+    const bool complementary = gap <= tolerance * (1.0 + fabs(objective));
+    if (primal_feasible && dual_feasible && complementary) {
+      runtime.status = ProblemStatus::OPTIMAL;
+      break;
+    }
+    if (runtime.statistics.num_iterations >= runtime.settings.iterationlimit) {
+      runtime.status = ProblemStatus::ITERATIONLIMIT;
+      break;
+    }
+    if (elapsed >= runtime.settings.timelimit) {
+      runtime.status = ProblemStatus::TIMELIMIT;
+      break;
+    }
+    if (!primal_feasible && primalInfeasible()) {
+      runtime.status = ProblemStatus::INFEASIBLE;
+      break;
+    }
+    if (!dual_feasible && dualInfeasible()) {
+      runtime.status = ProblemStatus::UNBOUNDED;
+      break;
+    }
+    if (!std::isfinite(mu) || max_primal > 1e20) {
+      // the iterates diverge without either ray having been found
+      runtime.status = ProblemStatus::INDETERMINED;
+      break;
+    }
+    runtime.statistics.num_iterations++;
+
+    // factorize the augmented system, increasing the regularization if it
+    // is found to be singular
+    bool factorized = factorize();
+    for (HighsInt attempt = 0; !factorized && attempt < 4; attempt++) {
+      primal_regularization *= 100;
+      dual_regularization *= 100;
+      factorized = factorize();
+    }
+    if (!factorized) {
+      runtime.status = ProblemStatus::INDETERMINED;
+      break;
+    }
+
+    // predictor
+    for (HighsInt j = 0; j < num_tot; j++) {
+      rhs_lower[j] = has_lower[j] ? -(v[j] - lower[j]) * zl[j] : 0.0;
+      rhs_upper[j] = has_upper[j] ? -(upper[j] - v[j]) * zu[j] : 0.0;
+    }
+    solveNewton(res_dual, res_primal, rhs_lower, rhs_upper, dv_aff, dy_aff,
+                dzl_aff, dzu_aff);
+    double alpha_aff = stepToBoundary(dv_aff, dzl_aff, dzu_aff);
+
+    // centering parameter from the complementarity after the affine step
+    double sum_aff = 0.0;
+    for (HighsInt j = 0; j < num_tot; j++) {
+      if (is_fixed[j]) continue;
+      if (has_lower[j]) {
+        sum_aff += (v[j] - lower[j] + alpha_aff * dv_aff[j]) *
+                   (zl[j] + alpha_aff * dzl_aff[j]);
+      }
+      if (has_upper[j]) {
+        sum_aff += (upper[j] - v[j] - alpha_aff * dv_aff[j]) *
+                   (zu[j] + alpha_aff * dzu_aff[j]);
+      }
+    }
+    double sigma = 0.0;
+    if (num_pairs && mu > 0) {
+      double mu_aff = sum_aff / num_pairs;
+      sigma = std::pow(mu_aff / mu, 3);
+      sigma = std::min(1.0, sigma);
+    }
+
+    // corrector
+    for (HighsInt j = 0; j < num_tot; j++) {
+      if (has_lower[j])
+        rhs_lower[j] = sigma * mu - (v[j] - lower[j]) * zl[j] -
+                       dv_aff[j] * dzl_aff[j];
+      if (has_upper[j])
+        rhs_upper[j] = sigma * mu - (upper[j] - v[j]) * zu[j] +
+                       dv_aff[j] * dzu_aff[j];
+    }
+    solveNewton(res_dual, res_primal, rhs_lower, rhs_upper, dv, dy, dzl, dzu);
+    double alpha = std::min(1.0, 0.995 * stepToBoundary(dv, dzl, dzu));
+
+    for (HighsInt j = 0; j < num_tot; j++) {
+      v[j] += alpha * dv[j];
+      zl[j] += alpha * dzl[j];
+      zu[j] += alpha * dzu[j];
+    }
+    for (HighsInt r = 0; r < num_con; r++) y[r] += alpha * dy[r];
+  }
+
+  extractSolution();
+  runtime.statistics.time_end = std::chrono::high_resolution_clock::now();
+}
@@ -0,0 +1,99 @@
+#ifndef __SRC_LIB_INTERIORPOINT_HPP__
+#define __SRC_LIB_INTERIORPOINT_HPP__
+
+#include <vector>
+
+#include "runtime.hpp"
+#include "simplex/HFactor.h"
+#include "simplex/HVector.h"
+
+// Primal-dual interior point method for convex QP
+//
+//   min c'x + 1/2 x'Qx  s.t.  con_lo <= Ax <= con_up, var_lo <= x <= var_up
+//
+// The row activities are introduced as variables w = Ax so that all
+// variables v = [x; w] are bounded and the constraints read Ax - w = 0. Each
+// iteration solves the quasidefinite augmented system
+//
+//   | -(Q + Theta)  A' | |dv|   |-rd|
+//   |  A           delta | |dy| = | rp|
+//
+// with Mehrotra's predictor-corrector. The augmented matrix is factorized
+// with HFactor, so the solver works with the sparsity of A and Q rather than
+// forming normal equations, which would be dense for non-separable Q.
+//
+// When the problem is primal infeasible the dual iterates diverge, and
+// scaled to unit size they approach a Farkas ray. When it is unbounded
+// the primal iterates diverge along a direction of unbounded descent.
+// The iterates are checked for both once they are large, and if neither
+// is found when they diverge the status is INDETERMINED.
+//
+// On return the Runtime primal/dual vectors are filled in the same form as
+// the active set solver, so the caller can post-process both identically.
+class InteriorPointSolver {
+ public:
+  InteriorPointSolver(Runtime& rt) : runtime(rt) {}
+
+  void solve();
+
+ private:
+  Runtime& runtime;
+
+  HighsInt num_var;
+  HighsInt num_con;
+  // number of variables in v = [x; w]
+  HighsInt num_tot;
+  // dimension of the augmented system
+  HighsInt num_kkt;
+
+  std::vector<double> lower;
+  std::vector<double> upper;
+  std::vector<bool> has_lower;
+  std::vector<bool> has_upper;
+  std::vector<bool> is_fixed;
+
+  // iterate
+  std::vector<double> v;
+  std::vector<double> y;
+  std::vector<double> zl;
+  std::vector<double> zu;
+
+  // residuals
+  std::vector<double> res_primal;
+  std::vector<double> res_dual;
+
+  // augmented matrix, CSC with fixed pattern and the position of the diagonal
+  // entry of each of the first num_tot columns
+  std::vector<HighsInt> kkt_start;
+  std::vector<HighsInt> kkt_index;
+  std::vector<double> kkt_value;
+  std::vector<HighsInt> kkt_diag;
+  std::vector<double> hessian_diag;
+  std::vector<HighsInt> base_index;
+  HFactor factor;
+
+  HVector kkt_rhs;
+
+  double primal_regularization = 1e-8;
+  double dual_regularization = 1e-8;
+
+  void setup();
+  void initialPoint();
+  void computeResiduals();
+  double complementarity(HighsInt& num_pairs) const;
+  bool factorize();
+  void solveNewton(const std::vector<double>& rhs_dual,
+                   const std::vector<double>& rhs_primal,
+                   const std::vector<double>& rhs_lower,
+                   const std::vector<double>& rhs_upper,
+                   std::vector<double>& dv, std::vector<double>& dy,
+                   std::vector<double>& dzl, std::vector<double>& dzu);
+  double stepToBoundary(const std::vector<double>& dv,
+                        const std::vector<double>& dzl,
+                        const std::vector<double>& dzu) const;
+  bool primalInfeasible() const;
+  bool dualInfeasible() const;
+  void extractSolution();
+};
+
+#endif
@@ -46,54 +46,6 @@ struct MatrixBase {
     return target;
   }
 
-  Vector& mat_vec_par(const Vector& other, Vector& target) const {
-    target.reset();
-
-    unsigned nb_threads_hint = std::thread::hardware_concurrency();
-    unsigned nb_threads = nb_threads_hint == 0 ? 8 : (nb_threads_hint);
-
-    unsigned batch_size = other.num_nz / (nb_threads + 1);
-
-    std::vector<std::thread> my_threads(nb_threads);
-    std::vector<Vector> results(nb_threads, num_row);
-
-    for (unsigned i = 0; i < nb_threads; ++i) {
-      HighsInt batch_start = i * batch_size;
-      my_threads[i] = std::thread(
-          [&](HighsInt tid, HighsInt thread_start) {
-            // thread i: compute for columns start-start+batch_size
-
-            for (HighsInt nz = thread_start; nz < thread_start + batch_size;
-                 nz++) {
-              HighsInt col = other.index[nz];
-              for (HighsInt idx = start[col]; idx < start[col + 1]; idx++) {
-                HighsInt row = index[idx];
-                results[tid].value[row] += value[idx] * other.value[col];
-              }
-            }
-            results[tid].resparsify();
-          },
-          i, batch_start);
-    }
-
-    for (HighsInt nz = nb_threads * batch_size; nz < other.num_nz; nz++) {
-      HighsInt col = other.index[nz];
-      for (HighsInt idx = start[col]; idx < start[col + 1]; idx++) {
-        HighsInt row = index[idx];
-        target.value[row] += value[idx] * other.value[col];
-      }
-    }
-
-    std::for_each(my_threads.begin(), my_threads.end(),
-                  std::mem_fn(&std::thread::join));
-
-    for (HighsInt i = 0; i < nb_threads; i++) {
-      target += results[i];
-    }
-    target.resparsify();
-    return target;
-  }
-
   Vector& mat_vec(const Vector& other, Vector& target) const {
     return mat_vec_seq(other, target);
   }
@@ -206,22 +158,18 @@ struct MatrixBase {
 
   Vector& vec_mat_1(const Vector& other, Vector& target) const {
     target.reset();
-    // #pragma omp parallel for shared(target)
-    // TODO: loop over idx array, not start
-    PARALLELISM_SETTING par = num_col > 9999999 ? PARALLELISM_SETTING::BUILTIN
-                                                : PARALLELISM_SETTING::NONE;
-    parallel_for(num_col,
-                 [&](HighsInt starts, HighsInt end) {
-                   for (HighsInt i = starts; i < end; i++) {
-                     double dot = 0.0;
-                     for (HighsInt j = start[i]; j < start[i + 1]; j++) {
-                       dot += other.value[index[j]] * value[j];
-                     }
-
-                     target.value[i] = dot;
-                   }
-                 },
-                 par);
+    // each entry of the result is independent, so the columns are shared out
+    // in chunks of roughly equal numbers of nonzeros
+    parallel_for_nnz(num_col, start, [&](HighsInt starts, HighsInt end) {
+      for (HighsInt i = starts; i < end; i++) {
+        double dot = 0.0;
+        for (HighsInt j = start[i]; j < start[i + 1]; j++) {
+          dot += other.value[index[j]] * value[j];
+        }
+
+        target.value[i] = dot;
+      }
+    });
     target.resparsify();
     return target;
   }
@@ -437,6 +385,18 @@ struct Matrix {
   }
 
   Vector& mat_vec(const Vector& other, Vector& target) {
+    // the column-wise product scatters into the result, so cannot be shared
+    // between threads. The row-wise product from the (cached) transpose can
+    // be, but touches every nonzero of the matrix, so is only used when
+    // that work shared between the threads is less than the work of the
+    // column-wise product, which exploits sparsity in "other"
+    const int64_t num_nz = mat.index.size();
+    HighsInt work = mat.num_col == 0
+                        ? 0
+                        : (HighsInt)(other.num_nz * num_nz / mat.num_col);
+    if (parallel_setting(work) == PARALLELISM_SETTING::OMP &&
+        num_nz < (int64_t)work * parallel_num_threads())
+      return t().vec_mat(other, target);
     return mat.mat_vec(other, target);
   }
 
@@ -3,13 +3,40 @@
 
 #include <algorithm>
 #include <functional>
-#include <mutex>
 #include <thread>
 #include <vector>
 #include "util/HighsInt.h"
 
+#ifdef OPENMP
+#include "omp.h"
+#endif
+
 enum class PARALLELISM_SETTING { NONE, OMP, BUILTIN };
 
+// Loops touching fewer nonzeros than this are run serially: below it the
+// cost of waking the thread team exceeds the work that is shared out
+const HighsInt kParallelWorkThreshold = 50000;
+
+inline unsigned parallel_num_threads() {
+#ifdef OPENMP
+  return omp_get_max_threads();
+#else
+  unsigned nb_threads_hint = std::thread::hardware_concurrency();
+  return nb_threads_hint == 0 ? 8 : (nb_threads_hint);
+#endif
+}
+
+/// Choose how to run a loop that touches "work" nonzeros. The OpenMP thread
+/// team is created once and reused, so OMP is used whenever it is available
+/// and there is enough work; otherwise the loop is serial.
+inline PARALLELISM_SETTING parallel_setting(HighsInt work) {
+#ifdef OPENMP
+  if (work >= kParallelWorkThreshold && omp_get_max_threads() > 1)
+    return PARALLELISM_SETTING::OMP;
+#endif
+  return PARALLELISM_SETTING::NONE;
+}
+
 /// @param[in] nb_elements : size of your for loop
 /// @param[in] functor(start, end) :
 /// your function processing a sub chunk of the for loop.
@@ -21,115 +48,103 @@ enum class PARALLELISM_SETTING { NONE, OMP, BUILTIN };
 /// @endcode
 /// @param use_threads : enable / disable threads.
 ///
-///
-static void parallel_for(
+/// The loop is split into one contiguous chunk per thread. In OMP mode the
+/// chunks run on the OpenMP thread team, BUILTIN spawns a std::thread per
+/// chunk on every call, so should only be used for very long loops.
+inline void parallel_for(
     unsigned nb_elements,
     std::function<void(HighsInt start, HighsInt end)> functor,
     PARALLELISM_SETTING mode = PARALLELISM_SETTING::NONE) {
   // -------
-  unsigned nb_threads_hint = std::thread::hardware_concurrency();
-  unsigned nb_threads = nb_threads_hint == 0 ? 8 : (nb_threads_hint);
+  HighsInt nb_chunks =
+      std::min((HighsInt)parallel_num_threads(), (HighsInt)nb_elements);
+  if (nb_chunks <= 1) mode = PARALLELISM_SETTING::NONE;
 
-  unsigned batch_size = nb_elements / nb_threads;
-  unsigned batch_remainder = nb_elements % nb_threads;
+  // first index of chunk i, spreading any remainder over the chunks
+  auto chunk_start = [&](HighsInt i) {
+    return (HighsInt)(((int64_t)i * nb_elements) / nb_chunks);
+  };
 
-  std::vector<std::thread> my_threads(nb_threads);
-  HighsInt start;
   switch (mode) {
     case PARALLELISM_SETTING::NONE:
       functor(0, nb_elements);
       break;
-    case PARALLELISM_SETTING::BUILTIN:
-      for (unsigned i = 0; i < nb_threads; ++i) {
-        start = i * batch_size;
-        my_threads[i] = std::thread(functor, start, start + batch_size);
-      }
-      start = nb_threads * batch_size;
-      functor(start, start + batch_remainder);
+    case PARALLELISM_SETTING::BUILTIN: {
+      std::vector<std::thread> my_threads(nb_chunks - 1);
+      for (HighsInt i = 0; i < nb_chunks - 1; ++i)
+        my_threads[i] = std::thread(functor, chunk_start(i), chunk_start(i + 1));
+      functor(chunk_start(nb_chunks - 1), nb_elements);
 
       std::for_each(my_threads.begin(), my_threads.end(),
                     std::mem_fn(&std::thread::join));
       break;
+    }
     case PARALLELISM_SETTING::OMP:
-#pragma omp parallel for
-      for (unsigned i = 0; i < nb_elements; ++i) {
-        functor(i, i + 1);
+#pragma omp parallel for schedule(static, 1)
+      for (HighsInt i = 0; i < nb_chunks; ++i) {
+        functor(chunk_start(i), chunk_start(i + 1));
       }
       break;
   }
 }
 
-static void parallel_for_obo(HighsInt nb_elements,
+/// Loop over the columns of a CSC matrix with column starts "start", cutting
+/// the chunks so that each holds roughly the same number of nonzeros rather
+/// than the same number of columns
+inline void parallel_for_nnz(
+    HighsInt nb_elements, const std::vector<HighsInt>& start,
+    std::function<void(HighsInt start, HighsInt end)> functor) {
+  const HighsInt nnz = start[nb_elements] - start[0];
+  if (parallel_setting(nnz) == PARALLELISM_SETTING::NONE) {
+    functor(0, nb_elements);
+    return;
+  }
+  // a few chunks per thread so that dense columns do not stall one thread
+  const HighsInt nb_chunks =
+      std::min((HighsInt)(4 * parallel_num_threads()), nb_elements);
+  auto chunk_start = [&](HighsInt i) {
+    if (i == nb_chunks) return nb_elements;
+    HighsInt target = start[0] + (HighsInt)(((int64_t)i * nnz) / nb_chunks);
+    return (HighsInt)(std::lower_bound(start.begin(),
+                                       start.begin() + nb_elements, target) -
+                      start.begin());
+  };
+#pragma omp parallel for schedule(dynamic, 1)
+  for (HighsInt i = 0; i < nb_chunks; ++i) {
+    HighsInt first = chunk_start(i);
+    HighsInt last = chunk_start(i + 1);
+    if (first < last) functor(first, last);
+  }
+}
+
+/// Calls functor on each element in turn. This is serial: the work per
+/// element is too small to be worth sharing between threads
+inline void parallel_for_obo(HighsInt nb_elements,
                              std::function<void(HighsInt idx)> functor) {
   // -------
-  unsigned nb_threads_hHighsInt = std::thread::hardware_concurrency();
-  unsigned nb_threads = 1;  // nb_threads_hHighsInt == 0 ? 8 :
-                            // (nb_threads_hint);
-
-  std::vector<std::thread> my_threads(nb_threads);
-
-  HighsInt assigned = 0;
-  std::vector<HighsInt> current(nb_threads, 0);
-  std::mutex lock;
-  for (HighsInt i = 0; i < nb_threads; i++) {
-    my_threads[i] = std::thread(
-        [&](HighsInt tid) {
-          while (true) {
-            lock.lock();
-            if (assigned < nb_elements) {
-              current[tid] = assigned++;
-              lock.unlock();
-            } else {
-              lock.unlock();
-              break;
-            }
-
-            functor(current[tid]);
-          }
-        },
-        i);
-  }
-  std::for_each(my_threads.begin(), my_threads.end(),
-                std::mem_fn(&std::thread::join));
+  for (HighsInt i = 0; i < nb_elements; i++) functor(i);
 }
 
-static void parallel_for_frac(
+inline void parallel_for_frac(
     HighsInt nb_elements,
     std::function<void(HighsInt start, HighsInt end)> functor) {
   // -------
-  unsigned nb_threads_hint = std::thread::hardware_concurrency();
-  unsigned nb_threads = nb_threads_hint == 0 ? 8 : (nb_threads_hint);
-
-  std::vector<std::thread> my_threads(nb_threads);
-
-  HighsInt assigned = 0;
-  std::vector<HighsInt> current_start(nb_threads, 0);
-  std::vector<HighsInt> current_end(nb_threads, 0);
-  std::mutex lock;
-  for (HighsInt i = 0; i < nb_threads; i++) {
-    my_threads[i] = std::thread(
-        [&](HighsInt tid) {
-          while (true) {
-            lock.lock();
-            if (assigned < nb_elements) {
-              HighsInt left = nb_elements - assigned;
-              HighsInt assign = left / (3 * nb_threads) + 1;
-              current_start[tid] = assigned;
-              assigned = std::min(nb_elements, assigned + assign);
-              current_end[tid] = assigned;
-              lock.unlock();
-            } else {
-              lock.unlock();
-              break;
-            }
-
-            functor(current_start[tid], current_end[tid]);
-          }
-        },
-        i);
+  // Splits the elements into equal chunks, run in parallel unless the loop
+  // is too short to gain from threads, as in parallel_for. Guided
+  // scheduling hands out large batches of chunks first and smaller ones
+  // later, so that threads finish at about the same time
+  const HighsInt nb_chunks =
+      std::min((HighsInt)(8 * parallel_num_threads()), nb_elements);
+  if (nb_chunks <= 1 ||
+      parallel_setting(nb_elements) == PARALLELISM_SETTING::NONE) {
+    functor(0, nb_elements);
+    return;
+  }
+#pragma omp parallel for schedule(guided)
+  for (HighsInt i = 0; i < nb_chunks; ++i) {
+    functor((HighsInt)(((int64_t)i * nb_elements) / nb_chunks),
+            (HighsInt)(((int64_t)(i + 1) * nb_elements) / nb_chunks));
   }
-  std::for_each(my_threads.begin(), my_threads.end(),
-                std::mem_fn(&std::thread::join));
 }
 
 #endif
@@ -3,10 +3,18 @@
 
 #include "eventhandler.hpp"
 #include "instance.hpp"
+#include "lp_data/HConst.h"
 #include "settings.hpp"
 #include "statistics.hpp"
 
-enum class ProblemStatus { INDETERMINED, OPTIMAL, UNBOUNDED, INFEASIBLE };
+enum class ProblemStatus {
+  INDETERMINED,
+  OPTIMAL,
+  UNBOUNDED,
+  INFEASIBLE,
+  ITERATIONLIMIT,
+  TIMELIMIT
+};
 
 struct Runtime {
   Instance instance;
@@ -21,6 +29,12 @@ struct Runtime {
   Vector dualcon;
   ProblemStatus status = ProblemStatus::INDETERMINED;
 
+  // active set on termination of the active set solver, expressed as the
+  // status of the variable bounds and constraints: those active at a bound
+  // are kLower/kUpper, those in the basis but not active are kZero
+  std::vector<HighsBasisStatus> status_var;
+  std::vector<HighsBasisStatus> status_con;
+
   Runtime(Instance& inst)
       : instance(inst),
         primal(Vector(instance.num_var)),
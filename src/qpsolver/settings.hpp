@@ -24,6 +24,14 @@ struct Settings {
   HighsInt iterationlimit = std::numeric_limits<HighsInt>::infinity();
   double timelimit = std::numeric_limits<double>::infinity();
 
+  double ipm_optimality_tolerance = 1e-8;
+  // relative tolerance on the rays used by the IPM to detect primal and
+  // dual infeasibility, and the size of the iterates at which they are
+  // checked
+  double ipm_infeasibility_tolerance = 1e-6;
+  double ipm_ray_min_norm = 1e6;
+  double hotstart_feasibility_tolerance = 1e-7;
+
   bool rowscaling = true;
   bool varscaling = true;
 
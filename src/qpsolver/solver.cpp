@@ -30,6 +30,19 @@ void Solver::solve() {
   solve(crash->primal, crash->rowact, basis);
 }
 
+void Solver::solve(const std::vector<HighsBasisStatus>& status_var,
+                   const std::vector<HighsBasisStatus>& status_con,
+                   const std::vector<double>& x0) {
+  CrashSolution* crash = NULL;
+  if (!computehotstart(runtime, status_var, status_con, x0, crash)) {
+    solve();
+    return;
+  }
+  Basis basis(runtime, crash->active, crash->rowstatus, crash->inactive);
+  solve(crash->primal, crash->rowact, basis);
+  delete crash;
+}
+
 Solver::Solver(Runtime& rt) : runtime(rt) {}
 
 void Solver::loginformation(Runtime& rt, Basis& basis, Nullspace& ns,
@@ -172,6 +185,16 @@ void Solver::solve(const Vector& x0, const Vector& ra, Basis& b0) {
       }
 
       ns.expand_computenewcol(minidx, buffer_yp);
+      // the new nullspace direction increases the activity of constraint
+      // minidx, keeping the other active constraints at their bounds. For a
+      // constraint active at its upper bound this leaves the feasible
+      // region, so the step would be zero and the solve would stop short of
+      // optimality: reverse it. The crash start from an LP basis can have
+      // bounds and constraints active at their upper bounds, so this arises
+      // when solving from cold as well as from a hot start
+      if (basis.getstatus(minidx) == BasisStatus::ActiveAtUpper) {
+        buffer_yp.scale(-1.0);
+      }
       buffer_l.dim = basis.getnuminactive();
       computesearchdirection_major(runtime, ns, basis, factor, buffer_yp,
                                    gradient, buffer_gyp, buffer_l, p);
@@ -261,6 +284,28 @@ void Solver::solve(const Vector& x0, const Vector& ra, Basis& b0) {
   if (basis.getnumactive() == runtime.instance.num_var) {
     runtime.primal = basis.recomputex(runtime.instance);
   }
+
+  // record the final active set so that a subsequent solve can start from it
+  runtime.status_var.assign(runtime.instance.num_var, HighsBasisStatus::kBasic);
+  runtime.status_con.assign(runtime.instance.num_con, HighsBasisStatus::kBasic);
+  for (HighsInt con : basis.getactive()) {
+    HighsBasisStatus status = basis.getstatus(con) == BasisStatus::ActiveAtLower
+                                  ? HighsBasisStatus::kLower
+                                  : HighsBasisStatus::kUpper;
+    if (con >= runtime.instance.num_con) {
+      runtime.status_var[con - runtime.instance.num_con] = status;
+    } else {
+      runtime.status_con[con] = status;
+    }
+  }
+  for (HighsInt con : basis.getinactive()) {
+    if (con >= runtime.instance.num_con) {
+      runtime.status_var[con - runtime.instance.num_con] =
+          HighsBasisStatus::kZero;
+    } else {
+      runtime.status_con[con] = HighsBasisStatus::kZero;
+    }
+  }
   // x.report("x");
   runtime.statistics.time_end = std::chrono::high_resolution_clock::now();
 }
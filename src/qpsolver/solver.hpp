@@ -15,6 +15,12 @@ struct Solver {
 
   void solve();
 
+  // solve starting from a previous active set and primal values, falling
+  // back on the crash start if they are not consistent with the instance
+  void solve(const std::vector<HighsBasisStatus>& status_var,
+             const std::vector<HighsBasisStatus>& status_con,
+             const std::vector<double>& x0);
+
  private:
   Runtime& runtime;
 
@@ -3,6 +3,7 @@
 
 #include "basis.hpp"
 #include "runtime.hpp"
+#include "parallel.hpp"
 #include "pricing.hpp"
 
 //
@@ -15,8 +16,8 @@ class SteepestEdgePricing : public Pricing {
   std::vector<double> weights;
 
   HighsInt chooseconstrainttodrop(const Vector& lambda) {
-    auto activeconstraintidx = basis.getactive();
-    auto constraintindexinbasisfactor = basis.getindexinfactor();
+    const auto& activeconstraintidx = basis.getactive();
+    const auto& constraintindexinbasisfactor = basis.getindexinfactor();
 
     HighsInt minidx = -1;
     double maxval = 0.0;
@@ -70,17 +71,22 @@ class SteepestEdgePricing : public Pricing {
     Vector v = basis.btran(aq);
 
     double weight_p = weights[rowindex_p];
-    for (HighsInt i = 0; i < runtime.instance.num_var; i++) {
-      if (i == rowindex_p) {
-        weights[i] = weight_p / (aq.value[rowindex_p] * aq.value[rowindex_p]);
-      } else {
-        weights[i] = weights[i] -
-                     2 * (aq.value[i] / aq.value[rowindex_p]) * (v.value[i]) +
-                     (aq.value[i] * aq.value[i]) /
-                         (aq.value[rowindex_p] * aq.value[rowindex_p]) *
-                         weight_p;
-      }
-    }
+    double aq_p = aq.value[rowindex_p];
+    HighsInt num_var = runtime.instance.num_var;
+    parallel_for(
+        num_var,
+        [&](HighsInt first, HighsInt last) {
+          for (HighsInt i = first; i < last; i++) {
+            if (i == rowindex_p) {
+              weights[i] = weight_p / (aq_p * aq_p);
+            } else {
+              weights[i] = weights[i] - 2 * (aq.value[i] / aq_p) * (v.value[i]) +
+                           (aq.value[i] * aq.value[i]) / (aq_p * aq_p) *
+                               weight_p;
+            }
+          }
+        },
+        parallel_setting(num_var));
   }
 };
 
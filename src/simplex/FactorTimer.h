@@ -32,6 +32,7 @@ enum iClockFactor {
   FactorFtranLowerAPF,     //!< FTRAN Lower part APF
   FactorFtranLowerSps,     //!< FTRAN Lower part sparse
   FactorFtranLowerHyper,   //!< FTRAN Lower part hyper-sparse
+  FactorFtranLowerReach,   //!< FTRAN Lower part hyper-sparse reach
   FactorFtranUpper,        //!< FTRAN Upper part
   FactorFtranUpperFT,      //!< FTRAN Upper part FT
   FactorFtranUpperMPF,     //!< FTRAN Upper part MPF
@@ -44,16 +45,19 @@ enum iClockFactor {
   FactorFtranUpperHyper3,  //!< FTRAN Upper part hyper-sparse
   FactorFtranUpperHyper4,  //!< FTRAN Upper part hyper-sparse
   FactorFtranUpperHyper5,  //!< FTRAN Upper part hyper-sparse
+  FactorFtranUpperReach,   //!< FTRAN Upper part hyper-sparse reach
   FactorFtranUpperPF,      //!< FTRAN Upper part PF
   FactorBtran,             //!< BTRAN
   FactorBtranLower,        //!< BTRAN Lower part
   FactorBtranLowerSps,     //!< BTRAN Lower part sparse
   FactorBtranLowerHyper,   //!< BTRAN Lower part hyper-sparse
+  FactorBtranLowerReach,   //!< BTRAN Lower part hyper-sparse reach
   FactorBtranLowerAPF,     //!< BTRAN Lower part APF
   FactorBtranUpper,        //!< BTRAN Upper part
   FactorBtranUpperPF,      //!< BTRAN Upper part PF
   FactorBtranUpperSps,     //!< BTRAN Upper part sparse
   FactorBtranUpperHyper,   //!< BTRAN Upper part hyper-sparse
+  FactorBtranUpperReach,   //!< BTRAN Upper part hyper-sparse reach
   FactorBtranUpperFT,      //!< BTRAN Upper part FT
   FactorBtranUpperMPF,     //!< BTRAN Upper part MPF
   FactorNumClock           //!< Number of factor clocks
@@ -98,6 +102,7 @@ class FactorTimer {
     clock[FactorFtranLowerAPF] = timer.clock_def("FTRAN Lower APF", "FLA");
     clock[FactorFtranLowerSps] = timer.clock_def("FTRAN Lower Sps", "FLS");
     clock[FactorFtranLowerHyper] = timer.clock_def("FTRAN Lower Hyper", "FLH");
+    clock[FactorFtranLowerReach] = timer.clock_def("FTRAN Lower Reach", "FLR");
     clock[FactorFtranUpper] = timer.clock_def("FTRAN Upper", "FTU");
     clock[FactorFtranUpperFT] = timer.clock_def("FTRAN Upper FT", "FUF");
     clock[FactorFtranUpperMPF] = timer.clock_def("FTRAN Upper MPF", "FUM");
@@ -116,16 +121,19 @@ class FactorTimer {
         timer.clock_def("FTRAN Upper Hyper4", "FUH");
     clock[FactorFtranUpperHyper5] =
         timer.clock_def("FTRAN Upper Hyper5", "FUH");
+    clock[FactorFtranUpperReach] = timer.clock_def("FTRAN Upper Reach", "FUR");
     clock[FactorFtranUpperPF] = timer.clock_def("FTRAN Upper PF", "FUP");
     clock[FactorBtran] = timer.clock_def("BTRAN", "BTR");
     clock[FactorBtranLower] = timer.clock_def("BTRAN Lower", "BTL");
     clock[FactorBtranLowerSps] = timer.clock_def("BTRAN Lower Sps", "BLS");
     clock[FactorBtranLowerHyper] = timer.clock_def("BTRAN Lower Hyper", "BLH");
+    clock[FactorBtranLowerReach] = timer.clock_def("BTRAN Lower Reach", "BLR");
     clock[FactorBtranLowerAPF] = timer.clock_def("BTRAN Lower APF", "BLA");
     clock[FactorBtranUpper] = timer.clock_def("BTRAN Upper", "BTU");
     clock[FactorBtranUpperPF] = timer.clock_def("BTRAN Upper PF", "BUP");
     clock[FactorBtranUpperSps] = timer.clock_def("BTRAN Upper Sps", "BUS");
     clock[FactorBtranUpperHyper] = timer.clock_def("BTRAN Upper Hyper", "BUH");
+    clock[FactorBtranUpperReach] = timer.clock_def("BTRAN Upper Reach", "BUR");
     clock[FactorBtranUpperFT] = timer.clock_def("BTRAN Upper FT", "BUF");
     clock[FactorBtranUpperMPF] = timer.clock_def("BTRAN Upper MPS", "BUM");
   };
@@ -168,13 +176,15 @@ class FactorTimer {
     std::vector<HighsInt> factor_clock_list{
         FactorInvertSimple,     FactorInvertKernel,     FactorInvertDeficient,
         FactorInvertFinish,     FactorFtranLowerAPF,    FactorFtranLowerSps,
-        FactorFtranLowerHyper,  FactorFtranUpperFT,     FactorFtranUpperMPF,
-        FactorFtranUpperSps0,   FactorFtranUpperSps1,   FactorFtranUpperSps2,
-        FactorFtranUpperHyper0, FactorFtranUpperHyper1, FactorFtranUpperHyper2,
-        FactorFtranUpperHyper3, FactorFtranUpperHyper4, FactorFtranUpperHyper5,
-        FactorFtranUpperPF,     FactorBtranLowerSps,    FactorBtranLowerHyper,
+        FactorFtranLowerHyper,  FactorFtranLowerReach,  FactorFtranUpperFT,
+        FactorFtranUpperMPF,    FactorFtranUpperSps0,   FactorFtranUpperSps1,
+        FactorFtranUpperSps2,   FactorFtranUpperHyper0, FactorFtranUpperHyper1,
+        FactorFtranUpperHyper2, FactorFtranUpperHyper3, FactorFtranUpperHyper4,
+        FactorFtranUpperHyper5, FactorFtranUpperReach,  FactorFtranUpperPF,
+        FactorBtranLowerSps,    FactorBtranLowerHyper,  FactorBtranLowerReach,
         FactorBtranLowerAPF,    FactorBtranUpperPF,     FactorBtranUpperSps,
-        FactorBtranUpperHyper,  FactorBtranUpperFT,     FactorBtranUpperMPF};
+        FactorBtranUpperHyper,  FactorBtranUpperReach,  FactorBtranUpperFT,
+        FactorBtranUpperMPF};
     reportFactorClockList("FactorLevel2", factor_timer_clock,
                           factor_clock_list);
   };
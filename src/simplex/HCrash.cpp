@@ -336,14 +336,16 @@ bool HCrash::bixby_iz_da() {
     }
   }
   if (bixby_n_cdd_r == 0) return false;
+  // Find largest |entry| in each column
+#pragma omp parallel for schedule(static) if (numCol >= crsh_mn_parallel_n_c)
+  for (HighsInt c_n = 0; c_n < numCol; c_n++) {
+    double c_mx_abs_v = 0.0;
+    for (HighsInt el_n = Astart[c_n]; el_n < Astart[c_n + 1]; el_n++)
+      c_mx_abs_v = max(fabs(Avalue[el_n]), c_mx_abs_v);
+    crsh_mtx_c_mx_abs_v[c_n] = c_mx_abs_v;
+  }
   double mx_co_v = -kHighsInf;
   for (HighsInt c_n = 0; c_n < numCol; c_n++) {
-    // Find largest |entry| in each column
-    crsh_mtx_c_mx_abs_v[c_n] = 0.0;
-    for (HighsInt el_n = Astart[c_n]; el_n < Astart[c_n + 1]; el_n++) {
-      crsh_mtx_c_mx_abs_v[c_n] =
-          max(fabs(Avalue[el_n]), crsh_mtx_c_mx_abs_v[c_n]);
-    }
     double sense_col_cost = objSense * colCost[c_n];
     mx_co_v = max(fabs(sense_col_cost), mx_co_v);
   }
@@ -768,7 +770,7 @@ void HCrash::ltssf_u_da_af_bs_cg() {
         // Set crsh_r_pri_mn_r_k to numCol+1 in case r_k=numCol so priority is
         // cleared
         crsh_r_pri_mn_r_k[pri_v] = numCol + 1;
-        for (HighsInt qy_k = r_k + 1; qy_k < numCol + 1; qy_k++) {
+        for (HighsInt qy_k = r_k + 1; qy_k < crsh_mx_r_k + 1; qy_k++) {
           HighsInt hdr_ix = pri_v * (numCol + 1) + qy_k;
           if (crsh_r_pri_k_hdr[hdr_ix] != no_lk) {
             crsh_r_pri_mn_r_k[pri_v] = qy_k;
@@ -858,7 +860,7 @@ void HCrash::ltssf_u_da_af_no_bs_cg() {
     // Set crsh_r_pri_mn_r_k to numCol + 1 in case r_k=numCol so
     // priority is cleared
     crsh_r_pri_mn_r_k[pri_v] = numCol + 1;
-    for (HighsInt qy_k = r_k + 1; qy_k < numCol + 1; qy_k++) {
+    for (HighsInt qy_k = r_k + 1; qy_k < crsh_mx_r_k + 1; qy_k++) {
       HighsInt hdr_ix = pri_v * (numCol + 1) + qy_k;
       if (crsh_r_pri_k_hdr[hdr_ix] != no_lk) {
         crsh_r_pri_mn_r_k[pri_v] = qy_k;
@@ -970,8 +972,10 @@ void HCrash::ltssf_iz_da() {
     crsh_r_k[r_n] = 0;
   }
 
-  // Determine the status and type of each column and compute the
-  // number of active entries in each row and column
+  // Determine the status and type of each column, its number of
+  // active entries and its largest entry. These are independent for
+  // each column so, for large LPs, are computed in parallel
+#pragma omp parallel for schedule(static) if (numCol >= crsh_mn_parallel_n_c)
   for (HighsInt c_n = 0; c_n < numCol; c_n++) {
     HighsInt vr_ty = crsh_c_ty[c_n];
     HighsInt pri_v = crsh_c_ty_pri_v[vr_ty];
@@ -980,25 +984,28 @@ void HCrash::ltssf_iz_da() {
       // Columns with no priority value are fixed or zero - and should
       // be removed by presolve. They will be nonbasic
       crsh_act_c[c_n] = crsh_vr_st_no_act;
-    } else {
-      crsh_act_c[c_n] = crsh_vr_st_act;
+      continue;
     }
+    crsh_act_c[c_n] = crsh_vr_st_act;
     //  TODO Count the original number of columns of this type
-    if (crsh_act_c[c_n] == crsh_vr_st_act) {
-      // The column is active: count the active rows and update the
-      // number of active entries in those rows
-      //
-      // Initialise the count of active entries in the row
-      crsh_c_k[c_n] = 0;
-      for (HighsInt el_n = Astart[c_n]; el_n < Astart[c_n + 1]; el_n++) {
-        HighsInt r_n = Aindex[el_n];
-        if (crsh_act_r[r_n] != crsh_vr_st_no_act) {
-          // The row is active so increase the number of active
-          // entries in the column and row
-          crsh_c_k[c_n] += 1;
-          crsh_r_k[r_n] += 1;
-        }
-      }
+    //
+    // The column is active: count the active rows and find its
+    // largest entry
+    HighsInt c_k = 0;
+    double c_mx_abs_v = 0.0;
+    for (HighsInt el_n = Astart[c_n]; el_n < Astart[c_n + 1]; el_n++) {
+      c_mx_abs_v = max(fabs(Avalue[el_n]), c_mx_abs_v);
+      if (crsh_act_r[Aindex[el_n]] != crsh_vr_st_no_act) c_k += 1;
+    }
+    crsh_c_k[c_n] = c_k;
+    crsh_mtx_c_mx_abs_v[c_n] = c_mx_abs_v;
+  }
+  // Update the number of active entries in each row
+  for (HighsInt c_n = 0; c_n < numCol; c_n++) {
+    if (crsh_act_c[c_n] == crsh_vr_st_no_act) continue;
+    for (HighsInt el_n = Astart[c_n]; el_n < Astart[c_n + 1]; el_n++) {
+      HighsInt r_n = Aindex[el_n];
+      if (crsh_act_r[r_n] != crsh_vr_st_no_act) crsh_r_k[r_n] += 1;
     }
   }
   // Now that the row counts are known, make any zero rows non-active.
@@ -1009,6 +1016,7 @@ void HCrash::ltssf_iz_da() {
     crsh_r_pri_mn_r_k[pri_v] = numCol + 1;
   }
 
+  crsh_mx_r_k = 0;
   for (HighsInt r_n = 0; r_n < numRow; r_n++) {
     if (crsh_act_r[r_n] == crsh_vr_st_no_act) continue;
     // Row appears active but check whether it is empty
@@ -1016,6 +1024,7 @@ void HCrash::ltssf_iz_da() {
       crsh_act_r[r_n] = crsh_vr_st_no_act;
       continue;
     }
+    crsh_mx_r_k = max(crsh_r_k[r_n], crsh_mx_r_k);
     // Add as the header of the appropriate priority value list
     HighsInt pri_v = crsh_r_ty_pri_v[crsh_r_ty[r_n]];
     HighsInt r_k = crsh_r_k[r_n];
@@ -1037,12 +1046,8 @@ void HCrash::ltssf_iz_da() {
   }
   for (HighsInt c_n = 0; c_n < numCol; c_n++) {
     if (crsh_act_c[c_n] == crsh_vr_st_no_act) continue;
-    // Column is active so find its largest entry in updating the row counts
-    crsh_mtx_c_mx_abs_v[c_n] = 0.0;
     for (HighsInt el_n = Astart[c_n]; el_n < Astart[c_n + 1]; el_n++) {
       HighsInt r_n = Aindex[el_n];
-      crsh_mtx_c_mx_abs_v[c_n] =
-          max(fabs(Avalue[el_n]), crsh_mtx_c_mx_abs_v[c_n]);
       if (crsh_act_r[r_n] == crsh_vr_st_no_act) continue;
       HighsInt r_el_n = CrshARstart[r_n];
       CrshARindex[r_el_n] = c_n;
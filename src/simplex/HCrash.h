@@ -46,6 +46,9 @@ const HighsInt no_ix = no_lk;
 // LTSSF scalar control parameters
 const double tl_crsh_abs_pv_v = 1e-4;
 const double tl_crsh_rlv_pv_v = 1e-2;
+// Number of columns above which the data for each column are computed in
+// parallel
+const HighsInt crsh_mn_parallel_n_c = 10000;
 // Switches for LTSSF checking and reporting
 const HighsInt ltssf_ck_fq = 0;
 #ifdef HiGHSDEV
@@ -197,6 +200,9 @@ class HCrash {
   HighsInt n_rlv_pv_no_ok;
   HighsInt mx_r_pri;
   HighsInt mx_c_pri;
+  // Upper bound on the active row counts: counts only decrease, so
+  // searches for the next nonempty count list need go no further
+  HighsInt crsh_mx_r_k;
   HighsInt bixby_n_cdd_r;
   bool bixby_no_nz_c_co;
 };
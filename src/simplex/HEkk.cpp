@@ -21,6 +21,7 @@
 #include "io/HighsIO.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
+#include "simplex/HCrash.h"
 #include "simplex/HEkkDebug.h"
 #include "simplex/HEkkDual.h"
 #include "simplex/HEkkPrimal.h"
@@ -435,6 +436,8 @@ HighsInt HEkk::initialiseSimplexLpBasisAndFactor(
       return -(HighsInt)HighsStatus::kError;
     }
     setBasis();
+    if (options_.simplex_crash_strategy != kSimplexCrashStrategyOff)
+      crashBasis();
   }
   const HighsInt rank_deficiency = computeFactor();
   if (rank_deficiency) {
@@ -457,6 +460,40 @@ HighsInt HEkk::initialiseSimplexLpBasisAndFactor(
   return 0;
 }
 
+void HEkk::crashBasis() {
+  // Replace logicals in the logical basis by structurals using the
+  // crash defined by simplex_crash_strategy
+  analysis_.simplexTimerStart(CrashClock);
+  const double start_time = timer_.readRunHighsClock();
+  HCrash crash(*this);
+  crash.crash(options_.simplex_crash_strategy);
+  // The crash only changes nonbasicFlag, so set up basicIndex and
+  // nonbasicMove
+  const HighsInt num_col = lp_.num_col_;
+  const HighsInt num_row = lp_.num_row_;
+  HighsInt num_basic_variables = 0;
+  for (HighsInt iVar = 0; iVar < num_col + num_row; iVar++) {
+    if (basis_.nonbasicFlag_[iVar]) continue;
+    assert(num_basic_variables < num_row);
+    basis_.basicIndex_[num_basic_variables++] = iVar;
+  }
+  assert(num_basic_variables == num_row);
+  HighsInt num_basic_structurals = 0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    if (!basis_.nonbasicFlag_[iCol]) num_basic_structurals++;
+  info_.num_basic_logicals = num_row - num_basic_structurals;
+  setNonbasicMove();
+  const double crash_time = timer_.readRunHighsClock() - start_time;
+  analysis_.simplexTimerStop(CrashClock);
+  const double basic_structural_percent =
+      num_row ? (100.0 * num_basic_structurals) / num_row : 0;
+  highsLogDev(options_.log_options, HighsLogType::kInfo,
+              "Crash %" HIGHSINT_FORMAT " made %" HIGHSINT_FORMAT
+              " structurals basic (%.1f%% of rows) in %g seconds\n",
+              options_.simplex_crash_strategy, num_basic_structurals,
+              basic_structural_percent, crash_time);
+}
+
 void HEkk::handleRankDeficiency() {
   HighsInt rank_deficiency = factor_.rank_deficiency;
   vector<HighsInt>& noPvC = factor_.noPvC;
@@ -528,6 +565,7 @@ void HEkk::setSimplexOptions() {
   //
   info_.dual_edge_weight_strategy = options_.simplex_dual_edge_weight_strategy;
   info_.price_strategy = options_.simplex_price_strategy;
+  info_.reinversion_strategy = options_.simplex_reinversion_strategy;
   info_.dual_simplex_cost_perturbation_multiplier =
       options_.dual_simplex_cost_perturbation_multiplier;
   info_.primal_simplex_bound_perturbation_multiplier =
@@ -873,6 +911,7 @@ HighsInt HEkk::computeFactor() {
                   options_.highs_debug_level, options_.output_flag,
                   options_.log_file_stream, options_.log_to_console,
                   options_.log_dev_level);
+    factor_.setLogCallback(options_.log_options);
     status_.has_factor_arrays = true;
   }
   analysis_.simplexTimerStart(InvertClock);
@@ -1794,8 +1833,17 @@ void HEkk::updateFactor(HVector* column, HVector* row_ep, HighsInt* iRow,
   if (info_.update_count >= info_.update_limit)
     *hint = kRebuildReasonUpdateLimitReached;
 
-  // Determine whether to reinvert based on the synthetic clock
-  bool reinvert_syntheticClock = total_synthetic_tick_ >= build_synthetic_tick_;
+  // Determine whether to reinvert based on the synthetic clock. With
+  // the adaptive strategy, the growth in the synthetic cost of solves
+  // since INVERT is compared with the cost of INVERT
+  analysis_.recordUpdateSolveCost(total_synthetic_tick_);
+  bool reinvert_syntheticClock;
+  if (info_.reinversion_strategy == kSimplexReinversionStrategyAdaptive) {
+    reinvert_syntheticClock = analysis_.solveCostGrowthSaysInvert(
+        build_synthetic_tick_, total_synthetic_tick_, info_.update_count);
+  } else {
+    reinvert_syntheticClock = total_synthetic_tick_ >= build_synthetic_tick_;
+  }
   const bool performed_min_updates =
       info_.update_count >= kSyntheticTickReinversionMinUpdateCount;
   if (reinvert_syntheticClock && performed_min_updates)
@@ -2086,7 +2134,8 @@ bool HEkk::bailoutOnTimeIterations() {
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
-           model_status_ == HighsModelStatus::kObjectiveTarget);
+           model_status_ == HighsModelStatus::kObjectiveTarget ||
+           model_status_ == HighsModelStatus::kInterrupt);
   } else if (timer_.readRunHighsClock() > options_.time_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kTimeLimit;
@@ -2097,6 +2146,23 @@ bool HEkk::bailoutOnTimeIterations() {
   return solve_bailout_;
 }
 
+void HEkk::callbackOnRebuild(const double objective_function_value) {
+  if (options_.user_callback == NULL || solve_bailout_) return;
+  HighsCallbackDataOut data_out = {};
+  data_out.running_time = timer_.readRunHighsClock();
+  data_out.simplex_iteration_count = iteration_count_;
+  data_out.objective_function_value = objective_function_value;
+  data_out.mip_primal_bound = kHighsInf;
+  data_out.mip_dual_bound = -kHighsInf;
+  data_out.mip_gap = kHighsInf;
+  if (options_.user_callback(kHighsCallbackSimplexRebuild, &data_out,
+                             options_.user_callback_data)) {
+    // Bail out as if a limit had been reached
+    solve_bailout_ = true;
+    model_status_ = HighsModelStatus::kInterrupt;
+  }
+}
+
 HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
   // Always called before returning from HEkkPrimal/Dual::solve()
   if (solve_bailout_) {
@@ -2105,7 +2171,8 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
-           model_status_ == HighsModelStatus::kObjectiveTarget);
+           model_status_ == HighsModelStatus::kObjectiveTarget ||
+           model_status_ == HighsModelStatus::kInterrupt);
   }
   // Check that returnFromSolve has not already been called: it should
   // be called exactly once per solve
@@ -2188,10 +2255,12 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     case HighsModelStatus::kObjectiveBound:
     case HighsModelStatus::kObjectiveTarget:
     case HighsModelStatus::kTimeLimit:
-    case HighsModelStatus::kIterationLimit: {
+    case HighsModelStatus::kIterationLimit:
+    case HighsModelStatus::kInterrupt: {
       // Simplex has bailed out due to reaching the objecive cut-off,
-      // time or iteration limit. Could happen anywhere (other than
-      // the fist implying dual simplex)
+      // time or iteration limit, or being interrupted by the user
+      // callback. Could happen anywhere (other than the fist implying
+      // dual simplex)
       //
       // Reset the simplex bounds and recompute primals
       initialiseBound(SimplexAlgorithm::kDual, kSolvePhase2);
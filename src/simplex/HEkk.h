@@ -106,6 +106,7 @@ class HEkk {
   void updateSimplexOptions();
   void initialiseSimplexLpRandomVectors();
   void setNonbasicMove();
+  void crashBasis();
   bool getNonsingularInverse(const HighsInt solve_phase = 0);
   bool getBacktrackingBasis(double* scattered_edge_weights);
   void putBacktrackingBasis();
@@ -166,6 +167,7 @@ class HEkk {
   void invalidateDualInfeasibilityRecord();
   void invalidateDualMaxSumInfeasibilityRecord();
   bool bailoutOnTimeIterations();
+  void callbackOnRebuild(const double objective_function_value);
   HighsStatus returnFromSolve(const HighsStatus return_status);
 
   double computeBasisCondition();
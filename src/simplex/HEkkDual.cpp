@@ -160,22 +160,7 @@ HighsStatus HEkkDual::solve() {
               analysis->simplexTimerStart(SimplexIzDseWtClock);
               analysis->simplexTimerStart(DseIzClock);
             }
-            for (HighsInt i = 0; i < solver_num_row; i++) {
-              row_ep.clear();
-              row_ep.count = 1;
-              row_ep.index[0] = i;
-              row_ep.array[i] = 1;
-              row_ep.packFlag = false;
-              factor->btran(row_ep, analysis->row_ep_density,
-                            analysis->pointer_serial_factor_clocks);
-              dualRHS.workEdWt[i] = row_ep.norm2();
-              const double local_row_ep_density =
-                  (double)row_ep.count / solver_num_row;
-              analysis->updateOperationResultDensity(local_row_ep_density,
-                                                     analysis->row_ep_density);
-              ekk_instance_.updateOperationResultDensity(
-                  local_row_ep_density, ekk_instance_.info_.row_ep_density);
-            }
+            const bool computed_weights = computeExactDualSteepestEdgeWeights();
             if (ekk_instance_.analysis_.analyse_simplex_time) {
               analysis->simplexTimerStop(SimplexIzDseWtClock);
               analysis->simplexTimerStop(DseIzClock);
@@ -186,6 +171,10 @@ HighsStatus HEkkDual::solve() {
                           " initial DSE weights in %gs\n",
                           solver_num_row, IzDseWtTT);
             }
+            // Computing the weights was abandoned when the time limit was
+            // reached, in which case they are not known
+            if (!computed_weights && ekk_instance_.bailoutOnTimeIterations())
+              return ekk_instance_.returnFromSolve(HighsStatus::kWarning);
           }
         } else {
           highsLogDev(
@@ -998,9 +987,14 @@ void HEkkDual::rebuild() {
     }
     reportRebuild(reason_for_rebuild);
   }
+  // The dual objective value is for the minimization of the LP's costs
+  // multiplied by its sense
+  ekk_instance_.callbackOnRebuild((HighsInt)ekk_instance_.lp_.sense_ *
+                                  info.dual_objective_value);
 
   ekk_instance_.build_synthetic_tick_ = factor->build_synthetic_tick;
   ekk_instance_.total_synthetic_tick_ = 0;
+  analysis->resetUpdateSolveCost();
 
   // Dual simplex doesn't maintain the number of primal
   // infeasiblities, so set it to an illegal value now
@@ -1509,8 +1503,9 @@ void HEkkDual::chooseColumnSlice(HVector* row_ep) {
       //      slice_matrix[i].priceByRowSparseResult(slice_row_ap[i], *row_ep);
 
       if (use_col_price) {
-        // Perform column-wise PRICE
-        slice_matrix[i].priceByColumn(slice_row_ap[i], *row_ep);
+        // Perform column-wise PRICE. Each slice already has its own
+        // task, so isn't partitioned further
+        slice_matrix[i].priceByColumn(slice_row_ap[i], *row_ep, false);
       } else if (use_row_price_w_switch) {
         // Perform hyper-sparse row-wise PRICE, but switch if the density of
         // row_ap becomes extreme
@@ -1892,6 +1887,64 @@ void HEkkDual::updatePivots() {
   */
 }
 
+bool HEkkDual::computeExactDualSteepestEdgeWeights() {
+  // The BTRAN for each basic row is independent of the others, so they are
+  // shared between the threads, each with its own HVector. The rows are
+  // processed in batches, between which progress is logged and the time
+  // limit is checked.
+  const HighsOptions& options = ekk_instance_.options_;
+  HighsInt num_threads = 1;
+#ifdef OPENMP
+  num_threads = omp_get_max_threads();
+#endif
+  std::vector<HVector> thread_row_ep(num_threads);
+  for (HVector& thread_ep : thread_row_ep) thread_ep.setup(solver_num_row);
+  std::vector<HighsInt> row_ep_count(solver_num_row);
+  const HighsInt batch_size = kDseIzBatchSize * num_threads;
+  double log_time = ekk_instance_.timer_.readRunHighsClock();
+  for (HighsInt from_row = 0; from_row < solver_num_row;
+       from_row += batch_size) {
+    const HighsInt to_row = min(from_row + batch_size, solver_num_row);
+#pragma omp parallel for schedule(dynamic, 16)
+    for (HighsInt iRow = from_row; iRow < to_row; iRow++) {
+      HighsInt thread_id = 0;
+#ifdef OPENMP
+      thread_id = omp_get_thread_num();
+#endif
+      HVector& thread_ep = thread_row_ep[thread_id];
+      thread_ep.clear();
+      thread_ep.count = 1;
+      thread_ep.index[0] = iRow;
+      thread_ep.array[iRow] = 1;
+      thread_ep.packFlag = false;
+      factor->btran(thread_ep, analysis->row_ep_density,
+                    analysis->getThreadFactorTimerClockPointer());
+      dualRHS.workEdWt[iRow] = thread_ep.norm2();
+      row_ep_count[iRow] = thread_ep.count;
+    }
+    // Update the running average densities in row order
+    for (HighsInt iRow = from_row; iRow < to_row; iRow++) {
+      const double local_row_ep_density =
+          (double)row_ep_count[iRow] / solver_num_row;
+      analysis->updateOperationResultDensity(local_row_ep_density,
+                                             analysis->row_ep_density);
+      ekk_instance_.updateOperationResultDensity(
+          local_row_ep_density, ekk_instance_.info_.row_ep_density);
+    }
+    if (to_row == solver_num_row) break;
+    const double run_time = ekk_instance_.timer_.readRunHighsClock();
+    if (run_time > options.time_limit) return false;
+    if (run_time > log_time + kDseIzLogInterval) {
+      highsLogUser(options.log_options, HighsLogType::kInfo,
+                   "Computed %" HIGHSINT_FORMAT " of %" HIGHSINT_FORMAT
+                   " initial DSE weights\n",
+                   to_row, solver_num_row);
+      log_time = run_time;
+    }
+  }
+  return true;
+}
+
 void HEkkDual::initialiseDevexFramework(const bool parallel) {
   HighsSimplexInfo& info = ekk_instance_.info_;
   // Initialise the Devex framework: reference set is all basic
@@ -2187,7 +2240,8 @@ bool HEkkDual::bailoutOnDualObjective() {
     assert(ekk_instance_.model_status_ == HighsModelStatus::kTimeLimit ||
            ekk_instance_.model_status_ == HighsModelStatus::kIterationLimit ||
            ekk_instance_.model_status_ == HighsModelStatus::kObjectiveBound ||
-           ekk_instance_.model_status_ == HighsModelStatus::kObjectiveTarget);
+           ekk_instance_.model_status_ == HighsModelStatus::kObjectiveTarget ||
+           ekk_instance_.model_status_ == HighsModelStatus::kInterrupt);
   } else if (ekk_instance_.lp_.sense_ == ObjSense::kMinimize &&
              solve_phase == kSolvePhase2) {
     if (ekk_instance_.info_.updated_dual_objective_value >
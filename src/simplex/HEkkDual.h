@@ -36,6 +36,12 @@ class HFactor;
 const HighsInt kHighsSlicedLimit = kHighsThreadLimit;
 // Was 100, but can't see why this should be higher than kHighsThreadLimit;
 
+// Number of rows per thread for which initial DSE weights are computed
+// between checks of the time limit, and the interval (in seconds) between
+// logging the progress of the computation
+const HighsInt kDseIzBatchSize = 1000;
+const double kDseIzLogInterval = 5.0;
+
 /**
  * @brief Dual simplex solver for HiGHS
  */
@@ -253,6 +259,12 @@ class HEkkDual {
   void shiftCost(const HighsInt iCol, const double amount);
   void shiftBack(const HighsInt iCol);
 
+  /**
+   * @brief Compute exact dual steepest edge weights for a basis that is not
+   * logical, returning false if the time limit is reached first
+   */
+  bool computeExactDualSteepestEdgeWeights();
+
   /**
    * @brief Initialise a Devex framework: reference set is all basic
    * variables
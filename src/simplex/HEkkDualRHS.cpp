@@ -69,18 +69,22 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
     HighsInt randomStart = ekk_instance_.random_.integer(numRow);
     double bestMerit = 0;
     HighsInt bestIndex = -1;
-    for (HighsInt section = 0; section < 2; section++) {
-      const HighsInt start = (section == 0) ? randomStart : 0;
-      const HighsInt end = (section == 0) ? numRow : randomStart;
-      for (HighsInt iRow = start; iRow < end; iRow++) {
-        if (work_infeasibility[iRow] > kHighsZero) {
-          const double myInfeas = work_infeasibility[iRow];
-          const double myWeight = workEdWt[iRow];
-          //	  printf("Dense: Row %4" HIGHSINT_FORMAT " weight = %g\n", iRow,
-          // myWeight);
-          if (bestMerit * myWeight < myInfeas) {
-            bestMerit = myInfeas / myWeight;
-            bestIndex = iRow;
+    if (numRow >= kMinParallelChuzrCount) {
+      chooseNormalPartitioned(numRow, NULL, randomStart, bestMerit, bestIndex);
+    } else {
+      for (HighsInt section = 0; section < 2; section++) {
+        const HighsInt start = (section == 0) ? randomStart : 0;
+        const HighsInt end = (section == 0) ? numRow : randomStart;
+        for (HighsInt iRow = start; iRow < end; iRow++) {
+          if (work_infeasibility[iRow] > kHighsZero) {
+            const double myInfeas = work_infeasibility[iRow];
+            const double myWeight = workEdWt[iRow];
+            //	  printf("Dense: Row %4" HIGHSINT_FORMAT " weight = %g\n",
+            // iRow, myWeight);
+            if (bestMerit * myWeight < myInfeas) {
+              bestMerit = myInfeas / myWeight;
+              bestIndex = iRow;
+            }
           }
         }
       }
@@ -99,22 +103,27 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
     HighsInt randomStart = ekk_instance_.random_.integer(workCount);
     double bestMerit = 0;
     HighsInt bestIndex = -1;
-    for (HighsInt section = 0; section < 2; section++) {
-      const HighsInt start = (section == 0) ? randomStart : 0;
-      const HighsInt end = (section == 0) ? workCount : randomStart;
-      for (HighsInt i = start; i < end; i++) {
-        HighsInt iRow = workIndex[i];
-        if (work_infeasibility[iRow] > kHighsZero) {
-          const double myInfeas = work_infeasibility[iRow];
-          const double myWeight = workEdWt[iRow];
-          /*
-          const double myMerit = myInfeas / myWeight;
-          printf("CHUZR: iRow = %6" HIGHSINT_FORMAT "; Infeas = %11.4g; Weight =
-          %11.4g; Merit = %11.4g\n", iRow, myInfeas, myWeight, myMerit);
-          */
-          if (bestMerit * myWeight < myInfeas) {
-            bestMerit = myInfeas / myWeight;
-            bestIndex = iRow;
+    if (workCount >= kMinParallelChuzrCount) {
+      chooseNormalPartitioned(workCount, &workIndex[0], randomStart, bestMerit,
+                              bestIndex);
+    } else {
+      for (HighsInt section = 0; section < 2; section++) {
+        const HighsInt start = (section == 0) ? randomStart : 0;
+        const HighsInt end = (section == 0) ? workCount : randomStart;
+        for (HighsInt i = start; i < end; i++) {
+          HighsInt iRow = workIndex[i];
+          if (work_infeasibility[iRow] > kHighsZero) {
+            const double myInfeas = work_infeasibility[iRow];
+            const double myWeight = workEdWt[iRow];
+            /*
+            const double myMerit = myInfeas / myWeight;
+            printf("CHUZR: iRow = %6" HIGHSINT_FORMAT "; Infeas = %11.4g; Weight
+            = %11.4g; Merit = %11.4g\n", iRow, myInfeas, myWeight, myMerit);
+            */
+            if (bestMerit * myWeight < myInfeas) {
+              bestMerit = myInfeas / myWeight;
+              bestIndex = iRow;
+            }
           }
         }
       }
@@ -137,6 +146,52 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
   if (!keep_timer_running) analysis->simplexTimerStop(ChuzrDualClock);
 }
 
+void HEkkDualRHS::chooseNormalPartitioned(const HighsInt count,
+                                          const HighsInt* candidate_index,
+                                          const HighsInt randomStart,
+                                          double& bestMerit,
+                                          HighsInt& bestIndex) {
+  // The candidates are scanned in the cyclic order starting from
+  // randomStart, as in the serial loop. This order is split into
+  // kSimplexNumPartition contiguous partitions. The best candidate of each
+  // partition is found in parallel and the partition winners are then
+  // compared in order, retaining the first candidate of maximum merit, as
+  // for the serial scan.
+  const HighsInt numPart = kSimplexNumPartition;
+  double partMerit[kSimplexNumPartition];
+  HighsInt partIndex[kSimplexNumPartition];
+  const double* infeasibility = &work_infeasibility[0];
+  const double* edge_weight = &workEdWt[0];
+#pragma omp parallel for schedule(static, 1)
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    const HighsInt from = (count * iPart) / numPart;
+    const HighsInt to = (count * (iPart + 1)) / numPart;
+    double myBestMerit = 0;
+    HighsInt myBestIndex = -1;
+    for (HighsInt k = from; k < to; k++) {
+      HighsInt i = randomStart + k;
+      if (i >= count) i -= count;
+      const HighsInt iRow = candidate_index ? candidate_index[i] : i;
+      const double myInfeas = infeasibility[iRow];
+      if (myInfeas > kHighsZero) {
+        const double myWeight = edge_weight[iRow];
+        if (myBestMerit * myWeight < myInfeas) {
+          myBestMerit = myInfeas / myWeight;
+          myBestIndex = iRow;
+        }
+      }
+    }
+    partMerit[iPart] = myBestMerit;
+    partIndex[iPart] = myBestIndex;
+  }
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    if (partIndex[iPart] >= 0 && partMerit[iPart] > bestMerit) {
+      bestMerit = partMerit[iPart];
+      bestIndex = partIndex[iPart];
+    }
+  }
+}
+
 void HEkkDualRHS::chooseMultiGlobal(HighsInt* chIndex, HighsInt* chCount,
                                     HighsInt chLimit) {
   analysis->simplexTimerStart(ChuzrDualClock);
@@ -48,6 +48,18 @@ class HEkkDualRHS {
       HighsInt* chIndex  //!< Row index of variable chosen to leave the basis
   );
 
+  /**
+   * @brief Choose the candidate of maximum merit from a (possibly implicit)
+   * list of candidates, scanning partitions of the list in parallel
+   */
+  void chooseNormalPartitioned(
+      const HighsInt count,  //!< Number of candidates
+      const HighsInt* candidate_index,  //!< Candidate rows, or NULL for all
+      const HighsInt randomStart,  //!< Position at which the scan starts
+      double& bestMerit,           //!< Merit of the chosen row
+      HighsInt& bestIndex          //!< Chosen row
+  );
+
   /**
    * @brief Choose a set of row indices of good variables to leave the basis
    * (Multiple CHUZR)
@@ -15,6 +15,7 @@
  */
 #include "simplex/HEkkDualRow.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 
@@ -24,7 +25,6 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/HVector.h"
 #include "simplex/SimplexTimer.h"
-#include "util/HighsSort.h"
 
 using std::make_pair;
 using std::pair;
@@ -75,13 +75,16 @@ void HEkkDualRow::chooseMakepack(const HVector* row, const HighsInt offset) {
   const HighsInt rowCount = row->count;
   const HighsInt* rowIndex = &row->index[0];
   const double* rowArray = &row->array[0];
+  HighsInt* pack_index = &packIndex[packCount];
+  double* pack_value = &packValue[packCount];
 
+#pragma omp parallel for if (rowCount >= kMinParallelPackCount)
   for (HighsInt i = 0; i < rowCount; i++) {
     const HighsInt index = rowIndex[i];
-    const double value = rowArray[index];
-    packIndex[packCount] = index + offset;
-    packValue[packCount++] = value;
+    pack_index[i] = index + offset;
+    pack_value[i] = rowArray[index];
   }
+  packCount += rowCount;
 }
 
 void HEkkDualRow::choosePossible() {
@@ -96,16 +99,62 @@ void HEkkDualRow::choosePossible() {
   const HighsInt move_out = workDelta < 0 ? -1 : 1;
   workTheta = kHighsInf;
   workCount = 0;
-  for (HighsInt i = 0; i < packCount; i++) {
-    const HighsInt iCol = packIndex[i];
-    const HighsInt move = workMove[iCol];
-    const double alpha = packValue[i] * move_out * move;
-    if (alpha > Ta) {
-      workData[workCount++] = make_pair(iCol, alpha);
-      const double relax = workDual[iCol] * move + Td;
-      if (workTheta * alpha > relax) workTheta = relax / alpha;
+  if (packCount < kMinParallelPackCount) {
+    for (HighsInt i = 0; i < packCount; i++) {
+      const HighsInt iCol = packIndex[i];
+      const HighsInt move = workMove[iCol];
+      const double alpha = packValue[i] * move_out * move;
+      if (alpha > Ta) {
+        workData[workCount++] = make_pair(iCol, alpha);
+        const double relax = workDual[iCol] * move + Td;
+        if (workTheta * alpha > relax) workTheta = relax / alpha;
+      }
+    }
+    return;
+  }
+  // For a long packed row, count the candidates in each partition and find
+  // their least relaxed ratio in parallel. Then each partition writes its
+  // candidates from its offset in workData, so the order of the candidates
+  // is as for the serial loop.
+  const HighsInt numPart = kSimplexNumPartition;
+  HighsInt partStart[kSimplexNumPartition + 1];
+  double partTheta[kSimplexNumPartition];
+  partStart[0] = 0;
+#pragma omp parallel for schedule(static, 1)
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    const HighsInt from = (packCount * iPart) / numPart;
+    const HighsInt to = (packCount * (iPart + 1)) / numPart;
+    HighsInt myCount = 0;
+    double myTheta = kHighsInf;
+    for (HighsInt i = from; i < to; i++) {
+      const HighsInt iCol = packIndex[i];
+      const HighsInt move = workMove[iCol];
+      const double alpha = packValue[i] * move_out * move;
+      if (alpha > Ta) {
+        myCount++;
+        const double relax = workDual[iCol] * move + Td;
+        if (myTheta * alpha > relax) myTheta = relax / alpha;
+      }
+    }
+    partStart[iPart + 1] = myCount;
+    partTheta[iPart] = myTheta;
+  }
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    partStart[iPart + 1] += partStart[iPart];
+    workTheta = min(workTheta, partTheta[iPart]);
+  }
+#pragma omp parallel for schedule(static, 1)
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    const HighsInt from = (packCount * iPart) / numPart;
+    const HighsInt to = (packCount * (iPart + 1)) / numPart;
+    HighsInt myCount = partStart[iPart];
+    for (HighsInt i = from; i < to; i++) {
+      const HighsInt iCol = packIndex[i];
+      const double alpha = packValue[i] * move_out * workMove[iCol];
+      if (alpha > Ta) workData[myCount++] = make_pair(iCol, alpha);
     }
   }
+  workCount = partStart[numPart];
 }
 
 void HEkkDualRow::chooseJoinpack(const HEkkDualRow* otherRow) {
@@ -165,9 +214,9 @@ HighsInt HEkkDualRow::chooseFinal() {
   assert(use_heap_sort || use_quad_sort);
 
   if (use_heap_sort) {
-    // Take a copy of workData and workCount for the independent
-    // heap-based code
-    original_workData = workData;
+    // Take a copy of the candidates in workData and workCount for the
+    // independent heap-based code
+    original_workData.assign(workData.begin(), workData.begin() + workCount);
     alt_workCount = workCount;
   }
   analysis->simplexTimerStart(Chuzc3Clock);
@@ -340,23 +389,20 @@ bool HEkkDualRow::chooseFinalWorkGroupHeap() {
   double totalChange = initial_total_change;
   double selectTheta = workTheta;
   const double totalDelta = fabs(workDelta);
-  HighsInt heap_num_en = 0;
-  std::vector<HighsInt> heap_i;
-  std::vector<double> heap_v;
-  heap_i.resize(fullCount + 1);
-  heap_v.resize(fullCount + 1);
+  // Compute the ratios of all the candidates, and the positions of those
+  // that are possible breakpoints
+  bfrt_ratio.resize(fullCount);
+  bfrt_position.resize(fullCount);
   for (HighsInt i = 0; i < fullCount; i++) {
     HighsInt iCol = original_workData[i].first;
-    double value = original_workData[i].second;
-    double dual = workMove[iCol] * workDual[iCol];
-    double ratio = dual / value;
-    if (ratio < max_select_theta) {
-      heap_num_en++;
-      heap_i[heap_num_en] = i;
-      heap_v[heap_num_en] = ratio;
-    }
+    bfrt_ratio[i] =
+        workMove[iCol] * workDual[iCol] / original_workData[i].second;
+  }
+  HighsInt heap_num_en = 0;
+  for (HighsInt i = 0; i < fullCount; i++) {
+    bfrt_position[heap_num_en] = i;
+    heap_num_en += bfrt_ratio[i] < max_select_theta;
   }
-  maxheapsort(&heap_v[0], &heap_i[0], heap_num_en);
 
   alt_workCount = 0;
   alt_workGroup.clear();
@@ -369,10 +415,31 @@ bool HEkkDualRow::chooseFinalWorkGroupHeap() {
                            true);
     return false;
   }
+  // The breakpoints are only needed in order of increasing ratio until the
+  // total change reaches totalDelta, which is usually after a small fraction
+  // of them. Rather than sorting them all, successively larger batches of
+  // the smallest remaining ratios are selected and sorted. Ties are broken
+  // by position, so the order is well defined.
+  std::vector<HighsInt>::iterator position = bfrt_position.begin();
+  auto ratioLess = [&](const HighsInt i0, const HighsInt i1) {
+    return bfrt_ratio[i0] < bfrt_ratio[i1] ||
+           (bfrt_ratio[i0] == bfrt_ratio[i1] && i0 < i1);
+  };
+  HighsInt num_sorted = 0;
+  HighsInt batch_size = kBfrtSortBatchSize;
   HighsInt this_group_first_entry = alt_workCount;
   sorted_workData.resize(heap_num_en);
-  for (HighsInt en = 1; en <= heap_num_en; en++) {
-    HighsInt i = heap_i[en];
+  for (HighsInt en = 0; en < heap_num_en; en++) {
+    if (en == num_sorted) {
+      HighsInt to_sort = min(heap_num_en, num_sorted + batch_size);
+      if (to_sort < heap_num_en)
+        std::nth_element(position + num_sorted, position + to_sort,
+                         position + heap_num_en, ratioLess);
+      std::sort(position + num_sorted, position + to_sort, ratioLess);
+      num_sorted = to_sort;
+      batch_size *= 2;
+    }
+    HighsInt i = bfrt_position[en];
     HighsInt iCol = original_workData[i].first;
     double value = original_workData[i].second;
     double dual = workMove[iCol] * workDual[iCol];
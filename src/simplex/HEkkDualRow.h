@@ -187,6 +187,13 @@ class HEkkDualRow {
   std::vector<std::pair<HighsInt, double>> original_workData;
   std::vector<std::pair<HighsInt, double>> sorted_workData;
   std::vector<HighsInt> alt_workGroup;
+  // Ratios of the candidates in original_workData, and the positions of the
+  // breakpoints, ordered by chooseFinalWorkGroupHeap
+  std::vector<double> bfrt_ratio;
+  std::vector<HighsInt> bfrt_position;
+
+  // Number of smallest BFRT ratios that are sorted initially
+  static const HighsInt kBfrtSortBatchSize = 64;
 
   HighsSimplexAnalysis* analysis = NULL;
 };
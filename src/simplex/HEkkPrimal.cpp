@@ -647,11 +647,13 @@ void HEkkPrimal::rebuild() {
   info.updated_primal_objective_value = info.primal_objective_value;
 
   reportRebuild(reason_for_rebuild);
+  ekk_instance_.callbackOnRebuild(info.primal_objective_value);
 
   // Record the synthetic clock for INVERT, and zero it for UPDATE
   ekk_instance_.build_synthetic_tick_ =
       ekk_instance_.factor_.build_synthetic_tick;
   ekk_instance_.total_synthetic_tick_ = 0;
+  analysis->resetUpdateSolveCost();
 
   // Determine whether to use hyper-sparse CHUZC
   if (solve_phase == kSolvePhase1) {
@@ -828,13 +830,17 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
         }
       }
       // Now look at other columns
-      for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
-        double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
-        if (dual_infeasibility > dual_feasibility_tolerance) {
-          double measure = dual_infeasibility / devex_weight[iCol];
-          addToDecreasingHeap(
-              num_hyper_chuzc_candidates, max_num_hyper_chuzc_candidates,
-              hyper_chuzc_measure, hyper_chuzc_candidate, measure, iCol);
+      if (num_tot >= kMinParallelChuzcCount) {
+        hyperChooseColumnPartitioned();
+      } else {
+        for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
+          double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+          if (dual_infeasibility > dual_feasibility_tolerance) {
+            double measure = dual_infeasibility / devex_weight[iCol];
+            addToDecreasingHeap(
+                num_hyper_chuzc_candidates, max_num_hyper_chuzc_candidates,
+                hyper_chuzc_measure, hyper_chuzc_candidate, measure, iCol);
+          }
         }
       }
       // Sort the heap
@@ -874,12 +880,16 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
       }
     }
     // Now look at other columns
-    for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
-      double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
-      if (dual_infeasibility > dual_feasibility_tolerance &&
-          dual_infeasibility > best_measure * devex_weight[iCol]) {
-        variable_in = iCol;
-        best_measure = dual_infeasibility / devex_weight[iCol];
+    if (num_tot >= kMinParallelChuzcCount) {
+      chooseColumnPartitioned(best_measure);
+    } else {
+      for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
+        double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+        if (dual_infeasibility > dual_feasibility_tolerance &&
+            dual_infeasibility > best_measure * devex_weight[iCol]) {
+          variable_in = iCol;
+          best_measure = dual_infeasibility / devex_weight[iCol];
+        }
       }
     }
     analysis->simplexTimerStop(ChuzcPrimalClock);
@@ -889,6 +899,86 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
   //	 ekk_instance_.iteration_count_, variable_in, best_measure);
 }
 
+void HEkkPrimal::chooseColumnPartitioned(double& best_measure) {
+  // The columns are split into kSimplexNumPartition contiguous partitions.
+  // The best column of each partition is found in parallel, and the
+  // partition winners are then compared in order with the current best
+  // (from the nonbasic free columns), retaining the first column of maximum
+  // measure, as for the serial scan.
+  const int8_t* nonbasicMove = &ekk_instance_.basis_.nonbasicMove_[0];
+  const double* workDual = &ekk_instance_.info_.workDual_[0];
+  const double* weight = &devex_weight[0];
+  const double tolerance = dual_feasibility_tolerance;
+  const HighsInt numPart = kSimplexNumPartition;
+  double partMeasure[kSimplexNumPartition];
+  HighsInt partCol[kSimplexNumPartition];
+#pragma omp parallel for schedule(static, 1)
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    const HighsInt from = (num_tot * iPart) / numPart;
+    const HighsInt to = (num_tot * (iPart + 1)) / numPart;
+    double my_best_measure = 0;
+    HighsInt my_best_col = -1;
+    for (HighsInt iCol = from; iCol < to; iCol++) {
+      double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+      if (dual_infeasibility > tolerance &&
+          dual_infeasibility > my_best_measure * weight[iCol]) {
+        my_best_col = iCol;
+        my_best_measure = dual_infeasibility / weight[iCol];
+      }
+    }
+    partMeasure[iPart] = my_best_measure;
+    partCol[iPart] = my_best_col;
+  }
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    if (partCol[iPart] >= 0 && partMeasure[iPart] > best_measure) {
+      variable_in = partCol[iPart];
+      best_measure = partMeasure[iPart];
+    }
+  }
+}
+
+void HEkkPrimal::hyperChooseColumnPartitioned() {
+  // As in chooseColumnPartitioned, the columns are split into
+  // kSimplexNumPartition partitions. Each partition forms its own heap
+  // of the best candidates, and these are then added to the global heap
+  // in order of partition
+  const int8_t* nonbasicMove = &ekk_instance_.basis_.nonbasicMove_[0];
+  const double* workDual = &ekk_instance_.info_.workDual_[0];
+  const double* weight = &devex_weight[0];
+  const double tolerance = dual_feasibility_tolerance;
+  const HighsInt max_num_candidates = max_num_hyper_chuzc_candidates;
+  const HighsInt numPart = kSimplexNumPartition;
+  HighsInt partNumCandidates[kSimplexNumPartition];
+  vector<vector<double>> partMeasure(numPart);
+  vector<vector<HighsInt>> partCandidate(numPart);
+#pragma omp parallel for schedule(static, 1)
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    const HighsInt from = (num_tot * iPart) / numPart;
+    const HighsInt to = (num_tot * (iPart + 1)) / numPart;
+    vector<double>& heap_measure = partMeasure[iPart];
+    vector<HighsInt>& heap_candidate = partCandidate[iPart];
+    heap_measure.resize(max_num_candidates + 1);
+    heap_candidate.resize(max_num_candidates + 1);
+    HighsInt num_candidates = 0;
+    for (HighsInt iCol = from; iCol < to; iCol++) {
+      double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+      if (dual_infeasibility > tolerance) {
+        double measure = dual_infeasibility / weight[iCol];
+        addToDecreasingHeap(num_candidates, max_num_candidates, heap_measure,
+                            heap_candidate, measure, iCol);
+      }
+    }
+    partNumCandidates[iPart] = num_candidates;
+  }
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    for (HighsInt iEntry = 1; iEntry <= partNumCandidates[iPart]; iEntry++)
+      addToDecreasingHeap(
+          num_hyper_chuzc_candidates, max_num_hyper_chuzc_candidates,
+          hyper_chuzc_measure, hyper_chuzc_candidate,
+          partMeasure[iPart][iEntry], partCandidate[iPart][iEntry]);
+  }
+}
+
 bool HEkkPrimal::useVariableIn() {
   // rebuild_reason = kRebuildReasonPossiblySingularBasis is set if
   // numerical trouble is detected
@@ -1551,11 +1641,19 @@ void HEkkPrimal::updateDual() {
   //  ekk_instance_.basis_.nonbasicMove_;
   // Update the duals
   theta_dual = workDual[variable_in] / alpha_col;
-  for (HighsInt iEl = 0; iEl < row_ap.count; iEl++) {
+  // The entries of row_ap and row_ep update distinct duals, so long
+  // vectors are shared between threads
+  const HighsInt ap_count = row_ap.count;
+  const HighsInt ep_count = row_ep.count;
+#pragma omp parallel for schedule(static) \
+    if (ap_count >= kMinParallelUpdateCount)
+  for (HighsInt iEl = 0; iEl < ap_count; iEl++) {
     HighsInt iCol = row_ap.index[iEl];
     workDual[iCol] -= theta_dual * row_ap.array[iCol];
   }
-  for (HighsInt iEl = 0; iEl < row_ep.count; iEl++) {
+#pragma omp parallel for schedule(static) \
+    if (ep_count >= kMinParallelUpdateCount)
+  for (HighsInt iEl = 0; iEl < ep_count; iEl++) {
     HighsInt iRow = row_ep.index[iEl];
     HighsInt iCol = iRow + num_col;
     workDual[iCol] -= theta_dual * row_ep.array[iRow];
@@ -1732,8 +1830,6 @@ void HEkkPrimal::considerInfeasibleValueIn() {
 }
 
 void HEkkPrimal::phase2UpdatePrimal(const bool initialise) {
-  static double max_max_local_primal_infeasibility;
-  static double max_max_ignored_violation;
   if (initialise) {
     max_max_local_primal_infeasibility = 0;
     max_max_ignored_violation = 0;
@@ -1841,7 +1937,6 @@ void HEkkPrimal::phase2UpdatePrimal(const bool initialise) {
 bool HEkkPrimal::correctPrimal(const bool initialise) {
   if (primal_correction_strategy == kSimplexPrimalCorrectionStrategyNone)
     return true;
-  static double max_max_primal_correction;
   if (initialise) {
     max_max_primal_correction = 0;
     return true;
@@ -2076,16 +2171,38 @@ void HEkkPrimal::updateDevex() {
   HighsInt to_entry;
   const bool use_col_indices =
       ekk_instance_.sparseLoopStyle(col_aq.count, num_row, to_entry);
-  for (HighsInt iEntry = 0; iEntry < to_entry; iEntry++) {
-    HighsInt iRow;
-    if (use_col_indices) {
-      iRow = col_aq.index[iEntry];
-    } else {
-      iRow = iEntry;
+  const HighsInt* basicIndex = &ekk_instance_.basis_.basicIndex_[0];
+  if (to_entry >= kMinParallelUpdateCount) {
+    // Accumulate partial sums over kSimplexNumPartition partitions of the
+    // entries, and add them in order
+    const HighsInt numPart = kSimplexNumPartition;
+    double partWeight[kSimplexNumPartition];
+#pragma omp parallel for schedule(static, 1)
+    for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+      const HighsInt from = (to_entry * iPart) / numPart;
+      const HighsInt to = (to_entry * (iPart + 1)) / numPart;
+      double weight = 0.0;
+      for (HighsInt iEntry = from; iEntry < to; iEntry++) {
+        const HighsInt iRow = use_col_indices ? col_aq.index[iEntry] : iEntry;
+        double dAlpha = devex_index[basicIndex[iRow]] * col_aq.array[iRow];
+        weight += dAlpha * dAlpha;
+      }
+      partWeight[iPart] = weight;
+    }
+    for (HighsInt iPart = 0; iPart < numPart; iPart++)
+      dPivotWeight += partWeight[iPart];
+  } else {
+    for (HighsInt iEntry = 0; iEntry < to_entry; iEntry++) {
+      HighsInt iRow;
+      if (use_col_indices) {
+        iRow = col_aq.index[iEntry];
+      } else {
+        iRow = iEntry;
+      }
+      HighsInt iCol = basicIndex[iRow];
+      double dAlpha = devex_index[iCol] * col_aq.array[iRow];
+      dPivotWeight += dAlpha * dAlpha;
     }
-    HighsInt iCol = ekk_instance_.basis_.basicIndex_[iRow];
-    double dAlpha = devex_index[iCol] * col_aq.array[iRow];
-    dPivotWeight += dAlpha * dAlpha;
   }
   dPivotWeight += devex_index[variable_in] * 1.0;
   dPivotWeight = sqrt(dPivotWeight);
@@ -2098,7 +2215,13 @@ void HEkkPrimal::updateDevex() {
   double dPivot = col_aq.array[row_out];
   dPivotWeight /= fabs(dPivot);
 
-  for (HighsInt iEl = 0; iEl < row_ap.count; iEl++) {
+  // As in updateDual, the entries of row_ap and row_ep update distinct
+  // weights
+  const HighsInt ap_count = row_ap.count;
+  const HighsInt ep_count = row_ep.count;
+#pragma omp parallel for schedule(static) \
+    if (ap_count >= kMinParallelUpdateCount)
+  for (HighsInt iEl = 0; iEl < ap_count; iEl++) {
     HighsInt iCol = row_ap.index[iEl];
     double alpha = row_ap.array[iCol];
     double devex = dPivotWeight * fabs(alpha);
@@ -2107,7 +2230,9 @@ void HEkkPrimal::updateDevex() {
       devex_weight[iCol] = devex;
     }
   }
-  for (HighsInt iEl = 0; iEl < row_ep.count; iEl++) {
+#pragma omp parallel for schedule(static) \
+    if (ep_count >= kMinParallelUpdateCount)
+  for (HighsInt iEl = 0; iEl < ep_count; iEl++) {
     HighsInt iRow = row_ep.index[iEl];
     HighsInt iCol = iRow + num_col;
     double alpha = row_ep.array[iRow];
@@ -2201,7 +2326,6 @@ void HEkkPrimal::localReportIterHeader() {
 
 void HEkkPrimal::localReportIter(const bool header) {
   if (!report_hyper_chuzc) return;
-  static HighsInt last_header_iteration_count;
   const HighsSimplexInfo& info = ekk_instance_.info_;
   HighsInt iteration_count = ekk_instance_.iteration_count_;
   if (header) {
@@ -54,6 +54,8 @@ class HEkkPrimal {
   void iterate();
   void chuzc();
   void chooseColumn(const bool hyper_sparse = false);
+  void chooseColumnPartitioned(double& best_measure);
+  void hyperChooseColumnPartitioned();
   bool useVariableIn();
   void phase1ChooseRow();
   void chooseRow();
@@ -157,6 +159,12 @@ class HEkkPrimal {
   double max_changed_measure_value;
   HighsInt max_changed_measure_column;
   const bool report_hyper_chuzc = false;
+  // Largest values reported by phase2UpdatePrimal and correctPrimal,
+  // and the iteration of the last header from localReportIter
+  double max_max_local_primal_infeasibility = 0;
+  double max_max_ignored_violation = 0;
+  double max_max_primal_correction = 0;
+  HighsInt last_header_iteration_count = 0;
   // Solve buffer
   HVector row_ep;
   HVector row_ap;
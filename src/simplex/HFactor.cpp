@@ -15,8 +15,10 @@
  */
 #include "simplex/HFactor.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
 #include <iostream>
 
 #include "lp_data/HConst.h"
@@ -29,6 +31,7 @@ using std::copy;
 using std::fill_n;
 using std::make_pair;
 using std::pair;
+using std::sort;
 using std::vector;
 
 void solveMatrixT(const HighsInt Xstart, const HighsInt Xend,
@@ -58,10 +61,12 @@ void solveMatrixT(const HighsInt Xstart, const HighsInt Xend,
   }
 }
 
-void solveHyper(const HighsInt Hsize, const HighsInt* Hlookup,
+bool solveHyper(const HighsInt Hsize, const HighsInt* Hlookup,
                 const HighsInt* HpivotIndex, const double* HpivotValue,
                 const HighsInt* Hstart, const HighsInt* Hend,
-                const HighsInt* Hindex, const double* Hvalue, HVector* rhs) {
+                const HighsInt* Hindex, const double* Hvalue, HVector* rhs,
+                const HighsInt reach_limit = kHighsIInf,
+                const HighsInt pivot_order = 0) {
   HighsInt RHScount = rhs->count;
   HighsInt* RHSindex = &rhs->index[0];
   double* RHSarray = &rhs->array[0];
@@ -105,6 +110,18 @@ void solveHyper(const HighsInt Hsize, const HighsInt* Hlookup,
         }
       } else {
         listIndex[listCount++] = Hi;
+        if (listCount > reach_limit) {
+          // The reach is too large for the hyper-sparse solve to pay
+          // off, so clear the marks of the listed entries and of those
+          // on the stack, and leave the RHS to be solved otherwise
+          for (HighsInt iList = 0; iList < listCount; iList++)
+            listMark[listIndex[iList]] = 0;
+          for (HighsInt iStack = 0; iStack < nStack; iStack += 2)
+            listMark[listStack[iStack]] = 0;
+          if (pivot_order == 0)
+            rhs->synthetic_tick += countPivot * 20 + countEntry * 10;
+          return false;
+        }
         if (nStack == -1)  // Quit on empty stack
           break;
         Hk = listStack[nStack--];  // Back to last in stack
@@ -113,7 +130,19 @@ void solveHyper(const HighsInt Hsize, const HighsInt* Hlookup,
     }
   }
 
-  rhs->synthetic_tick += countPivot * 20 + countEntry * 10;
+  // The list is solved from its end. Rather than the order given by
+  // the DFS, it can be solved in increasing (pivot_order > 0) or
+  // decreasing (pivot_order < 0) order of pivots, so that the result
+  // is identical to that of a sparse solve in the same direction. The
+  // caller then accounts for the synthetic ticks of the sparse solve,
+  // so that reinversion is triggered as if it had been performed
+  if (pivot_order == 0) {
+    rhs->synthetic_tick += countPivot * 20 + countEntry * 10;
+  } else if (pivot_order > 0) {
+    std::sort(listIndex, listIndex + listCount, std::greater<HighsInt>());
+  } else if (pivot_order < 0) {
+    std::sort(listIndex, listIndex + listCount);
+  }
 
   // Solve with list
   if (HpivotValue == 0) {
@@ -153,6 +182,7 @@ void solveHyper(const HighsInt Hsize, const HighsInt* Hlookup,
     }
     rhs->count = RHScount;
   }
+  return true;
 }
 
 void HFactor::setup(HighsInt numCol_, HighsInt numRow_, const HighsInt* Astart_,
@@ -183,6 +213,11 @@ void HFactor::setup(HighsInt numCol_, HighsInt numRow_, const HighsInt* Astart_,
   log_options.log_dev_level = &std::get<2>(*log_data);
   use_original_HFactor_logic = use_original_HFactor_logic_;
   updateMethod = updateMethod_;
+  ftran_lower_reach = HyperReachRecord();
+  btran_lower_reach = HyperReachRecord();
+  ftran_upper_reach = HyperReachRecord();
+  btran_upper_reach = HyperReachRecord();
+  hyper_reach_solve_count = 0;
 
   // Allocate for working buffer
   iwork.reserve(numRow * 2);
@@ -267,6 +302,11 @@ void HFactor::setup(HighsInt numCol_, HighsInt numRow_, const HighsInt* Astart_,
   PFvalue.reserve(BlimitX * 4);
 }
 
+void HFactor::setLogCallback(const HighsLogOptions& log_options_) {
+  highsSetLogCallback(log_options, log_options_.printmsgcb,
+                      log_options_.logmsgcb, log_options_.msgcb_data);
+}
+
 HighsInt HFactor::build(HighsTimerClock* factor_timer_clock_pointer) {
   FactorTimer factor_timer;
   factor_timer.start(FactorInvert, factor_timer_clock_pointer);
@@ -324,19 +364,176 @@ void HFactor::btran(HVector& vector, double historical_density,
   factor_timer.stop(FactorBtran, factor_timer_clock_pointer);
 }
 
+void HFactor::ftran(vector<HVector>& rhs, double historical_density,
+                    HighsTimerClock* factor_timer_clock_pointer) const {
+  FactorTimer factor_timer;
+  factor_timer.start(FactorFtran, factor_timer_clock_pointer);
+  // Vectors that are very sparse, or for which ftranL would be
+  // hyper-sparse, are solved individually. The remainder are gathered
+  // into blocks, whose solves share the passes through the
+  // factors. Only the FT update is handled by the block solve.
+  const HighsInt num_rhs = rhs.size();
+  vector<HighsInt> block_rhs;
+  vector<HighsInt> single_rhs;
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    const double current_density = 1.0 * rhs[iRhs].count / numRow;
+    const bool hyper_sparse =
+        current_density <= kHyperReach ||
+        (current_density <= kHyperCancel && historical_density <= kHyperFtranL);
+    if (updateMethod == kUpdateMethodFt && !hyper_sparse) {
+      block_rhs.push_back(iRhs);
+    } else {
+      single_rhs.push_back(iRhs);
+    }
+  }
+  const HighsInt num_single = single_rhs.size();
+  const HighsInt num_block =
+      (block_rhs.size() + kBlockSolveWidth - 1) / kBlockSolveWidth;
+#pragma omp parallel for schedule(dynamic)
+  for (HighsInt iTask = 0; iTask < num_single + num_block; iTask++) {
+    if (iTask < num_single) {
+      HVector& vector = rhs[single_rhs[iTask]];
+      ftranL(vector, historical_density);
+      ftranU(vector, historical_density);
+    } else {
+      const HighsInt from_rhs = (iTask - num_single) * kBlockSolveWidth;
+      const HighsInt to_rhs =
+          min(from_rhs + kBlockSolveWidth, (HighsInt)block_rhs.size());
+      HVector* block[kBlockSolveWidth];
+      for (HighsInt iRhs = from_rhs; iRhs < to_rhs; iRhs++)
+        block[iRhs - from_rhs] = &rhs[block_rhs[iRhs]];
+      ftranBlock(block, to_rhs - from_rhs);
+    }
+  }
+  factor_timer.stop(FactorFtran, factor_timer_clock_pointer);
+}
+
+void HFactor::btran(vector<HVector>& rhs, double historical_density,
+                    HighsTimerClock* factor_timer_clock_pointer) const {
+  FactorTimer factor_timer;
+  factor_timer.start(FactorBtran, factor_timer_clock_pointer);
+  // As for FTRAN, but with the hyper-sparse test of btranU
+  const HighsInt num_rhs = rhs.size();
+  vector<HighsInt> block_rhs;
+  vector<HighsInt> single_rhs;
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    const double current_density = 1.0 * rhs[iRhs].count / numRow;
+    const bool hyper_sparse =
+        current_density <= kHyperReach ||
+        (current_density <= kHyperCancel && historical_density <= kHyperBtranU);
+    if (updateMethod == kUpdateMethodFt && !hyper_sparse) {
+      block_rhs.push_back(iRhs);
+    } else {
+      single_rhs.push_back(iRhs);
+    }
+  }
+  const HighsInt num_single = single_rhs.size();
+  const HighsInt num_block =
+      (block_rhs.size() + kBlockSolveWidth - 1) / kBlockSolveWidth;
+#pragma omp parallel for schedule(dynamic)
+  for (HighsInt iTask = 0; iTask < num_single + num_block; iTask++) {
+    if (iTask < num_single) {
+      HVector& vector = rhs[single_rhs[iTask]];
+      btranU(vector, historical_density);
+      btranL(vector, historical_density);
+    } else {
+      const HighsInt from_rhs = (iTask - num_single) * kBlockSolveWidth;
+      const HighsInt to_rhs =
+          min(from_rhs + kBlockSolveWidth, (HighsInt)block_rhs.size());
+      HVector* block[kBlockSolveWidth];
+      for (HighsInt iRhs = from_rhs; iRhs < to_rhs; iRhs++)
+        block[iRhs - from_rhs] = &rhs[block_rhs[iRhs]];
+      btranBlock(block, to_rhs - from_rhs);
+    }
+  }
+  factor_timer.stop(FactorBtran, factor_timer_clock_pointer);
+}
+
 void HFactor::update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint) {
   // Special case
   if (aq->next) {
     updateCFT(aq, ep, iRow);
+    compactU();
     return;
   }
 
-  if (updateMethod == kUpdateMethodFt) updateFT(aq, ep, *iRow);
+  if (updateMethod == kUpdateMethodFt) {
+    updateFT(aq, ep, *iRow);
+    compactU();
+  }
   if (updateMethod == kUpdateMethodPf) updatePF(aq, *iRow, hint);
   if (updateMethod == kUpdateMethodMpf) updateMPF(aq, ep, *iRow, hint);
   if (updateMethod == kUpdateMethodApf) updateAPF(aq, ep, *iRow);
 }
 
+void HFactor::compactU() {
+  // The FT updates leave U and UR with entries that are no longer
+  // used: those deleted from rows and columns, the rows and columns
+  // of replaced pivots, and rows of UR that have been moved to the
+  // end to make space. Once these make up more than half of U or UR,
+  // the storage is compacted in place. The order of the pivots and of
+  // the entries within each column and row is unchanged, so TRANs
+  // give identical results.
+  const HighsInt UpivotCount = UpivotIndex.size();
+  const HighsInt UcountX = Uindex.size();
+  if (UdeadX > update_min_dead_count && 2 * UdeadX > UcountX) {
+    // Columns are stored in the order of their pivots, so each can be
+    // moved down in turn
+    HighsInt put = 0;
+    for (HighsInt iLogic = 0; iLogic < UpivotCount; iLogic++) {
+      const HighsInt start = Ustart[iLogic];
+      const HighsInt end = UpivotIndex[iLogic] < 0 ? start : Ulastp[iLogic];
+      assert(start >= put);
+      copy(&Uindex[0] + start, &Uindex[0] + end, &Uindex[0] + put);
+      copy(&Uvalue[0] + start, &Uvalue[0] + end, &Uvalue[0] + put);
+      Ustart[iLogic] = put;
+      put += end - start;
+      Ulastp[iLogic] = put;
+    }
+    Uindex.resize(put);
+    Uvalue.resize(put);
+    UdeadX = 0;
+    update_compact_count++;
+  }
+  const HighsInt URcountX = URindex.size();
+  if (URdeadX > update_min_dead_count && 2 * URdeadX > URcountX) {
+    // Rows that have been moved are out of order, so sort the rows by
+    // their start. The row of a replaced pivot has been passed on to
+    // its replacement, so is ignored
+    vector<pair<HighsInt, HighsInt>> row_order;
+    for (HighsInt iLogic = 0; iLogic < UpivotCount; iLogic++) {
+      if (UpivotIndex[iLogic] < 0) {
+        URstart[iLogic] = 0;
+        URlastp[iLogic] = 0;
+        URspace[iLogic] = 0;
+      } else {
+        row_order.push_back(make_pair(URstart[iLogic], iLogic));
+      }
+    }
+    sort(row_order.begin(), row_order.end());
+    HighsInt put = 0;
+    for (const pair<HighsInt, HighsInt>& row : row_order) {
+      const HighsInt iLogic = row.second;
+      const HighsInt start = URstart[iLogic];
+      const HighsInt end = URlastp[iLogic];
+      assert(start >= put);
+      copy(&URindex[0] + start, &URindex[0] + end, &URindex[0] + put);
+      copy(&URvalue[0] + start, &URvalue[0] + end, &URvalue[0] + put);
+      URstart[iLogic] = put;
+      URlastp[iLogic] = put + end - start;
+      // Retain no more space at the end of the row than is given to
+      // a row when it is moved
+      const HighsInt row_count = end - start;
+      URspace[iLogic] = min(URspace[iLogic], (HighsInt)(row_count * 0.1) + 5);
+      put += row_count + URspace[iLogic];
+    }
+    URindex.resize(put);
+    URvalue.resize(put);
+    URdeadX = 0;
+    update_compact_count++;
+  }
+}
+
 bool HFactor::setPivotThreshold(const double new_pivot_threshold) {
   if (new_pivot_threshold < kMinPivotThreshold) return false;
   if (new_pivot_threshold > kMaxPivotThreshold) return false;
@@ -1025,6 +1222,9 @@ void HFactor::buildFinish() {
   // Re-factor merit
   UmeritX = numRow + (LcountX + UcountX) * 1.5;
   UtotalX = UcountX;
+  UdeadX = 0;
+  URdeadX = 0;
+  update_compact_count = 0;
   if (updateMethod == kUpdateMethodPf) UmeritX = numRow + UcountX * 4;
   if (updateMethod == kUpdateMethodMpf) UmeritX = numRow + UcountX * 3;
 
@@ -1057,7 +1257,25 @@ void HFactor::ftranL(HVector& rhs, double historical_density,
   }
 
   double current_density = 1.0 * rhs.count / numRow;
-  if (current_density > kHyperCancel || historical_density > kHyperFtranL) {
+  bool solved = false;
+  if (current_density <= kHyperCancel && historical_density <= kHyperFtranL) {
+    factor_timer.start(FactorFtranLowerHyper, factor_timer_clock_pointer);
+    const HighsInt* Lindex = this->Lindex.size() > 0 ? &this->Lindex[0] : NULL;
+    const double* Lvalue = this->Lvalue.size() > 0 ? &this->Lvalue[0] : NULL;
+    solved = solveHyper(numRow, &LpivotLookup[0], &LpivotIndex[0], 0,
+                        &Lstart[0], &Lstart[1], &Lindex[0], &Lvalue[0], &rhs);
+    factor_timer.stop(FactorFtranLowerHyper, factor_timer_clock_pointer);
+  } else if (attemptHyperReach(current_density, ftran_lower_reach)) {
+    factor_timer.start(FactorFtranLowerReach, factor_timer_clock_pointer);
+    const HighsInt* Lindex = this->Lindex.size() > 0 ? &this->Lindex[0] : NULL;
+    const double* Lvalue = this->Lvalue.size() > 0 ? &this->Lvalue[0] : NULL;
+    solved = solveHyper(numRow, &LpivotLookup[0], &LpivotIndex[0], 0,
+                        &Lstart[0], &Lstart[1], &Lindex[0], &Lvalue[0], &rhs,
+                        (HighsInt)(kHyperResult * numRow), 1);
+    recordHyperReach(solved, ftran_lower_reach);
+    factor_timer.stop(FactorFtranLowerReach, factor_timer_clock_pointer);
+  }
+  if (!solved) {
     factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt RHScount = 0;
@@ -1086,13 +1304,6 @@ void HFactor::ftranL(HVector& rhs, double historical_density,
     // Save the count
     rhs.count = RHScount;
     factor_timer.stop(FactorFtranLowerSps, factor_timer_clock_pointer);
-  } else {
-    factor_timer.start(FactorFtranLowerHyper, factor_timer_clock_pointer);
-    const HighsInt* Lindex = this->Lindex.size() > 0 ? &this->Lindex[0] : NULL;
-    const double* Lvalue = this->Lvalue.size() > 0 ? &this->Lvalue[0] : NULL;
-    solveHyper(numRow, &LpivotLookup[0], &LpivotIndex[0], 0, &Lstart[0],
-               &Lstart[1], &Lindex[0], &Lvalue[0], &rhs);
-    factor_timer.stop(FactorFtranLowerHyper, factor_timer_clock_pointer);
   }
   factor_timer.stop(FactorFtranLower, factor_timer_clock_pointer);
 }
@@ -1102,7 +1313,29 @@ void HFactor::btranL(HVector& rhs, double historical_density,
   FactorTimer factor_timer;
   factor_timer.start(FactorBtranLower, factor_timer_clock_pointer);
   double current_density = 1.0 * rhs.count / numRow;
-  if (current_density > kHyperCancel || historical_density > kHyperBtranL) {
+  bool solved = false;
+  if (current_density <= kHyperCancel && historical_density <= kHyperBtranL) {
+    factor_timer.start(FactorBtranLowerHyper, factor_timer_clock_pointer);
+    const HighsInt* LRindex =
+        this->LRindex.size() > 0 ? &this->LRindex[0] : NULL;
+    const double* LRvalue = this->LRvalue.size() > 0 ? &this->LRvalue[0] : NULL;
+    solved =
+        solveHyper(numRow, &LpivotLookup[0], &LpivotIndex[0], 0, &LRstart[0],
+                   &LRstart[1], &LRindex[0], &LRvalue[0], &rhs);
+    factor_timer.stop(FactorBtranLowerHyper, factor_timer_clock_pointer);
+  } else if (attemptHyperReach(current_density, btran_lower_reach)) {
+    factor_timer.start(FactorBtranLowerReach, factor_timer_clock_pointer);
+    const HighsInt* LRindex =
+        this->LRindex.size() > 0 ? &this->LRindex[0] : NULL;
+    const double* LRvalue = this->LRvalue.size() > 0 ? &this->LRvalue[0] : NULL;
+    solved =
+        solveHyper(numRow, &LpivotLookup[0], &LpivotIndex[0], 0, &LRstart[0],
+                   &LRstart[1], &LRindex[0], &LRvalue[0], &rhs,
+                   (HighsInt)(kHyperResult * numRow), -1);
+    recordHyperReach(solved, btran_lower_reach);
+    factor_timer.stop(FactorBtranLowerReach, factor_timer_clock_pointer);
+  }
+  if (!solved) {
     // Alias to RHS
     factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
     HighsInt RHScount = 0;
@@ -1133,14 +1366,6 @@ void HFactor::btranL(HVector& rhs, double historical_density,
     // Save the count
     rhs.count = RHScount;
     factor_timer.stop(FactorBtranLowerSps, factor_timer_clock_pointer);
-  } else {
-    factor_timer.start(FactorBtranLowerHyper, factor_timer_clock_pointer);
-    const HighsInt* LRindex =
-        this->LRindex.size() > 0 ? &this->LRindex[0] : NULL;
-    const double* LRvalue = this->LRvalue.size() > 0 ? &this->LRvalue[0] : NULL;
-    solveHyper(numRow, &LpivotLookup[0], &LpivotIndex[0], 0, &LRstart[0],
-               &LRstart[1], &LRindex[0], &LRvalue[0], &rhs);
-    factor_timer.stop(FactorBtranLowerHyper, factor_timer_clock_pointer);
   }
 
   if (updateMethod == kUpdateMethodApf) {
@@ -1176,7 +1401,42 @@ void HFactor::ftranU(HVector& rhs, double historical_density,
 
   // The regular part
   const double current_density = 1.0 * rhs.count / numRow;
-  if (current_density > kHyperCancel || historical_density > kHyperFtranU) {
+  bool solved = false;
+  if (current_density <= kHyperCancel && historical_density <= kHyperFtranU) {
+    HighsInt use_clock = -1;
+    if (current_density < 5e-6)
+      use_clock = FactorFtranUpperHyper5;
+    else if (current_density < 1e-5)
+      use_clock = FactorFtranUpperHyper4;
+    else if (current_density < 1e-4)
+      use_clock = FactorFtranUpperHyper3;
+    else if (current_density < 1e-3)
+      use_clock = FactorFtranUpperHyper2;
+    else if (current_density < 1e-2)
+      use_clock = FactorFtranUpperHyper1;
+    else
+      use_clock = FactorFtranUpperHyper0;
+    factor_timer.start(use_clock, factor_timer_clock_pointer);
+    const HighsInt* Uindex = this->Uindex.size() > 0 ? &this->Uindex[0] : NULL;
+    const double* Uvalue = this->Uvalue.size() > 0 ? &this->Uvalue[0] : NULL;
+    solved = solveHyper(numRow, &UpivotLookup[0], &UpivotIndex[0],
+                        &UpivotValue[0], &Ustart[0], &Ulastp[0], &Uindex[0],
+                        &Uvalue[0], &rhs);
+    factor_timer.stop(use_clock, factor_timer_clock_pointer);
+  } else if (attemptHyperReach(current_density, ftran_upper_reach)) {
+    factor_timer.start(FactorFtranUpperReach, factor_timer_clock_pointer);
+    const HighsInt* Uindex = this->Uindex.size() > 0 ? &this->Uindex[0] : NULL;
+    const double* Uvalue = this->Uvalue.size() > 0 ? &this->Uvalue[0] : NULL;
+    solved = solveHyper(numRow, &UpivotLookup[0], &UpivotIndex[0],
+                        &UpivotValue[0], &Ustart[0], &Ulastp[0], &Uindex[0],
+                        &Uvalue[0], &rhs, (HighsInt)(kHyperResult * numRow),
+                        -1);
+    if (solved)
+      rhs.synthetic_tick += sparseSolveUSyntheticTick(rhs, Ustart, Ulastp);
+    recordHyperReach(solved, ftran_upper_reach);
+    factor_timer.stop(FactorFtranUpperReach, factor_timer_clock_pointer);
+  }
+  if (!solved) {
     const bool report_ftran_upper_sparse =
         false;  // current_density < kHyperCancel;
     HighsInt use_clock;
@@ -1234,26 +1494,6 @@ void HFactor::ftranU(HVector& rhs, double historical_density,
           "%10.4g; final_density = %10.4g\n",
           historical_density, current_density, final_density);
     }
-  } else {
-    HighsInt use_clock = -1;
-    if (current_density < 5e-6)
-      use_clock = FactorFtranUpperHyper5;
-    else if (current_density < 1e-5)
-      use_clock = FactorFtranUpperHyper4;
-    else if (current_density < 1e-4)
-      use_clock = FactorFtranUpperHyper3;
-    else if (current_density < 1e-3)
-      use_clock = FactorFtranUpperHyper2;
-    else if (current_density < 1e-2)
-      use_clock = FactorFtranUpperHyper1;
-    else
-      use_clock = FactorFtranUpperHyper0;
-    factor_timer.start(use_clock, factor_timer_clock_pointer);
-    const HighsInt* Uindex = this->Uindex.size() > 0 ? &this->Uindex[0] : NULL;
-    const double* Uvalue = this->Uvalue.size() > 0 ? &this->Uvalue[0] : NULL;
-    solveHyper(numRow, &UpivotLookup[0], &UpivotIndex[0], &UpivotValue[0],
-               &Ustart[0], &Ulastp[0], &Uindex[0], &Uvalue[0], &rhs);
-    factor_timer.stop(use_clock, factor_timer_clock_pointer);
   }
   if (updateMethod == kUpdateMethodPf) {
     factor_timer.start(FactorFtranUpperPF, factor_timer_clock_pointer);
@@ -1277,7 +1517,25 @@ void HFactor::btranU(HVector& rhs, double historical_density,
 
   // The regular part
   double current_density = 1.0 * rhs.count / numRow;
-  if (current_density > kHyperCancel || historical_density > kHyperBtranU) {
+  bool solved = false;
+  if (current_density <= kHyperCancel && historical_density <= kHyperBtranU) {
+    factor_timer.start(FactorBtranUpperHyper, factor_timer_clock_pointer);
+    solved = solveHyper(numRow, &UpivotLookup[0], &UpivotIndex[0],
+                        &UpivotValue[0], &URstart[0], &URlastp[0],
+                        &URindex[0], &URvalue[0], &rhs);
+    factor_timer.stop(FactorBtranUpperHyper, factor_timer_clock_pointer);
+  } else if (attemptHyperReach(current_density, btran_upper_reach)) {
+    factor_timer.start(FactorBtranUpperReach, factor_timer_clock_pointer);
+    solved = solveHyper(numRow, &UpivotLookup[0], &UpivotIndex[0],
+                        &UpivotValue[0], &URstart[0], &URlastp[0],
+                        &URindex[0], &URvalue[0], &rhs,
+                        (HighsInt)(kHyperResult * numRow), 1);
+    if (solved)
+      rhs.synthetic_tick += sparseSolveUSyntheticTick(rhs, URstart, URlastp);
+    recordHyperReach(solved, btran_upper_reach);
+    factor_timer.stop(FactorBtranUpperReach, factor_timer_clock_pointer);
+  }
+  if (!solved) {
     factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
     // Alias to non constant
     double RHS_synthetic_tick = 0;
@@ -1319,11 +1577,6 @@ void HFactor::btranU(HVector& rhs, double historical_density,
     rhs.count = RHScount;
     rhs.synthetic_tick += RHS_synthetic_tick * 15 + (UpivotCount - numRow) * 10;
     factor_timer.stop(FactorBtranUpperSps, factor_timer_clock_pointer);
-  } else {
-    factor_timer.start(FactorBtranUpperHyper, factor_timer_clock_pointer);
-    solveHyper(numRow, &UpivotLookup[0], &UpivotIndex[0], &UpivotValue[0],
-               &URstart[0], &URlastp[0], &URindex[0], &URvalue[0], &rhs);
-    factor_timer.stop(FactorBtranUpperHyper, factor_timer_clock_pointer);
   }
 
   // The update part
@@ -1347,6 +1600,208 @@ void HFactor::btranU(HVector& rhs, double historical_density,
   factor_timer.stop(FactorBtranUpper, factor_timer_clock_pointer);
 }
 
+bool HFactor::attemptHyperReach(const double current_density,
+                                HyperReachRecord& record) const {
+  // The reach mode is attempted for a very sparse RHS unless it has
+  // rarely succeeded recently, in which case it is retried
+  // occasionally so that its rate of success can recover
+  if (!use_hyper_reach || current_density > kHyperReach) return false;
+  bool attempt;
+#pragma omp critical(HFactorHyperReach)
+  {
+    attempt = record.success_rate >= kHyperReachMinSuccessRate ||
+              ++record.num_skip >= kHyperReachRetryInterval;
+    if (attempt) record.num_skip = 0;
+  }
+  return attempt;
+}
+
+void HFactor::recordHyperReach(const bool solved,
+                               HyperReachRecord& record) const {
+#pragma omp critical(HFactorHyperReach)
+  {
+    record.success_rate =
+        (1 - kRunningAverageMultiplier) * record.success_rate +
+        kRunningAverageMultiplier * (solved ? 1 : 0);
+    if (solved) hyper_reach_solve_count++;
+  }
+}
+
+double HFactor::sparseSolveUSyntheticTick(const HVector& rhs,
+                                          const vector<HighsInt>& start,
+                                          const vector<HighsInt>& end) const {
+  // Synthetic ticks of a sparse solve with U, given its result, as
+  // accumulated by the sparse loops of ftranU and btranU
+  double RHS_synthetic_tick = 0;
+  for (HighsInt i = 0; i < rhs.count; i++) {
+    const HighsInt iLogic = UpivotLookup[rhs.index[i]];
+    if (iLogic >= numRow) RHS_synthetic_tick += end[iLogic] - start[iLogic];
+  }
+  const HighsInt UpivotCount = UpivotIndex.size();
+  return RHS_synthetic_tick * 15 + (UpivotCount - numRow) * 10;
+}
+
+// The values of a block of RHS vectors are held row-wise in a dense
+// work array, so that each entry of the factors is applied to all the
+// vectors in the block. Unused vectors in the block are zero
+static void loadBlock(HVector** rhs, const HighsInt num_rhs,
+                      vector<double>& work) {
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    const HVector& vector = *rhs[iRhs];
+    for (HighsInt k = 0; k < vector.count; k++) {
+      const HighsInt iRow = vector.index[k];
+      work[iRow * kBlockSolveWidth + iRhs] = vector.array[iRow];
+    }
+  }
+}
+
+static void saveBlock(const HighsInt numRow, const vector<double>& work,
+                      HVector** rhs, const HighsInt num_rhs) {
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) {
+    HVector& vector = *rhs[iRhs];
+    HighsInt count = 0;
+    for (HighsInt iRow = 0; iRow < numRow; iRow++) {
+      const double value = work[iRow * kBlockSolveWidth + iRhs];
+      vector.array[iRow] = value;
+      if (value) vector.index[count++] = iRow;
+    }
+    vector.count = count;
+  }
+}
+
+// Zero the tiny values for a pivot in the block, returning whether
+// any nonzeros remain
+static bool pivotBlockNonzero(double* pivotX) {
+  // Quick exit when all the values are zero
+  bool nonzero = false;
+  for (HighsInt iRhs = 0; iRhs < kBlockSolveWidth; iRhs++)
+    nonzero |= pivotX[iRhs] != 0;
+  if (!nonzero) return false;
+  nonzero = false;
+  for (HighsInt iRhs = 0; iRhs < kBlockSolveWidth; iRhs++) {
+    if (fabs(pivotX[iRhs]) > kHighsTiny) {
+      nonzero = true;
+    } else {
+      pivotX[iRhs] = 0;
+    }
+  }
+  return nonzero;
+}
+
+void HFactor::ftranBlock(HVector** rhs, const HighsInt num_rhs) const {
+  // Performs the same operations for each vector as the sparse loops
+  // of ftranL, ftranFT and ftranU
+  assert(num_rhs <= kBlockSolveWidth);
+  const HighsInt width = kBlockSolveWidth;
+  vector<double> work(numRow * width, 0);
+  loadBlock(rhs, num_rhs, work);
+
+  // Transform by L
+  for (HighsInt i = 0; i < numRow; i++) {
+    double* pivotX = &work[LpivotIndex[i] * width];
+    if (!pivotBlockNonzero(pivotX)) continue;
+    for (HighsInt k = Lstart[i]; k < Lstart[i + 1]; k++) {
+      double* x = &work[Lindex[k] * width];
+      const double value = Lvalue[k];
+      for (HighsInt iRhs = 0; iRhs < width; iRhs++)
+        x[iRhs] -= pivotX[iRhs] * value;
+    }
+  }
+
+  // Forwardly apply row ETA
+  const HighsInt PFpivotCount = PFpivotIndex.size();
+  for (HighsInt i = 0; i < PFpivotCount; i++) {
+    double* x = &work[PFpivotIndex[i] * width];
+    double value1[kBlockSolveWidth];
+    for (HighsInt iRhs = 0; iRhs < width; iRhs++) value1[iRhs] = x[iRhs];
+    for (HighsInt k = PFstart[i]; k < PFstart[i + 1]; k++) {
+      const double* y = &work[PFindex[k] * width];
+      const double value = PFvalue[k];
+      for (HighsInt iRhs = 0; iRhs < width; iRhs++)
+        value1[iRhs] -= y[iRhs] * value;
+    }
+    for (HighsInt iRhs = 0; iRhs < width; iRhs++) {
+      if (x[iRhs] || value1[iRhs])
+        x[iRhs] = (fabs(value1[iRhs]) < kHighsTiny) ? kHighsZero : value1[iRhs];
+    }
+  }
+
+  // Transform by U
+  const HighsInt UpivotCount = UpivotIndex.size();
+  for (HighsInt iLogic = UpivotCount - 1; iLogic >= 0; iLogic--) {
+    // Skip void
+    if (UpivotIndex[iLogic] == -1) continue;
+    double* pivotX = &work[UpivotIndex[iLogic] * width];
+    if (!pivotBlockNonzero(pivotX)) continue;
+    const double pivot = UpivotValue[iLogic];
+    for (HighsInt iRhs = 0; iRhs < width; iRhs++) pivotX[iRhs] /= pivot;
+    for (HighsInt k = Ustart[iLogic]; k < Ulastp[iLogic]; k++) {
+      double* x = &work[Uindex[k] * width];
+      const double value = Uvalue[k];
+      for (HighsInt iRhs = 0; iRhs < width; iRhs++)
+        x[iRhs] -= pivotX[iRhs] * value;
+    }
+  }
+  saveBlock(numRow, work, rhs, num_rhs);
+}
+
+void HFactor::btranBlock(HVector** rhs, const HighsInt num_rhs) const {
+  // Performs the same operations for each vector as the sparse loops
+  // of btranU, btranFT and btranL
+  assert(num_rhs <= kBlockSolveWidth);
+  const HighsInt width = kBlockSolveWidth;
+  vector<double> work(numRow * width, 0);
+  loadBlock(rhs, num_rhs, work);
+
+  // Transform by U
+  const HighsInt UpivotCount = UpivotIndex.size();
+  for (HighsInt iLogic = 0; iLogic < UpivotCount; iLogic++) {
+    // Skip void
+    if (UpivotIndex[iLogic] == -1) continue;
+    double* pivotX = &work[UpivotIndex[iLogic] * width];
+    if (!pivotBlockNonzero(pivotX)) continue;
+    const double pivot = UpivotValue[iLogic];
+    for (HighsInt iRhs = 0; iRhs < width; iRhs++) pivotX[iRhs] /= pivot;
+    for (HighsInt k = URstart[iLogic]; k < URlastp[iLogic]; k++) {
+      double* x = &work[URindex[k] * width];
+      const double value = URvalue[k];
+      for (HighsInt iRhs = 0; iRhs < width; iRhs++)
+        x[iRhs] -= pivotX[iRhs] * value;
+    }
+  }
+
+  // Backwardly apply row ETA
+  const HighsInt PFpivotCount = PFpivotIndex.size();
+  for (HighsInt i = PFpivotCount - 1; i >= 0; i--) {
+    const double* pivotX = &work[PFpivotIndex[i] * width];
+    for (HighsInt k = PFstart[i]; k < PFstart[i + 1]; k++) {
+      double* x = &work[PFindex[k] * width];
+      const double value = PFvalue[k];
+      for (HighsInt iRhs = 0; iRhs < width; iRhs++) {
+        if (!pivotX[iRhs]) continue;
+        const double value1 = x[iRhs] - pivotX[iRhs] * value;
+        x[iRhs] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+      }
+    }
+  }
+  // Zero the tiny values, as in the tight() after btranFT
+  for (HighsInt iEl = 0; iEl < numRow * width; iEl++)
+    if (fabs(work[iEl]) < kHighsTiny) work[iEl] = 0;
+
+  // Transform by L
+  for (HighsInt i = numRow - 1; i >= 0; i--) {
+    double* pivotX = &work[LpivotIndex[i] * width];
+    if (!pivotBlockNonzero(pivotX)) continue;
+    for (HighsInt k = LRstart[i]; k < LRstart[i + 1]; k++) {
+      double* x = &work[LRindex[k] * width];
+      const double value = LRvalue[k];
+      for (HighsInt iRhs = 0; iRhs < width; iRhs++)
+        x[iRhs] -= pivotX[iRhs] * value;
+    }
+  }
+  saveBlock(numRow, work, rhs, num_rhs);
+}
+
 void HFactor::ftranFT(HVector& vector) const {
   // Alias to PF buffer
   const HighsInt PFpivotCount = PFpivotIndex.size();
@@ -1727,9 +2182,13 @@ void HFactor::updateCFT(HVector* aq, HVector* ep, HighsInt* iRow
       Uindex[iFind] = Uindex[iLast];
       Uvalue[iFind] = Uvalue[iLast];
     }
+    UdeadX += URlastp[cLogic] - URstart[cLogic];
+    URdeadX += URlastp[cLogic] - URstart[cLogic];
 
     // 2. Delete pivotal column from UR
     UtotalX -= Ulastp[cLogic] - Ustart[cLogic];
+    UdeadX += Ulastp[cLogic] - Ustart[cLogic];
+    URdeadX += Ulastp[cLogic] - Ustart[cLogic];
     for (HighsInt k = Ustart[cLogic]; k < Ulastp[cLogic]; k++) {
       // Find the pivotal position
       HighsInt iLogic = UpivotLookup[Uindex[k]];
@@ -1772,6 +2231,7 @@ void HFactor::updateCFT(HVector* aq, HVector* ep, HighsInt* iRow
         copy(&URvalue[iFrom], &URvalue[iEnd], &URvalue[iTo]);
 
         // Save new pointers
+        URdeadX += row_count;
         URstart[iLogic] = new_start;
         URlastp[iLogic] = new_start + row_count;
         URspace[iLogic] = new_space - row_count;
@@ -1831,6 +2291,12 @@ void HFactor::updateFT(HVector* aq, HVector* ep, HighsInt iRow
     Uindex[iFind] = Uindex[iLast];
     Uvalue[iFind] = Uvalue[iLast];
   }
+  UdeadX += URlastp[pLogic] - URstart[pLogic];
+  UdeadX += Ulastp[pLogic] - Ustart[pLogic];
+  // The entries of the pivotal column become space in rows of UR, and
+  // those of the pivotal row become space for its replacement
+  URdeadX += URlastp[pLogic] - URstart[pLogic];
+  URdeadX += Ulastp[pLogic] - Ustart[pLogic];
 
   // Delete pivotal column from UR
   for (HighsInt k = Ustart[pLogic]; k < Ulastp[pLogic]; k++) {
@@ -1883,6 +2349,7 @@ void HFactor::updateFT(HVector* aq, HVector* ep, HighsInt iRow
       copy(&URvalue[iFrom], &URvalue[iEnd], &URvalue[iTo]);
 
       // Save new pointers
+      URdeadX += row_count;
       URstart[iLogic] = new_start;
       URlastp[iLogic] = new_start + row_count;
       URspace[iLogic] = new_space - row_count;
@@ -69,6 +69,25 @@ const double kHyperCancel = 0.05;
  * hyper-sparse - only for reporting
  */
 const double kHyperResult = 0.10;
+/**
+ * Threshold for RHS density below which a hyper-sparse TRAN is
+ * attempted even when the historical density is too high. It is
+ * abandoned in favour of the sparse TRAN if the reach of the RHS
+ * exceeds kHyperResult
+ */
+const double kHyperReach = 0.01;
+/**
+ * Running rate of success of the reach mode of a TRAN below which it
+ * is only attempted once in every kHyperReachRetryInterval TRANs, so
+ * that DFSs which are abandoned aren't repeated on every TRAN
+ */
+const double kHyperReachMinSuccessRate = 0.25;
+const HighsInt kHyperReachRetryInterval = 32;
+/**
+ * Number of RHS vectors whose solves share each pass through the
+ * factors in FTRAN and BTRAN for multiple RHS
+ */
+const HighsInt kBlockSolveWidth = 8;
 
 /**
  * Parameters for reinversion on synthetic clock
@@ -77,6 +96,12 @@ const double kMultiBuildSyntheticTickMu = 1.0;
 const double kNumericalTroubleTolerance = 1e-7;
 const double kMultiNumericalTroubleTolerance = 1e-7;
 
+/**
+ * Minimum number of unused entries in U or UR for the storage to be
+ * compacted after an FT update
+ */
+const HighsInt kUpdateMinDeadCount = 10000;
+
 const HighsInt kSyntheticTickReinversionMinUpdateCount = 50;
 const HighsInt kMultiSyntheticTickReinversionMinUpdateCount =
     kSyntheticTickReinversionMinUpdateCount;
@@ -143,6 +168,11 @@ class HFactor {
       const bool use_original_HFactor_logic = true,
       const HighsInt updateMethod = kUpdateMethodFt);
 
+  /**
+   * @brief Pass log messages to the callbacks of the given log options
+   */
+  void setLogCallback(const HighsLogOptions& log_options_);
+
   /**
    * @brief Form \f$PBQ=LU\f$ for basis matrix \f$B\f$ or report degree of rank
    * deficiency.
@@ -166,6 +196,24 @@ class HFactor {
              double historical_density,  //!< Historical density of the result
              HighsTimerClock* factor_timer_clock_pointer = NULL) const;
 
+  /**
+   * @brief Solve \f$B\mathbf{x}=\mathbf{b}\f$ (FTRAN) for multiple RHS
+   * vectors. Unless hyper-sparse solves are expected, blocks of
+   * kBlockSolveWidth vectors share each pass through the factors, and
+   * the blocks are solved in parallel
+   */
+  void ftran(vector<HVector>& rhs,       //!< RHS vectors \f$\mathbf{b}\f$
+             double historical_density,  //!< Historical density of the result
+             HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
+  /**
+   * @brief Solve \f$B^T\mathbf{x}=\mathbf{b}\f$ (BTRAN) for multiple RHS
+   * vectors, as for FTRAN
+   */
+  void btran(vector<HVector>& rhs,       //!< RHS vectors \f$\mathbf{b}\f$
+             double historical_density,  //!< Historical density of the result
+             HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
   /**
    * @brief Update according to
    * \f$B'=B+(\mathbf{a}_q-B\mathbf{e}_p)\mathbf{e}_p^T\f$
@@ -197,6 +245,29 @@ class HFactor {
    */
   double build_synthetic_tick;
 
+  /**
+   * @brief Minimum number of unused entries in U or UR for the
+   * storage to be compacted after an FT update
+   */
+  HighsInt update_min_dead_count = kUpdateMinDeadCount;
+
+  /**
+   * @brief Number of times that U or UR has been compacted since INVERT
+   */
+  HighsInt update_compact_count = 0;
+
+  /**
+   * @brief Whether very sparse RHS are solved using their reach when
+   * the historical density rules out a hyper-sparse TRAN
+   */
+  bool use_hyper_reach = true;
+
+  /**
+   * @brief Number of TRANs solved using the reach of the RHS since
+   * setup
+   */
+  mutable HighsInt hyper_reach_solve_count = 0;
+
   // Rank deficiency information
 
   /**
@@ -330,6 +401,9 @@ class HFactor {
 
   HighsInt UmeritX;
   HighsInt UtotalX;
+  // Numbers of entries in U and UR that are no longer used
+  HighsInt UdeadX;
+  HighsInt URdeadX;
   vector<HighsInt> Ustart;
   vector<HighsInt> Ulastp;
   vector<HighsInt> Uindex;
@@ -364,6 +438,28 @@ class HFactor {
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void btranU(HVector& vector, double historical_density,
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  // Running rate of success of the reach mode of a TRAN, and the
+  // number of TRANs since it was last attempted
+  struct HyperReachRecord {
+    double success_rate = 1;
+    HighsInt num_skip = 0;
+  };
+  // The reach mode records for FTRAN and BTRAN with L and U. They are
+  // updated by TRANs that may run in parallel, so only within critical
+  // sections
+  mutable HyperReachRecord ftran_lower_reach;
+  mutable HyperReachRecord btran_lower_reach;
+  mutable HyperReachRecord ftran_upper_reach;
+  mutable HyperReachRecord btran_upper_reach;
+  bool attemptHyperReach(const double current_density,
+                         HyperReachRecord& record) const;
+  void recordHyperReach(const bool solved, HyperReachRecord& record) const;
+  double sparseSolveUSyntheticTick(const HVector& rhs,
+                                   const vector<HighsInt>& start,
+                                   const vector<HighsInt>& end) const;
+
+  void ftranBlock(HVector** rhs, const HighsInt num_rhs) const;
+  void btranBlock(HVector** rhs, const HighsInt num_rhs) const;
 
   void ftranFT(HVector& vector) const;
   void btranFT(HVector& vector) const;
@@ -379,6 +475,7 @@ class HFactor {
   void updatePF(HVector* aq, HighsInt iRow, HighsInt* hint);
   void updateMPF(HVector* aq, HVector* ep, HighsInt iRow, HighsInt* hint);
   void updateAPF(HVector* aq, HVector* ep, HighsInt iRow);
+  void compactU();
 
   /**
    * Local in-line functions
@@ -22,6 +22,7 @@
 
 #include "lp_data/HConst.h"
 #include "simplex/HVector.h"
+#include "simplex/SimplexConst.h"
 
 using std::fabs;
 using std::max;
@@ -43,47 +44,71 @@ void HMatrix::setup(HighsInt numCol_, HighsInt numRow_, const HighsInt* Astart_,
   Aindex.assign(Aindex_, Aindex_ + AcountX);
   Avalue.assign(Avalue_, Avalue_ + AcountX);
 
-  // Build row copy - pointers
-  std::vector<HighsInt> AR_Bend;
-  ARstart.resize(numRow + 1);
-  AR_Nend.assign(numRow, 0);
-  AR_Bend.assign(numRow, 0);
+  // Build row copy. The columns are split into blocks that are
+  // transposed independently: each block counts its nonbasic and
+  // basic entries in each row, these counts are turned into the
+  // block's own insertion points, and the blocks are then filled. The
+  // entries of each row are stored in increasing column order, as
+  // they would be by a serial pass
+  std::vector<HighsInt> block_start;
+  const HighsInt num_block =
+      partitionColumnsByNonzeros(numCol, numRow, &Astart[0], block_start);
+  std::vector<HighsInt> block_N(num_block * numRow, 0);
+  std::vector<HighsInt> block_B(num_block * numRow, 0);
+
   // Count the nonzeros of nonbasic and basic columns in each row
-  for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-    if (nonbasicFlag_[iCol]) {
-      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        HighsInt iRow = Aindex[k];
-        AR_Nend[iRow]++;
-      }
-    } else {
-      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        HighsInt iRow = Aindex[k];
-        AR_Bend[iRow]++;
-      }
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    HighsInt* count_N = &block_N[iBlock * numRow];
+    HighsInt* count_B = &block_B[iBlock * numRow];
+    for (HighsInt iCol = block_start[iBlock]; iCol < block_start[iBlock + 1];
+         iCol++) {
+      HighsInt* count = nonbasicFlag_[iCol] ? count_N : count_B;
+      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++)
+        count[Aindex[k]]++;
     }
   }
+  ARstart.resize(numRow + 1);
+  AR_Nend.resize(numRow);
   ARstart[0] = 0;
-  for (HighsInt i = 0; i < numRow; i++)
-    ARstart[i + 1] = ARstart[i] + AR_Nend[i] + AR_Bend[i];
   for (HighsInt i = 0; i < numRow; i++) {
-    AR_Bend[i] = ARstart[i] + AR_Nend[i];
-    AR_Nend[i] = ARstart[i];
+    HighsInt row_count_N = 0;
+    HighsInt row_count_B = 0;
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+      row_count_N += block_N[iBlock * numRow + i];
+      row_count_B += block_B[iBlock * numRow + i];
+    }
+    AR_Nend[i] = row_count_N;
+    ARstart[i + 1] = ARstart[i] + row_count_N + row_count_B;
+  }
+  // Replace the counts by the first position of each block in the
+  // nonbasic and basic parts of each row
+#pragma omp parallel for schedule(static) if (num_block > 1)
+  for (HighsInt i = 0; i < numRow; i++) {
+    HighsInt put_N = ARstart[i];
+    HighsInt put_B = ARstart[i] + AR_Nend[i];
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+      const HighsInt count_N = block_N[iBlock * numRow + i];
+      const HighsInt count_B = block_B[iBlock * numRow + i];
+      block_N[iBlock * numRow + i] = put_N;
+      block_B[iBlock * numRow + i] = put_B;
+      put_N += count_N;
+      put_B += count_B;
+    }
+    AR_Nend[i] = put_N;
   }
   // Build row copy - elements
   ARindex.resize(AcountX);
   ARvalue.resize(AcountX);
-  for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-    if (nonbasicFlag_[iCol]) {
-      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        HighsInt iRow = Aindex[k];
-        HighsInt iPut = AR_Nend[iRow]++;
-        ARindex[iPut] = iCol;
-        ARvalue[iPut] = Avalue[k];
-      }
-    } else {
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    HighsInt* put_N = &block_N[iBlock * numRow];
+    HighsInt* put_B = &block_B[iBlock * numRow];
+    for (HighsInt iCol = block_start[iBlock]; iCol < block_start[iBlock + 1];
+         iCol++) {
+      HighsInt* put = nonbasicFlag_[iCol] ? put_N : put_B;
       for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        HighsInt iRow = Aindex[k];
-        HighsInt iPut = AR_Bend[iRow]++;
+        HighsInt iPut = put[Aindex[k]]++;
         ARindex[iPut] = iCol;
         ARvalue[iPut] = Avalue[k];
       }
@@ -189,7 +214,12 @@ void HMatrix::collect_aj(HVector& vector, HighsInt iCol,
   }
 }
 
-void HMatrix::priceByColumn(HVector& row_ap, const HVector& row_ep) const {
+void HMatrix::priceByColumn(HVector& row_ap, const HVector& row_ep,
+                            const bool allow_partition) const {
+  if (allow_partition && numCol >= kMinParallelPriceCount) {
+    priceByColumnPartitioned(row_ap, row_ep);
+    return;
+  }
   // Alias
   HighsInt ap_count = 0;
   HighsInt* ap_index = &row_ap.index[0];
@@ -209,6 +239,46 @@ void HMatrix::priceByColumn(HVector& row_ap, const HVector& row_ep) const {
   row_ap.count = ap_count;
 }
 
+void HMatrix::priceByColumnPartitioned(HVector& row_ap,
+                                       const HVector& row_ep) const {
+  // The columns are split into kSimplexNumPartition contiguous partitions.
+  // The nonzeros of each partition are indexed from the start of its range
+  // of columns, and the index lists are then moved together in order, so
+  // the result is identical to that of the serial loop.
+  const HighsInt numPart = kSimplexNumPartition;
+  HighsInt partCount[kSimplexNumPartition];
+  HighsInt* ap_index = &row_ap.index[0];
+  double* ap_array = &row_ap.array[0];
+  const double* ep_array = &row_ep.array[0];
+  const HighsInt* a_start = &Astart[0];
+  const HighsInt* a_index = &Aindex[0];
+  const double* a_value = &Avalue[0];
+#pragma omp parallel for schedule(static, 1)
+  for (HighsInt iPart = 0; iPart < numPart; iPart++) {
+    const HighsInt from = (numCol * iPart) / numPart;
+    const HighsInt to = (numCol * (iPart + 1)) / numPart;
+    HighsInt ap_count = from;
+    for (HighsInt iCol = from; iCol < to; iCol++) {
+      double value = 0;
+      for (HighsInt k = a_start[iCol]; k < a_start[iCol + 1]; k++) {
+        value += ep_array[a_index[k]] * a_value[k];
+      }
+      if (fabs(value) > kHighsTiny) {
+        ap_array[iCol] = value;
+        ap_index[ap_count++] = iCol;
+      }
+    }
+    partCount[iPart] = ap_count - from;
+  }
+  HighsInt ap_count = partCount[0];
+  for (HighsInt iPart = 1; iPart < numPart; iPart++) {
+    const HighsInt from = (numCol * iPart) / numPart;
+    for (HighsInt k = 0; k < partCount[iPart]; k++)
+      ap_index[ap_count++] = ap_index[from + k];
+  }
+  row_ap.count = ap_count;
+}
+
 void HMatrix::priceByRowSparseResult(HVector& row_ap,
                                      const HVector& row_ep) const {
   // Vanilla hyper-sparse row-wise PRICE
@@ -326,3 +396,27 @@ void HMatrix::priceByRowSparseResultRemoveCancellation(HVector& row_ap) const {
   }
   row_ap.count = ap_count;
 }
+
+HighsInt partitionColumnsByNonzeros(const HighsInt numCol,
+                                    const HighsInt numRow,
+                                    const HighsInt* Astart,
+                                    std::vector<HighsInt>& block_start) {
+  // Matrices with fewer nonzeros than this are handled as one block
+  const HighsInt kMinNonzerosForBlocks = 100000;
+  const HighsInt num_nz = Astart[numCol] - Astart[0];
+  HighsInt num_block = 1;
+  if (num_nz >= kMinNonzerosForBlocks)
+    num_block = std::min(kSimplexNumPartition,
+                         num_nz / std::max(numRow, (HighsInt)1));
+  num_block = std::max(std::min(num_block, numCol), (HighsInt)1);
+  block_start.resize(num_block + 1);
+  block_start[0] = 0;
+  for (HighsInt iBlock = 1; iBlock < num_block; iBlock++) {
+    const HighsInt target =
+        Astart[0] + (HighsInt)(((int64_t)iBlock * num_nz) / num_block);
+    block_start[iBlock] =
+        std::lower_bound(Astart, Astart + numCol, target) - Astart;
+  }
+  block_start[num_block] = numCol;
+  return num_block;
+}
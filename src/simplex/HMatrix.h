@@ -57,11 +57,14 @@ class HMatrix {
   );
   /**
    * @brief PRICE: Compute \f$ \mathbf{y}^T = \mathbf{x}^T A \f$
-   * column-wise, maintaining indices of nonzeros in the result
+   * column-wise, maintaining indices of nonzeros in the result. Long
+   * rows are formed in partitions shared between threads, unless
+   * PRICE is already running on its own thread
    */
   void priceByColumn(
-      HVector& row_ap,               //!< Vector \f$ \mathbf{y}\f$
-      const HVector& row_ep) const;  //!< Vector \f$ \mathbf{x}\f$
+      HVector& row_ap,                           //!< Vector \f$ \mathbf{y}\f$
+      const HVector& row_ep,                     //!< Vector \f$ \mathbf{x}\f$
+      const bool allow_partition = true) const;  //!< Whether to partition
   /**
    * @brief PRICE: Compute \f$ \mathbf{y}^T = \mathbf{x}^T N \f$
    * row-wise, maintaining indices of nonzeros in result
@@ -145,6 +148,8 @@ class HMatrix {
   const double hyperPRICE = 0.10;
 
  private:
+  void priceByColumnPartitioned(HVector& row_ap, const HVector& row_ep) const;
+
   HighsInt numCol;
   HighsInt numRow;
   std::vector<HighsInt> Astart;
@@ -157,4 +162,23 @@ class HMatrix {
   std::vector<double> ARvalue;
 };
 
+/**
+ * @brief Split the columns of a column-wise matrix into contiguous
+ * blocks holding similar numbers of nonzeros, so that passes over the
+ * matrix can be shared between threads. Small matrices form a single
+ * block, and others at most kSimplexNumPartition blocks.
+ *
+ * Passes that collect row data give each block its own row-length
+ * workspace, so the number of blocks is also limited to the mean
+ * number of nonzeros in a row.
+ *
+ * @return Number of blocks, with block_start of size num_block+1
+ */
+HighsInt partitionColumnsByNonzeros(
+    HighsInt numCol,                   //!< Number of columns in the matrix
+    HighsInt numRow,                   //!< Number of rows in the matrix
+    const HighsInt* Astart,            //!< Pointer to the column starts
+    std::vector<HighsInt>& block_start  //!< First column of each block
+);
+
 #endif /* SIMPLEX_HMATRIX_H_ */
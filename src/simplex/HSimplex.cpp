@@ -549,6 +549,57 @@ void initialiseScale(const HighsLp& lp, HighsScale& scale) {
   scale.cost = 1;
 }
 
+// The scaling passes over the matrix are shared between threads by
+// splitting its columns into blocks (see partitionColumnsByNonzeros),
+// each of which collects any row data in its own section of a
+// workspace of num_block * numRow values
+static void getMatrixValueRange(const HighsLp& lp,
+                                const vector<HighsInt>& block_start,
+                                double& min_value, double& max_value) {
+  const HighsInt num_block = block_start.size() - 1;
+  vector<double> block_min_value(num_block, kHighsInf);
+  vector<double> block_max_value(num_block, 0);
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    double block_min = kHighsInf;
+    double block_max = 0;
+    for (HighsInt k = lp.a_start_[block_start[iBlock]];
+         k < lp.a_start_[block_start[iBlock + 1]]; k++) {
+      double value = fabs(lp.a_value_[k]);
+      block_min = min(block_min, value);
+      block_max = max(block_max, value);
+    }
+    block_min_value[iBlock] = block_min;
+    block_max_value[iBlock] = block_max;
+  }
+  min_value = kHighsInf;
+  max_value = 0;
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    min_value = min(min_value, block_min_value[iBlock]);
+    max_value = max(max_value, block_max_value[iBlock]);
+  }
+}
+
+// Combine the row minima (or maxima) collected by each block into the
+// first numRow entries of the workspace, resetting the entries of the
+// other blocks to initial_value
+static void mergeBlockRowValues(const HighsInt num_block, const HighsInt numRow,
+                                vector<double>& row_value,
+                                const double initial_value,
+                                const bool take_max) {
+  if (num_block <= 1) return;
+#pragma omp parallel for schedule(static)
+  for (HighsInt iRow = 0; iRow < numRow; iRow++) {
+    double value = row_value[iRow];
+    for (HighsInt iBlock = 1; iBlock < num_block; iBlock++) {
+      double& block_value = row_value[iBlock * numRow + iRow];
+      value = take_max ? max(value, block_value) : min(value, block_value);
+      block_value = initial_value;
+    }
+    row_value[iRow] = value;
+  }
+}
+
 void scaleSimplexLp(const HighsOptions& options, HighsLp& lp,
                     HighsScale& scale) {
   initialiseScale(lp, scale);
@@ -558,8 +609,6 @@ void scaleSimplexLp(const HighsOptions& options, HighsLp& lp,
   assert(numCol > 0);
   double* colScale = &scale.col[0];
   double* rowScale = &scale.row[0];
-  HighsInt* Astart = &lp.a_start_[0];
-  double* Avalue = &lp.a_value_[0];
   double* colCost = &lp.col_cost_[0];
   double* colLower = &lp.col_lower_[0];
   double* colUpper = &lp.col_upper_[0];
@@ -573,13 +622,12 @@ void scaleSimplexLp(const HighsOptions& options, HighsLp& lp,
   // |values| are in [0.2, 5]
   const double no_scaling_original_matrix_min_value = 0.2;
   const double no_scaling_original_matrix_max_value = 5.0;
-  double original_matrix_min_value = kHighsInf;
-  double original_matrix_max_value = 0;
-  for (HighsInt k = 0, AnX = Astart[numCol]; k < AnX; k++) {
-    double value = fabs(Avalue[k]);
-    original_matrix_min_value = min(original_matrix_min_value, value);
-    original_matrix_max_value = max(original_matrix_max_value, value);
-  }
+  vector<HighsInt> block_start;
+  partitionColumnsByNonzeros(numCol, numRow, &lp.a_start_[0], block_start);
+  double original_matrix_min_value;
+  double original_matrix_max_value;
+  getMatrixValueRange(lp, block_start, original_matrix_min_value,
+                      original_matrix_max_value);
   bool no_scaling =
       (original_matrix_min_value >= no_scaling_original_matrix_min_value) &&
       (original_matrix_max_value <= no_scaling_original_matrix_max_value);
@@ -675,13 +723,14 @@ bool equilibrationScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
 
   HighsInt simplex_scale_strategy = options.simplex_scale_strategy;
 
-  double original_matrix_min_value = kHighsInf;
-  double original_matrix_max_value = 0;
-  for (HighsInt k = 0, AnX = Astart[numCol]; k < AnX; k++) {
-    double value = fabs(Avalue[k]);
-    original_matrix_min_value = min(original_matrix_min_value, value);
-    original_matrix_max_value = max(original_matrix_max_value, value);
-  }
+  vector<HighsInt> block_start;
+  const HighsInt num_block =
+      partitionColumnsByNonzeros(numCol, numRow, Astart, block_start);
+
+  double original_matrix_min_value;
+  double original_matrix_max_value;
+  getMatrixValueRange(lp, block_start, original_matrix_min_value,
+                      original_matrix_max_value);
 
   // Include cost in scaling if minimum nonzero cost is less than 0.1
   double min_nonzero_cost = kHighsInf;
@@ -707,36 +756,48 @@ bool equilibrationScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
   double max_allow_row_scale = max_allow_scale;
 
   // Search up to 6 times
-  vector<double> row_min_value(numRow, finite_infinity);
-  vector<double> row_max_value(numRow, 1 / finite_infinity);
+  const double initial_row_min_value = finite_infinity;
+  const double initial_row_max_value = 1 / finite_infinity;
+  vector<double> row_min_value(num_block * numRow, initial_row_min_value);
+  vector<double> row_max_value(num_block * numRow, initial_row_max_value);
   for (HighsInt search_count = 0; search_count < 6; search_count++) {
     // Find column scale, prepare row data
-    for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-      // For column scale (find)
-      double col_min_value = finite_infinity;
-      double col_max_value = 1 / finite_infinity;
-      double abs_col_cost = fabs(colCost[iCol]);
-      if (include_cost_in_scaling && abs_col_cost != 0) {
-        col_min_value = min(col_min_value, abs_col_cost);
-        col_max_value = max(col_max_value, abs_col_cost);
-      }
-      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        double value = fabs(Avalue[k]) * rowScale[Aindex[k]];
-        col_min_value = min(col_min_value, value);
-        col_max_value = max(col_max_value, value);
-      }
-      double col_equilibration = 1 / sqrt(col_min_value * col_max_value);
-      // Ensure that column scale factor is not excessively large or small
-      colScale[iCol] =
-          min(max(min_allow_col_scale, col_equilibration), max_allow_col_scale);
-      // For row scale (only collect)
-      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        HighsInt iRow = Aindex[k];
-        double value = fabs(Avalue[k]) * colScale[iCol];
-        row_min_value[iRow] = min(row_min_value[iRow], value);
-        row_max_value[iRow] = max(row_max_value[iRow], value);
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+      double* block_row_min_value = &row_min_value[iBlock * numRow];
+      double* block_row_max_value = &row_max_value[iBlock * numRow];
+      for (HighsInt iCol = block_start[iBlock]; iCol < block_start[iBlock + 1];
+           iCol++) {
+        // For column scale (find)
+        double col_min_value = finite_infinity;
+        double col_max_value = 1 / finite_infinity;
+        double abs_col_cost = fabs(colCost[iCol]);
+        if (include_cost_in_scaling && abs_col_cost != 0) {
+          col_min_value = min(col_min_value, abs_col_cost);
+          col_max_value = max(col_max_value, abs_col_cost);
+        }
+        for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
+          double value = fabs(Avalue[k]) * rowScale[Aindex[k]];
+          col_min_value = min(col_min_value, value);
+          col_max_value = max(col_max_value, value);
+        }
+        double col_equilibration = 1 / sqrt(col_min_value * col_max_value);
+        // Ensure that column scale factor is not excessively large or small
+        colScale[iCol] = min(max(min_allow_col_scale, col_equilibration),
+                             max_allow_col_scale);
+        // For row scale (only collect)
+        for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
+          HighsInt iRow = Aindex[k];
+          double value = fabs(Avalue[k]) * colScale[iCol];
+          block_row_min_value[iRow] = min(block_row_min_value[iRow], value);
+          block_row_max_value[iRow] = max(block_row_max_value[iRow], value);
+        }
       }
     }
+    mergeBlockRowValues(num_block, numRow, row_min_value,
+                        initial_row_min_value, false);
+    mergeBlockRowValues(num_block, numRow, row_max_value,
+                        initial_row_max_value, true);
     // For row scale (find)
     for (HighsInt iRow = 0; iRow < numRow; iRow++) {
       double row_equilibration =
@@ -744,9 +805,9 @@ bool equilibrationScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
       // Ensure that row scale factor is not excessively large or small
       rowScale[iRow] =
           min(max(min_allow_row_scale, row_equilibration), max_allow_row_scale);
+      row_min_value[iRow] = initial_row_min_value;
+      row_max_value[iRow] = initial_row_max_value;
     }
-    row_min_value.assign(numRow, finite_infinity);
-    row_max_value.assign(numRow, 1 / finite_infinity);
   }
   // Make it numerically better
   // Also determine the max and min row and column scaling factors
@@ -780,45 +841,95 @@ bool equilibrationScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
   double min_row_equilibration = finite_infinity;
   double sum_log_row_equilibration = 0;
   double max_row_equilibration = 0;
-  vector<double> original_row_min_value(numRow, finite_infinity);
-  vector<double> original_row_max_value(numRow, 1 / finite_infinity);
-  row_min_value.assign(numRow, finite_infinity);
-  row_max_value.assign(numRow, 1 / finite_infinity);
-  for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-    double original_col_min_value = finite_infinity;
-    double original_col_max_value = 1 / finite_infinity;
-    double col_min_value = finite_infinity;
-    double col_max_value = 1 / finite_infinity;
-    for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-      HighsInt iRow = Aindex[k];
-      const double original_value = fabs(Avalue[k]);
-      original_col_min_value = min(original_value, original_col_min_value);
-      original_col_max_value = max(original_value, original_col_max_value);
-      original_row_min_value[iRow] =
-          min(original_row_min_value[iRow], original_value);
-      original_row_max_value[iRow] =
-          max(original_row_max_value[iRow], original_value);
-      Avalue[k] *= (colScale[iCol] * rowScale[iRow]);
-      const double value = fabs(Avalue[k]);
-      col_min_value = min(value, col_min_value);
-      col_max_value = max(value, col_max_value);
-      row_min_value[iRow] = min(row_min_value[iRow], value);
-      row_max_value[iRow] = max(row_max_value[iRow], value);
-    }
-    matrix_min_value = min(matrix_min_value, col_min_value);
-    matrix_max_value = max(matrix_max_value, col_max_value);
+  // Statistics of the column equilibration for each block of columns
+  // are combined in block order
+  vector<double> block_min_value(num_block, finite_infinity);
+  vector<double> block_max_value(num_block, 0);
+  vector<double> block_min_col_equilibration(num_block, finite_infinity);
+  vector<double> block_sum_log_col_equilibration(num_block, 0);
+  vector<double> block_max_col_equilibration(num_block, 0);
+  // Collect the original row and column equilibration, then apply
+  // the scaling to the matrix and collect the final row and column
+  // equilibration, so that each pass only needs the row workspace for
+  // the min and max values
+  vector<double> original_row_min_value;
+  vector<double> original_row_max_value;
+  for (HighsInt pass = 0; pass < 2; pass++) {
+    const bool apply_scaling = pass == 1;
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+      double* block_row_min_value = &row_min_value[iBlock * numRow];
+      double* block_row_max_value = &row_max_value[iBlock * numRow];
+      double min_value = finite_infinity;
+      double max_value = 0;
+      double min_equilibration = finite_infinity;
+      double sum_log_equilibration = 0;
+      double max_equilibration = 0;
+      for (HighsInt iCol = block_start[iBlock]; iCol < block_start[iBlock + 1];
+           iCol++) {
+        double col_min_value = finite_infinity;
+        double col_max_value = 1 / finite_infinity;
+        for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
+          HighsInt iRow = Aindex[k];
+          if (apply_scaling) Avalue[k] *= (colScale[iCol] * rowScale[iRow]);
+          const double value = fabs(Avalue[k]);
+          col_min_value = min(value, col_min_value);
+          col_max_value = max(value, col_max_value);
+          block_row_min_value[iRow] = min(block_row_min_value[iRow], value);
+          block_row_max_value[iRow] = max(block_row_max_value[iRow], value);
+        }
+        min_value = min(min_value, col_min_value);
+        max_value = max(max_value, col_max_value);
 
-    const double original_col_equilibration =
-        1 / sqrt(original_col_min_value * original_col_max_value);
-    min_original_col_equilibration =
-        min(original_col_equilibration, min_original_col_equilibration);
-    sum_original_log_col_equilibration += log(original_col_equilibration);
-    max_original_col_equilibration =
-        max(original_col_equilibration, max_original_col_equilibration);
-    const double col_equilibration = 1 / sqrt(col_min_value * col_max_value);
-    min_col_equilibration = min(col_equilibration, min_col_equilibration);
-    sum_log_col_equilibration += log(col_equilibration);
-    max_col_equilibration = max(col_equilibration, max_col_equilibration);
+        const double col_equilibration =
+            1 / sqrt(col_min_value * col_max_value);
+        min_equilibration = min(col_equilibration, min_equilibration);
+        sum_log_equilibration += log(col_equilibration);
+        max_equilibration = max(col_equilibration, max_equilibration);
+      }
+      block_min_value[iBlock] = min_value;
+      block_max_value[iBlock] = max_value;
+      block_min_col_equilibration[iBlock] = min_equilibration;
+      block_sum_log_col_equilibration[iBlock] = sum_log_equilibration;
+      block_max_col_equilibration[iBlock] = max_equilibration;
+    }
+    mergeBlockRowValues(num_block, numRow, row_min_value,
+                        initial_row_min_value, false);
+    mergeBlockRowValues(num_block, numRow, row_max_value,
+                        initial_row_max_value, true);
+    double min_equilibration = finite_infinity;
+    double sum_log_equilibration = 0;
+    double max_equilibration = 0;
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+      min_equilibration =
+          min(block_min_col_equilibration[iBlock], min_equilibration);
+      sum_log_equilibration += block_sum_log_col_equilibration[iBlock];
+      max_equilibration =
+          max(block_max_col_equilibration[iBlock], max_equilibration);
+    }
+    if (apply_scaling) {
+      for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+        matrix_min_value = min(matrix_min_value, block_min_value[iBlock]);
+        matrix_max_value = max(matrix_max_value, block_max_value[iBlock]);
+      }
+      min_col_equilibration = min_equilibration;
+      sum_log_col_equilibration = sum_log_equilibration;
+      max_col_equilibration = max_equilibration;
+    } else {
+      min_original_col_equilibration = min_equilibration;
+      sum_original_log_col_equilibration = sum_log_equilibration;
+      max_original_col_equilibration = max_equilibration;
+      // Keep the original row values and reset the workspace for the
+      // final row values
+      original_row_min_value.assign(row_min_value.begin(),
+                                    row_min_value.begin() + numRow);
+      original_row_max_value.assign(row_max_value.begin(),
+                                    row_max_value.begin() + numRow);
+      std::fill(row_min_value.begin(), row_min_value.begin() + numRow,
+                initial_row_min_value);
+      std::fill(row_max_value.begin(), row_max_value.begin() + numRow,
+                initial_row_max_value);
+    }
   }
 
   for (HighsInt iRow = 0; iRow < numRow; iRow++) {
@@ -932,10 +1043,14 @@ bool equilibrationScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
   // Possibly abandon scaling if it's not improved equlibration significantly
   if (possibly_abandon_scaling && poor_improvement) {
     // Unscale the matrix
-    for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-      for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        HighsInt iRow = Aindex[k];
-        Avalue[k] /= (colScale[iCol] * rowScale[iRow]);
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+      for (HighsInt iCol = block_start[iBlock]; iCol < block_start[iBlock + 1];
+           iCol++) {
+        for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
+          HighsInt iRow = Aindex[k];
+          Avalue[k] /= (colScale[iCol] * rowScale[iRow]);
+        }
       }
     }
     if (options.highs_debug_level)
@@ -1007,15 +1122,34 @@ bool maxValueScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
   double original_matrix_max_value = 0;
   // Determine the row scaling. Also determine the max/min row scaling
   // factors, and max/min original matrix values
-  vector<double> row_max_value(numRow, 0);
-  for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-    for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
+  vector<HighsInt> block_start;
+  const HighsInt num_block =
+      partitionColumnsByNonzeros(numCol, numRow, &Astart[0], block_start);
+  vector<double> block_min_value(num_block, kHighsInf);
+  vector<double> block_max_value(num_block, 0);
+  vector<double> row_max_value(num_block * numRow, 0);
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    double* block_row_max_value = &row_max_value[iBlock * numRow];
+    double min_value = kHighsInf;
+    double max_value = 0;
+    for (HighsInt k = Astart[block_start[iBlock]];
+         k < Astart[block_start[iBlock + 1]]; k++) {
       const HighsInt iRow = Aindex[k];
       const double value = fabs(Avalue[k]);
-      row_max_value[iRow] = max(row_max_value[iRow], value);
-      original_matrix_min_value = min(original_matrix_min_value, value);
-      original_matrix_max_value = max(original_matrix_max_value, value);
+      block_row_max_value[iRow] = max(block_row_max_value[iRow], value);
+      min_value = min(min_value, value);
+      max_value = max(max_value, value);
     }
+    block_min_value[iBlock] = min_value;
+    block_max_value[iBlock] = max_value;
+  }
+  mergeBlockRowValues(num_block, numRow, row_max_value, 0, true);
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    original_matrix_min_value =
+        min(original_matrix_min_value, block_min_value[iBlock]);
+    original_matrix_max_value =
+        max(original_matrix_max_value, block_max_value[iBlock]);
   }
   for (HighsInt iRow = 0; iRow < numRow; iRow++) {
     if (row_max_value[iRow]) {
@@ -1037,31 +1171,51 @@ bool maxValueScaleSimplexMatrix(const HighsOptions& options, HighsLp& lp,
   double max_col_scale = 0;
   double matrix_min_value = kHighsInf;
   double matrix_max_value = 0;
-  for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-    double col_max_value = 0;
-    for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-      const HighsInt iRow = Aindex[k];
-      Avalue[k] *= rowScale[iRow];
-      const double value = fabs(Avalue[k]);
-      col_max_value = max(col_max_value, value);
-    }
-    if (col_max_value) {
-      double col_scale_value = 1 / col_max_value;
-      // Convert the col scale factor to the nearest power of two, and
-      // ensure that it is not excessively large or small
-      col_scale_value = pow(2.0, floor(log(col_scale_value) / log2 + 0.5));
-      col_scale_value =
-          min(max(min_allow_col_scale, col_scale_value), max_allow_col_scale);
-      min_col_scale = min(col_scale_value, min_col_scale);
-      max_col_scale = max(col_scale_value, max_col_scale);
-      colScale[iCol] = col_scale_value;
+  vector<double> block_min_col_scale(num_block);
+  vector<double> block_max_col_scale(num_block);
+#pragma omp parallel for schedule(dynamic, 1) if (num_block > 1)
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    double min_scale = kHighsInf;
+    double max_scale = 0;
+    double min_value = kHighsInf;
+    double max_value = 0;
+    for (HighsInt iCol = block_start[iBlock]; iCol < block_start[iBlock + 1];
+         iCol++) {
+      double col_max_value = 0;
       for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
-        Avalue[k] *= colScale[iCol];
+        const HighsInt iRow = Aindex[k];
+        Avalue[k] *= rowScale[iRow];
         const double value = fabs(Avalue[k]);
-        matrix_min_value = min(matrix_min_value, value);
-        matrix_max_value = max(matrix_max_value, value);
+        col_max_value = max(col_max_value, value);
+      }
+      if (col_max_value) {
+        double col_scale_value = 1 / col_max_value;
+        // Convert the col scale factor to the nearest power of two, and
+        // ensure that it is not excessively large or small
+        col_scale_value = pow(2.0, floor(log(col_scale_value) / log2 + 0.5));
+        col_scale_value =
+            min(max(min_allow_col_scale, col_scale_value), max_allow_col_scale);
+        min_scale = min(col_scale_value, min_scale);
+        max_scale = max(col_scale_value, max_scale);
+        colScale[iCol] = col_scale_value;
+        for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
+          Avalue[k] *= colScale[iCol];
+          const double value = fabs(Avalue[k]);
+          min_value = min(min_value, value);
+          max_value = max(max_value, value);
+        }
       }
     }
+    block_min_col_scale[iBlock] = min_scale;
+    block_max_col_scale[iBlock] = max_scale;
+    block_min_value[iBlock] = min_value;
+    block_max_value[iBlock] = max_value;
+  }
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    min_col_scale = min(block_min_col_scale[iBlock], min_col_scale);
+    max_col_scale = max(block_max_col_scale[iBlock], max_col_scale);
+    matrix_min_value = min(matrix_min_value, block_min_value[iBlock]);
+    matrix_max_value = max(matrix_max_value, block_max_value[iBlock]);
   }
   const double matrix_value_ratio = matrix_max_value / matrix_min_value;
   const double original_matrix_value_ratio =
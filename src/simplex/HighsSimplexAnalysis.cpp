@@ -509,6 +509,45 @@ bool HighsSimplexAnalysis::switchToDevex() {
   return switch_to_devex;
 }
 
+void HighsSimplexAnalysis::resetUpdateSolveCost() {
+  num_update_solve_cost = 0;
+  previous_total_synthetic_tick = 0;
+  average_update_solve_cost = 0;
+}
+
+void HighsSimplexAnalysis::recordUpdateSolveCost(
+    const double total_synthetic_tick) {
+  // The synthetic cost of the solves in this iteration is the
+  // increase in the synthetic clock since the previous update
+  const double update_solve_cost =
+      max(total_synthetic_tick - previous_total_synthetic_tick, 0.0);
+  previous_total_synthetic_tick = total_synthetic_tick;
+  if (num_update_solve_cost) {
+    average_update_solve_cost =
+        (1 - kRunningAverageMultiplier) * average_update_solve_cost +
+        kRunningAverageMultiplier * update_solve_cost;
+  } else {
+    average_update_solve_cost = update_solve_cost;
+  }
+  num_update_solve_cost++;
+}
+
+bool HighsSimplexAnalysis::solveCostGrowthSaysInvert(
+    const double build_synthetic_tick, const double total_synthetic_tick,
+    const HighsInt update_count) const {
+  // The average cost per iteration of INVERT and the solves since
+  // then is minimised when the current cost of the solves reaches
+  // it. That is, when
+  //
+  // update_count * current_cost >= build_cost + total_cost
+  //
+  // Any solve cost that does not depend on the number of updates
+  // cancels, so this measures the growth in solve cost
+  if (num_update_solve_cost == 0) return false;
+  return update_count * average_update_solve_cost - total_synthetic_tick >=
+         build_synthetic_tick;
+}
+
 bool HighsSimplexAnalysis::predictEndDensity(const HighsInt tran_stage_type,
                                              const double start_density,
                                              double& end_density) {
@@ -170,6 +170,11 @@ class HighsSimplexAnalysis {
   void dualSteepestEdgeWeightError(const double computed_edge_weight,
                                    const double updated_edge_weight);
   bool switchToDevex();
+  void resetUpdateSolveCost();
+  void recordUpdateSolveCost(const double total_synthetic_tick);
+  bool solveCostGrowthSaysInvert(const double build_synthetic_tick,
+                                 const double total_synthetic_tick,
+                                 const HighsInt update_count) const;
 
   std::vector<HighsTimerClock> thread_simplex_clocks;
   std::vector<HighsTimerClock> thread_factor_clocks;
@@ -205,6 +210,12 @@ class HighsSimplexAnalysis {
   bool allow_dual_steepest_edge_to_devex_switch;
   double dual_steepest_edge_weight_log_error_threshold;
 
+  // Synthetic cost of solves since INVERT, used by the adaptive
+  // reinversion strategy
+  HighsInt num_update_solve_cost = 0;
+  double previous_total_synthetic_tick = 0;
+  double average_update_solve_cost = 0;
+
   // Local copies of simplex data for reporting
   HighsInt simplex_strategy = 0;
   DualEdgeWeightMode edge_weight_mode = DualEdgeWeightMode::kSteepestEdge;
@@ -96,6 +96,13 @@ enum SimplexPriceStrategy {
   kSimplexPriceStrategyMax = kSimplexPriceStrategyRowSwitchColSwitch
 };
 
+enum SimplexReinversionStrategy {
+  kSimplexReinversionStrategyMin = 0,
+  kSimplexReinversionStrategySyntheticClock = kSimplexReinversionStrategyMin,
+  kSimplexReinversionStrategyAdaptive,
+  kSimplexReinversionStrategyMax = kSimplexReinversionStrategyAdaptive
+};
+
 enum SimplexPrimalCorrectionStrategy {
   kSimplexPrimalCorrectionStrategyNone = 0,
   kSimplexPrimalCorrectionStrategyInRebuild,
@@ -139,6 +146,26 @@ const HighsInt kIllegalMoveValue =
 // Threshold for accepting updated DSE weight
 const double kAcceptDseWeightThreshold = 0.25;
 
+// Number of partitions into which the parallel simplex loops split their
+// work. It is fixed, rather than set by the number of threads, so that the
+// candidates chosen and the sums accumulated by partition are the same for
+// any number of threads, and results are reproducible
+const HighsInt kSimplexNumPartition = 16;
+
+// Number of CHUZR candidates above which they are scanned in partitions
+const HighsInt kMinParallelChuzrCount = 50000;
+// Number of entries in the dual row above which it is packed, and its
+// candidates for BFRT are found in partitions, by several threads
+const HighsInt kMinParallelPackCount = 100000;
+// Number of columns above which column-wise PRICE is performed in
+// partitions
+const HighsInt kMinParallelPriceCount = 20000;
+// Number of variables above which primal CHUZC scans them in partitions,
+// and number of entries above which the primal dual and devex weight
+// updates are shared between threads
+const HighsInt kMinParallelChuzcCount = 50000;
+const HighsInt kMinParallelUpdateCount = 20000;
+
 //
 // Relation between HiGHS basis and Simplex basis
 //
@@ -137,6 +137,7 @@ struct HighsSimplexInfo {
   HighsInt dual_edge_weight_strategy;
   HighsInt primal_edge_weight_strategy;
   HighsInt price_strategy;
+  HighsInt reinversion_strategy;
 
   double dual_simplex_cost_perturbation_multiplier;
   double primal_simplex_phase1_cost_perturbation_multiplier = 1;
@@ -202,6 +203,14 @@ struct HighsSimplexInfo {
   HighsInt primal_phase1_iteration_count = 0;
   HighsInt primal_phase2_iteration_count = 0;
   HighsInt primal_bound_swap = 0;
+  // Values of the counts when the current simplex solve started, so
+  // that those of the solve can be reported
+  HighsInt iteration_count0 = 0;
+  HighsInt dual_phase1_iteration_count0 = 0;
+  HighsInt dual_phase2_iteration_count0 = 0;
+  HighsInt primal_phase1_iteration_count0 = 0;
+  HighsInt primal_phase2_iteration_count0 = 0;
+  HighsInt primal_bound_swap0 = 0;
 
   HighsInt min_threads = 1;
   HighsInt num_threads = 1;